@@ -2,8 +2,15 @@
   *
   * \brief A byte-oriented AES (Rijndael) implementation.
   *
-  * The emphasis is on having small code size. As a result, performance (time
-  * taken per byte encrypted or decrypted) may not be very good.
+  * There are two implementations, selected at compile time (see aes.h):
+  * - The original byte-oriented implementation, where the emphasis is on
+  *   having small code size. As a result, performance (time taken per byte
+  *   encrypted or decrypted) may not be very good.
+  * - A 32 bit bitsliced implementation (#AES_BITSLICED), which is faster on
+  *   32 bit processors and, having no key- or data-dependent table lookups,
+  *   runs in constant time.
+  * Both use the same API and give identical results, but the format of the
+  * expanded key differs between them.
   * This implementation is for 128 bit keys (10 rounds). At the moment the
   * number of rounds and key size are hardcoded. The block size is also fixed
   * at 128 bits.
@@ -27,6 +34,8 @@
 #include "common.h"
 #include "aes.h"
 
+#ifndef AES_BITSLICED
+
 /** Forward S-box for Rijndael. */
 static const uint8_t sbox[256] PROGMEM = {
 0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
@@ -239,6 +248,8 @@ static void invMixSubColumns(uint8_t *state)
 	}
 }
 
+#endif // #ifndef AES_BITSLICED
+
 /** XOR (r = r XOR op1) 16 bytes with another 16 bytes.
   * \param r One operand for the XOR operation. The result will also be
   *          written here.
@@ -259,6 +270,564 @@ void xor16Bytes(uint8_t *r, uint8_t *op1)
 static const uint8_t r_con[11] = {
 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36};
 
+#ifdef AES_BITSLICED
+
+/* The bitsliced implementation stores the 16 byte AES state as 8 "planes".
+ * Bit k of plane i is bit i of state byte k, so each operation on a plane
+ * acts on the same bit of all 16 bytes at once. State bytes are in the usual
+ * column-major order (byte k is in row k & 3, column k >> 2), so each
+ * column occupies 4 adjacent bits of a plane. Only the bottom 16 bits of
+ * each plane are used. Since there are no data-dependent table lookups or
+ * branches, this implementation runs in constant time. */
+
+/** Apply the AES S-box to every byte of a bitsliced state. This uses the
+  * 113 gate circuit from "A depth-16 circuit for the AES S-box" by Joan
+  * Boyar and Rene Peralta (2011).
+  * \param q The 8 planes of the bitsliced state. These will be overwritten.
+  */
+static void subBytesBitsliced(uint32_t *q)
+{
+	uint32_t x0, x1, x2, x3, x4, x5, x6, x7;
+	uint32_t y1, y2, y3, y4, y5, y6, y7, y8, y9;
+	uint32_t y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+	uint32_t y20, y21;
+	uint32_t z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+	uint32_t z10, z11, z12, z13, z14, z15, z16, z17;
+	uint32_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+	uint32_t t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+	uint32_t t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+	uint32_t t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+	uint32_t t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+	uint32_t t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+	uint32_t t60, t61, t62, t63, t64, t65, t66, t67;
+	uint32_t s0, s1, s2, s3, s4, s5, s6, s7;
+
+	x0 = q[7];
+	x1 = q[6];
+	x2 = q[5];
+	x3 = q[4];
+	x4 = q[3];
+	x5 = q[2];
+	x6 = q[1];
+	x7 = q[0];
+
+	// Top linear transformation.
+	y14 = x3 ^ x5;
+	y13 = x0 ^ x6;
+	y9 = x0 ^ x3;
+	y8 = x0 ^ x5;
+	t0 = x1 ^ x2;
+	y1 = t0 ^ x7;
+	y4 = y1 ^ x3;
+	y12 = y13 ^ y14;
+	y2 = y1 ^ x0;
+	y5 = y1 ^ x6;
+	y3 = y5 ^ y8;
+	t1 = x4 ^ y12;
+	y15 = t1 ^ x5;
+	y20 = t1 ^ x1;
+	y6 = y15 ^ x7;
+	y10 = y15 ^ t0;
+	y11 = y20 ^ y9;
+	y7 = x7 ^ y11;
+	y17 = y10 ^ y11;
+	y19 = y10 ^ y8;
+	y16 = t0 ^ y11;
+	y21 = y13 ^ y16;
+	y18 = x0 ^ y16;
+
+	// Non-linear section (inversion in GF(2 ^ 8)).
+	t2 = y12 & y15;
+	t3 = y3 & y6;
+	t4 = t3 ^ t2;
+	t5 = y4 & x7;
+	t6 = t5 ^ t2;
+	t7 = y13 & y16;
+	t8 = y5 & y1;
+	t9 = t8 ^ t7;
+	t10 = y2 & y7;
+	t11 = t10 ^ t7;
+	t12 = y9 & y11;
+	t13 = y14 & y17;
+	t14 = t13 ^ t12;
+	t15 = y8 & y10;
+	t16 = t15 ^ t12;
+	t17 = t4 ^ t14;
+	t18 = t6 ^ t16;
+	t19 = t9 ^ t14;
+	t20 = t11 ^ t16;
+	t21 = t17 ^ y20;
+	t22 = t18 ^ y19;
+	t23 = t19 ^ y21;
+	t24 = t20 ^ y18;
+
+	t25 = t21 ^ t22;
+	t26 = t21 & t23;
+	t27 = t24 ^ t26;
+	t28 = t25 & t27;
+	t29 = t28 ^ t22;
+	t30 = t23 ^ t24;
+	t31 = t22 ^ t26;
+	t32 = t31 & t30;
+	t33 = t32 ^ t24;
+	t34 = t23 ^ t33;
+	t35 = t27 ^ t33;
+	t36 = t24 & t35;
+	t37 = t36 ^ t34;
+	t38 = t27 ^ t36;
+	t39 = t29 & t38;
+	t40 = t25 ^ t39;
+
+	t41 = t40 ^ t37;
+	t42 = t29 ^ t33;
+	t43 = t29 ^ t40;
+	t44 = t33 ^ t37;
+	t45 = t42 ^ t41;
+	z0 = t44 & y15;
+	z1 = t37 & y6;
+	z2 = t33 & x7;
+	z3 = t43 & y16;
+	z4 = t40 & y1;
+	z5 = t29 & y7;
+	z6 = t42 & y11;
+	z7 = t45 & y17;
+	z8 = t41 & y10;
+	z9 = t44 & y12;
+	z10 = t37 & y3;
+	z11 = t33 & y4;
+	z12 = t43 & y13;
+	z13 = t40 & y5;
+	z14 = t29 & y2;
+	z15 = t42 & y9;
+	z16 = t45 & y14;
+	z17 = t41 & y8;
+
+	// Bottom linear transformation.
+	t46 = z15 ^ z16;
+	t47 = z10 ^ z11;
+	t48 = z5 ^ z13;
+	t49 = z9 ^ z10;
+	t50 = z2 ^ z12;
+	t51 = z2 ^ z5;
+	t52 = z7 ^ z8;
+	t53 = z0 ^ z3;
+	t54 = z6 ^ z7;
+	t55 = z16 ^ z17;
+	t56 = z12 ^ t48;
+	t57 = t50 ^ t53;
+	t58 = z4 ^ t46;
+	t59 = z3 ^ t54;
+	t60 = t46 ^ t57;
+	t61 = z14 ^ t57;
+	t62 = t52 ^ t58;
+	t63 = t49 ^ t58;
+	t64 = z4 ^ t59;
+	t65 = t61 ^ t62;
+	t66 = z1 ^ t63;
+	s0 = t59 ^ t63;
+	s6 = t56 ^ ~t62;
+	s7 = t48 ^ ~t60;
+	t67 = t64 ^ t65;
+	s3 = t53 ^ t66;
+	s4 = t51 ^ t66;
+	s5 = t47 ^ t65;
+	s1 = t64 ^ ~s3;
+	s2 = t55 ^ ~t67;
+
+	q[7] = s0;
+	q[6] = s1;
+	q[5] = s2;
+	q[4] = s3;
+	q[3] = s4;
+	q[2] = s5;
+	q[1] = s6;
+	q[0] = s7;
+}
+
+/** Apply the inverse of the affine transformation which is part of the
+  * AES S-box (including its constant). Combined with subBytesBitsliced(),
+  * this gives the inverse S-box, since the inversion in GF(2 ^ 8) is its
+  * own inverse.
+  * \param q The 8 planes of the bitsliced state. These will be overwritten.
+  */
+static void invAffineBitsliced(uint32_t *q)
+{
+	uint32_t q0, q1, q2, q3, q4, q5, q6, q7;
+
+	q0 = ~q[0];
+	q1 = ~q[1];
+	q2 = q[2];
+	q3 = q[3];
+	q4 = q[4];
+	q5 = ~q[5];
+	q6 = ~q[6];
+	q7 = q[7];
+	q[7] = q1 ^ q4 ^ q6;
+	q[6] = q0 ^ q3 ^ q5;
+	q[5] = q7 ^ q2 ^ q4;
+	q[4] = q6 ^ q1 ^ q3;
+	q[3] = q5 ^ q0 ^ q2;
+	q[2] = q4 ^ q7 ^ q1;
+	q[1] = q3 ^ q6 ^ q0;
+	q[0] = q2 ^ q5 ^ q7;
+}
+
+/** Apply the inverse AES S-box to every byte of a bitsliced state.
+  * \param q The 8 planes of the bitsliced state. These will be overwritten.
+  */
+static void invSubBytesBitsliced(uint32_t *q)
+{
+	invAffineBitsliced(q);
+	subBytesBitsliced(q);
+	invAffineBitsliced(q);
+}
+
+/** Convert 16 bytes into bitsliced form.
+  * \param q The 8 planes of the bitsliced state will be written here.
+  * \param in The 16 bytes to convert.
+  */
+static void bitslice(uint32_t *q, const uint8_t *in)
+{
+	uint32_t w[4];
+	uint32_t x;
+	uint8_t i;
+	uint8_t c;
+
+	for (c = 0; c < 4; c++)
+	{
+		w[c] = (uint32_t)in[4 * c]
+			| ((uint32_t)in[4 * c + 1] << 8)
+			| ((uint32_t)in[4 * c + 2] << 16)
+			| ((uint32_t)in[4 * c + 3] << 24);
+	}
+	for (i = 0; i < 8; i++)
+	{
+		q[i] = 0;
+		for (c = 0; c < 4; c++)
+		{
+			// Gather bit i of each of the 4 bytes in column c into a nibble.
+			x = (w[c] >> i) & 0x01010101;
+			x = x | (x >> 7);
+			x = (x | (x >> 14)) & 0x0f;
+			q[i] |= x << (4 * c);
+		}
+	}
+}
+
+/** Convert a bitsliced state back into 16 bytes. This is the inverse of
+  * bitslice().
+  * \param out The 16 bytes will be written here.
+  * \param q The 8 planes of the bitsliced state.
+  */
+static void unbitslice(uint8_t *out, const uint32_t *q)
+{
+	uint32_t w;
+	uint32_t x;
+	uint8_t i;
+	uint8_t c;
+
+	for (c = 0; c < 4; c++)
+	{
+		w = 0;
+		for (i = 0; i < 8; i++)
+		{
+			// Spread the nibble for column c so that each bit goes to the
+			// bottom of a different byte.
+			x = (q[i] >> (4 * c)) & 0x0f;
+			x = (x | (x << 14)) & 0x00030003;
+			x = (x | (x << 7)) & 0x01010101;
+			w |= x << i;
+		}
+		out[4 * c] = (uint8_t)w;
+		out[4 * c + 1] = (uint8_t)(w >> 8);
+		out[4 * c + 2] = (uint8_t)(w >> 16);
+		out[4 * c + 3] = (uint8_t)(w >> 24);
+	}
+}
+
+/** Apply ShiftRows to a bitsliced state. Row r is rotated left by r
+  * columns, which within a plane is a rotation right by 4 * r bits.
+  * \param q The 8 planes of the bitsliced state. These will be overwritten.
+  */
+static void shiftRowsBitsliced(uint32_t *q)
+{
+	uint32_t x;
+	uint8_t i;
+
+	for (i = 0; i < 8; i++)
+	{
+		x = q[i];
+		q[i] = (x & 0x1111)
+			| (((x & 0x2222) >> 4) | ((x & 0x0002) << 12))
+			| (((x & 0x4444) >> 8) | ((x & 0x0044) << 8))
+			| (((x & 0x8888) >> 12) | ((x & 0x0888) << 4));
+	}
+}
+
+/** Apply InvShiftRows to a bitsliced state. This is the inverse of
+  * shiftRowsBitsliced().
+  * \param q The 8 planes of the bitsliced state. These will be overwritten.
+  */
+static void invShiftRowsBitsliced(uint32_t *q)
+{
+	uint32_t x;
+	uint8_t i;
+
+	for (i = 0; i < 8; i++)
+	{
+		x = q[i];
+		q[i] = (x & 0x1111)
+			| (((x & 0x0222) << 4) | ((x & 0x2000) >> 12))
+			| (((x & 0x0044) << 8) | ((x & 0x4400) >> 8))
+			| (((x & 0x0008) << 12) | ((x & 0x8880) >> 4));
+	}
+}
+
+/** Rotate each column of a bitsliced plane up by one row, so that row r
+  * receives what was in row r + 1 (mod 4). */
+#define ROTATE_ROWS_1(x)	((((x) >> 1) & 0x7777) | (((x) << 3) & 0x8888))
+/** Rotate each column of a bitsliced plane up by two rows. */
+#define ROTATE_ROWS_2(x)	((((x) >> 2) & 0x3333) | (((x) << 2) & 0xcccc))
+/** Rotate each column of a bitsliced plane up by three rows. */
+#define ROTATE_ROWS_3(x)	((((x) >> 3) & 0x1111) | (((x) << 1) & 0xeeee))
+
+/** Multiply every byte of a bitsliced state by 2 under the field
+  * GF(2 ^ 8) with the reducing polynomial x ^ 8 + x ^ 4 + x ^ 3 + x + 1.
+  * \param r The 8 planes of the result will be written here. This may be
+  *          the same as q.
+  * \param q The 8 planes of the bitsliced state to multiply.
+  */
+static void xTimes2Bitsliced(uint32_t *r, const uint32_t *q)
+{
+	uint32_t top;
+
+	top = q[7];
+	r[7] = q[6];
+	r[6] = q[5];
+	r[5] = q[4];
+	r[4] = q[3] ^ top;
+	r[3] = q[2] ^ top;
+	r[2] = q[1];
+	r[1] = q[0] ^ top;
+	r[0] = top;
+}
+
+/** Apply MixColumns to a bitsliced state. For each row r of each column,
+  * this computes 2 * a[r] + 3 * a[r + 1] + a[r + 2] + a[r + 3], which
+  * equals 2 * (a[r] + a[r + 1]) + a[r + 1] + a[r + 2] + a[r + 3].
+  * \param q The 8 planes of the bitsliced state. These will be overwritten.
+  */
+static void mixColumnsBitsliced(uint32_t *q)
+{
+	uint32_t t[8];
+	uint32_t r1;
+	uint8_t i;
+
+	for (i = 0; i < 8; i++)
+	{
+		r1 = ROTATE_ROWS_1(q[i]);
+		t[i] = q[i] ^ r1;
+		q[i] = r1 ^ ROTATE_ROWS_2(q[i]) ^ ROTATE_ROWS_3(q[i]);
+	}
+	xTimes2Bitsliced(t, t);
+	for (i = 0; i < 8; i++)
+	{
+		q[i] ^= t[i];
+	}
+}
+
+/** Apply InvMixColumns to a bitsliced state. This uses the fact that the
+  * InvMixColumns matrix is the MixColumns matrix multiplied by
+  * [5 0 4 0; 0 5 0 4; 4 0 5 0; 0 4 0 5], so a[r] += 4 * (a[r] + a[r + 2])
+  * followed by MixColumns does the job.
+  * \param q The 8 planes of the bitsliced state. These will be overwritten.
+  */
+static void invMixColumnsBitsliced(uint32_t *q)
+{
+	uint32_t t[8];
+	uint8_t i;
+
+	for (i = 0; i < 8; i++)
+	{
+		t[i] = q[i] ^ ROTATE_ROWS_2(q[i]);
+	}
+	xTimes2Bitsliced(t, t);
+	xTimes2Bitsliced(t, t);
+	for (i = 0; i < 8; i++)
+	{
+		q[i] ^= t[i];
+	}
+	mixColumnsBitsliced(q);
+}
+
+/** Apply the AES S-box to each of the 4 bytes in a word, in constant time.
+  * This is SubWord() from the key schedule.
+  * \param w The 4 bytes, packed in little-endian order.
+  * \return The 4 substituted bytes, packed in the same order.
+  */
+static uint32_t subWordBitsliced(uint32_t w)
+{
+	uint32_t q[8];
+	uint32_t x;
+	uint32_t r;
+	uint8_t i;
+
+	// Like bitslice() and unbitslice(), but only for column 0.
+	for (i = 0; i < 8; i++)
+	{
+		x = (w >> i) & 0x01010101;
+		x = x | (x >> 7);
+		q[i] = (x | (x >> 14)) & 0x0f;
+	}
+	subBytesBitsliced(q);
+	r = 0;
+	for (i = 0; i < 8; i++)
+	{
+		x = q[i] & 0x0f;
+		x = (x | (x << 14)) & 0x00030003;
+		x = (x | (x << 7)) & 0x01010101;
+		r |= x << i;
+	}
+	return r;
+}
+
+/** Load one round key from an expanded key. In this implementation, round
+  * keys are stored in bitsliced form, as 8 16 bit little-endian planes.
+  * \param q The 8 planes of the round key will be written here.
+  * \param round_key Pointer to the 16 byte round key within the expanded
+  *                  key.
+  */
+static void loadRoundKey(uint32_t *q, const uint8_t *round_key)
+{
+	uint8_t i;
+
+	for (i = 0; i < 8; i++)
+	{
+		q[i] = (uint32_t)round_key[2 * i] | ((uint32_t)round_key[2 * i + 1] << 8);
+	}
+}
+
+/** XOR a round key into a bitsliced state.
+  * \param q The 8 planes of the bitsliced state. These will be overwritten.
+  * \param round_key Pointer to the 16 byte round key within the expanded
+  *                  key.
+  */
+static void addRoundKeyBitsliced(uint32_t *q, const uint8_t *round_key)
+{
+	uint32_t k[8];
+	uint8_t i;
+
+	loadRoundKey(k, round_key);
+	for (i = 0; i < 8; i++)
+	{
+		q[i] ^= k[i];
+	}
+}
+
+/** Expand the key by 16 bytes for each round. This must be called once (but
+  * it only needs to be called only once) per key before encryption or
+  * decryption, since encryption and decryption use the expanded key.
+  * The round keys are stored in bitsliced form, and the S-box is evaluated
+  * with subBytesBitsliced(), so this also runs in constant time.
+  * \param expanded_key Buffer of size #EXPANDED_KEY_SIZE bytes to store
+  *                     expanded key.
+  * \param key 16 byte input key.
+  */
+void aesExpandKey(uint8_t *expanded_key, uint8_t *key)
+{
+	uint8_t round_key[16];
+	uint32_t temp;
+	uint32_t q[8];
+	uint8_t round;
+	uint8_t i;
+
+	memcpy(round_key, key, 16);
+	for (round = 0; round < 11; round++)
+	{
+		if (round != 0)
+		{
+			// RotWord, SubWord and Rcon, applied to the last word of the
+			// previous round key.
+			temp = (uint32_t)round_key[13]
+				| ((uint32_t)round_key[14] << 8)
+				| ((uint32_t)round_key[15] << 16)
+				| ((uint32_t)round_key[12] << 24);
+			temp = subWordBitsliced(temp) ^ r_con[round];
+			for (i = 0; i < 16; i++)
+			{
+				round_key[i] ^= (uint8_t)(temp >> (8 * (i & 3)));
+				temp = (temp & ~((uint32_t)0xff << (8 * (i & 3))))
+					| ((uint32_t)round_key[i] << (8 * (i & 3)));
+			}
+		}
+		bitslice(q, round_key);
+		for (i = 0; i < 8; i++)
+		{
+			expanded_key[round * 16 + 2 * i] = (uint8_t)q[i];
+			expanded_key[round * 16 + 2 * i + 1] = (uint8_t)(q[i] >> 8);
+		}
+	}
+	memset(round_key, 0, sizeof(round_key));
+	memset(q, 0, sizeof(q));
+	temp = 0;
+}
+
+/** Encrypt one 128 bit block.
+  * \param out The resulting ciphertext will be placed here. This should be a
+  *            16 byte array.
+  * \param in The plaintext to encrypt. This should also be a 16 byte array.
+  * \param expanded_key Should point to an array containing the expanded
+  *                     key (see aesExpandKey()).
+  */
+void aesEncrypt(uint8_t *out, uint8_t *in, uint8_t *expanded_key)
+{
+	uint32_t q[8];
+	uint8_t round;
+
+	bitslice(q, in);
+	addRoundKeyBitsliced(q, expanded_key);
+	for (round = 1; round < 11; round++)
+	{
+		subBytesBitsliced(q);
+		shiftRowsBitsliced(q);
+		if (round < 10)
+		{
+			mixColumnsBitsliced(q);
+		}
+		addRoundKeyBitsliced(q, &(expanded_key[round * 16]));
+	}
+	unbitslice(out, q);
+}
+
+/** Decrypt one 128 bit block.
+  * \param out The resulting plaintext will be placed here. This should be a
+  *            16 byte array.
+  * \param in The ciphertext to decrypt. This should also be a 16 byte array.
+  * \param expanded_key Should point to an array containing the expanded
+  *                     key (see aesExpandKey()).
+  */
+void aesDecrypt(uint8_t *out, uint8_t *in, uint8_t *expanded_key)
+{
+	uint32_t q[8];
+	uint8_t round;
+
+	bitslice(q, in);
+	addRoundKeyBitsliced(q, &(expanded_key[160]));
+	for (round = 10; round--; )
+	{
+		invShiftRowsBitsliced(q);
+		invSubBytesBitsliced(q);
+		addRoundKeyBitsliced(q, &(expanded_key[round * 16]));
+		if (round != 0)
+		{
+			invMixColumnsBitsliced(q);
+		}
+	}
+	unbitslice(out, q);
+}
+
+#else
+
 /** Expand the key by 16 bytes for each round. This must be called once (but
   * it only needs to be called only once) per key before encryption or
   * decryption, since encryption and decryption use the expanded key.
@@ -351,6 +920,8 @@ void aesDecrypt(uint8_t *out, uint8_t *in, uint8_t *expanded_key)
 	}
 }
 
+#endif // #ifdef AES_BITSLICED
+
 #ifdef TEST_AES
 
 /** Run unit tests using test vectors from a file. The file is expected to be
@@ -504,9 +1075,140 @@ from http://csrc.nist.gov/groups/STM/cavp/#01", filename);
 	fclose(test_vector_file);
 }
 
+#ifdef AES_BITSLICED
+
+/** Multiply two elements of GF(2 ^ 8) with the reducing polynomial
+  * x ^ 8 + x ^ 4 + x ^ 3 + x + 1, the slow way. */
+static uint8_t slowMultiplyInGF(uint8_t a, uint8_t b)
+{
+	uint8_t r;
+	uint8_t i;
+
+	r = 0;
+	for (i = 0; i < 8; i++)
+	{
+		if (b & 1)
+		{
+			r ^= a;
+		}
+		b >>= 1;
+		a = (uint8_t)((a << 1) ^ ((a & 0x80) ? 0x1b : 0));
+	}
+	return r;
+}
+
+/** Check subBytesBitsliced() and invSubBytesBitsliced() against the
+  * definition of the S-box (multiplicative inverse followed by an affine
+  * transformation) for every possible input byte. */
+static void testSboxBitsliced(void)
+{
+	uint8_t expected[256];
+	uint8_t in[16];
+	uint8_t out[16];
+	uint32_t q[8];
+	unsigned int x;
+	unsigned int y;
+	uint8_t inverse;
+	uint8_t s;
+	uint8_t i;
+
+	for (x = 0; x < 256; x++)
+	{
+		inverse = 0;
+		for (y = 1; y < 256; y++)
+		{
+			if (slowMultiplyInGF((uint8_t)x, (uint8_t)y) == 1)
+			{
+				inverse = (uint8_t)y;
+			}
+		}
+		s = (uint8_t)(0x63 ^ inverse);
+		for (i = 1; i < 5; i++)
+		{
+			s ^= (uint8_t)((inverse << i) | (inverse >> (8 - i)));
+		}
+		expected[x] = s;
+	}
+	for (x = 0; x < 256; x += 16)
+	{
+		for (i = 0; i < 16; i++)
+		{
+			in[i] = (uint8_t)(x + i);
+		}
+		bitslice(q, in);
+		subBytesBitsliced(q);
+		unbitslice(out, q);
+		if (memcmp(out, &(expected[x]), 16))
+		{
+			printf("subBytesBitsliced() mismatch near %u\n", x);
+			reportFailure();
+		}
+		else
+		{
+			reportSuccess();
+		}
+		bitslice(q, out);
+		invSubBytesBitsliced(q);
+		unbitslice(out, q);
+		if (memcmp(out, in, 16))
+		{
+			printf("invSubBytesBitsliced() mismatch near %u\n", x);
+			reportFailure();
+		}
+		else
+		{
+			reportSuccess();
+		}
+	}
+}
+
+#endif // #ifdef AES_BITSLICED
+
 int main(void)
 {
+	// Test vector from appendix C.1 of FIPS 197.
+	uint8_t key[16] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+		0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f};
+	uint8_t plaintext[16] = {
+		0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+		0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff};
+	uint8_t ciphertext[16] = {
+		0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+		0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a};
+	uint8_t expanded_key[EXPANDED_KEY_SIZE];
+	uint8_t compare_text[16];
+
 	initTests(__FILE__);
+#ifdef AES_BITSLICED
+	printf("Testing bitsliced implementation\n");
+	testSboxBitsliced();
+#else
+	printf("Testing byte-oriented implementation\n");
+#endif // #ifdef AES_BITSLICED
+
+	aesExpandKey(expanded_key, key);
+	aesEncrypt(compare_text, plaintext, expanded_key);
+	if (memcmp(compare_text, ciphertext, 16))
+	{
+		printf("FIPS 197 encryption test failed\n");
+		reportFailure();
+	}
+	else
+	{
+		reportSuccess();
+	}
+	aesDecrypt(compare_text, ciphertext, expanded_key);
+	if (memcmp(compare_text, plaintext, 16))
+	{
+		printf("FIPS 197 decryption test failed\n");
+		reportFailure();
+	}
+	else
+	{
+		reportSuccess();
+	}
+
 	scanTestVectors("ECBVarTxt128.rsp");
 	scanTestVectors("ECBVarKey128.rsp");
 	scanTestVectors("ECBKeySbox128.rsp");
@@ -17,6 +17,16 @@
 /** Size of expanded key, in bytes. */
 #define EXPANDED_KEY_SIZE	176
 
+/** Use the 32 bit bitsliced implementation in aes.c instead of the
+  * byte-oriented one. The bitsliced implementation is constant time and is
+  * faster on 32 bit processors, but uses more code space.
+  * This is defined by default everywhere except AVR. Define
+  * AES_BYTE_ORIENTED to force the original byte-oriented implementation.
+  */
+#if !defined(AVR) && !defined(AES_BYTE_ORIENTED)
+#define AES_BITSLICED
+#endif // #if !defined(AVR) && !defined(AES_BYTE_ORIENTED)
+
 extern void xor16Bytes(uint8_t *r, uint8_t *op1);
 extern void aesExpandKey(uint8_t *expanded_key, uint8_t *key);
 extern void aesEncrypt(uint8_t *out, uint8_t *in, uint8_t *expanded_key);
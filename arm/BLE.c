@@ -39,11 +39,13 @@ void toggleAEM(bool useAEM)
 		s = 127;
 		temp1[0] = s;
 		nonVolatileWrite(temp1, AEM_USE_ADDRESS, 1);
+		nonVolatileFlush();
 	}else
 	{
 		s = 128;
 		temp1[0] = s;
 		nonVolatileWrite(temp1, AEM_USE_ADDRESS, 1);
+		nonVolatileFlush();
 	}
 }
 
@@ -0,0 +1,502 @@
+/** \file ble_tx.c
+  *
+  * \brief Paces bytes sent to the BLE module.
+  *
+  * The BLE module has a small internal buffer and forwards bytes over the
+  * air much more slowly than the UART delivers them. If the UART runs
+  * unchecked, the module's buffer overflows and bytes are lost. The module
+  * has no line which signals that it is ready for more, so this file keeps
+  * track of how much the module can take with credits. One credit lets one
+  * byte be handed to the UART. A periodic tick (see bleTxTick()) grants
+  * credits at the rate the air link is assumed to drain the module, up to
+  * #BLE_TX_MAX_CREDITS. Bytes to send wait in a queue until there are
+  * credits for them.
+  *
+  * An assumed rate has to be a safe guess for the slowest link. If the host
+  * acknowledges what it receives (see usartSetTransmitWindow()), the host
+  * is the one who says when the module has room, so the tick stops
+  * rationing credits and the rate is set by the link itself. The
+  * acknowledgement window is what stops the module's buffer overflowing.
+  *
+  * Either way, the caller doesn't sleep at all until the queue is full.
+  *
+  * The queue has one producer (bleTxPut(), in the main thread) and one
+  * consumer (bleTxTick(), in the timer interrupt). Each index is only ever
+  * written by one side, so no locking is needed.
+  *
+  * This file is licensed as described by the file LICENCE.
+  */
+
+#ifdef TEST_BLE_TX
+#include <stdlib.h>
+#include <stdio.h>
+#include "../test_helpers.h"
+#endif // #ifdef TEST_BLE_TX
+
+#include "../common.h"
+#include "ble_tx.h"
+
+/** Bitwise AND mask for transmit queue index. */
+#define BLE_TX_BUFFER_MASK			(BLE_TX_BUFFER_SIZE - 1)
+
+/** Storage for the transmit queue. */
+static volatile uint8_t tx_buffer[BLE_TX_BUFFER_SIZE];
+/** Number of bytes ever taken out of the transmit queue. Only the timer
+  * interrupt writes to this. */
+static volatile uint32_t tx_buffer_start;
+/** Number of bytes ever put into the transmit queue. Only bleTxPut() writes
+  * to this. */
+static volatile uint32_t tx_buffer_end;
+/** Number of bytes which can be handed to the BLE module right now. Only the
+  * timer interrupt writes to this. */
+static volatile uint32_t tx_credits;
+/** Whether the host's acknowledgements, not the tick, limit how fast bytes
+  * go to the BLE module. */
+static volatile bool tx_host_paced;
+
+/** Clear the transmit queue and assume that the BLE module's buffer is empty.
+  * \warning Don't call this while the tick is running.
+  */
+void bleTxInit(void)
+{
+	tx_buffer_start = 0;
+	tx_buffer_end = 0;
+	tx_credits = BLE_TX_MAX_CREDITS;
+	tx_host_paced = false;
+}
+
+/** Choose what limits the rate at which bytes go to the BLE module.
+  * \param is_host_paced true if the host acknowledges what it receives,
+  *                      with a window no bigger than #BLE_TX_MAX_WINDOW.
+  *                      false to fall back to #BLE_TX_CREDITS_PER_TICK.
+  */
+void bleTxSetHostPaced(bool is_host_paced)
+{
+	tx_host_paced = is_host_paced;
+}
+
+/** Queue one byte for sending to the BLE module. If the queue is full, this
+  * will block until bleTxTick() has made room.
+  * \param data The byte to send.
+  */
+void bleTxPut(uint8_t data)
+{
+	while ((tx_buffer_end - tx_buffer_start) == BLE_TX_BUFFER_SIZE)
+	{
+		// do nothing
+	}
+	tx_buffer[tx_buffer_end & BLE_TX_BUFFER_MASK] = data;
+	tx_buffer_end++;
+}
+
+/** Grant the credits for one tick, then hand as many queued bytes to the
+  * BLE module as the credits (and the UART) allow. This should be called
+  * every #BLE_TX_TICK_US microseconds, from a timer interrupt.
+  */
+void bleTxTick(void)
+{
+	uint32_t credits;
+	uint32_t start;
+
+	if (tx_host_paced)
+	{
+		// Only the UART limits what can be handed over now.
+		credits = BLE_TX_BUFFER_SIZE;
+	}
+	else
+	{
+		credits = MIN(tx_credits + BLE_TX_CREDITS_PER_TICK, BLE_TX_MAX_CREDITS);
+	}
+	start = tx_buffer_start;
+	while ((credits > 0) && (start != tx_buffer_end) && bleLinkReady())
+	{
+		bleLinkWrite(tx_buffer[start & BLE_TX_BUFFER_MASK]);
+		start++;
+		credits--;
+	}
+	tx_buffer_start = start;
+	if (tx_host_paced)
+	{
+		tx_credits = BLE_TX_MAX_CREDITS;
+	}
+	else
+	{
+		tx_credits = credits;
+	}
+}
+
+/** Get the number of bytes waiting in the transmit queue.
+  * \return Number of bytes which haven't been handed to the BLE module yet.
+  */
+uint32_t bleTxQueued(void)
+{
+	return tx_buffer_end - tx_buffer_start;
+}
+
+/** Check whether everything sent has had time to leave the BLE module. That
+  * is, the queue is empty and the credits have refilled.
+  * \return true if everything has been sent, false if not.
+  */
+bool bleTxIsIdle(void)
+{
+	return (bleTxQueued() == 0) && (tx_credits == BLE_TX_MAX_CREDITS);
+}
+
+#ifdef TEST_BLE_TX
+
+/** Time, in microseconds, the UART needs to send one byte at 115200 baud
+  * (10 bits per byte), rounded up. */
+#define SIM_UART_BYTE_US			87
+/** Size of the UART driver's own transmit buffer, in number of bytes. */
+#define SIM_UART_BUFFER_SIZE		128
+/** Size of the BLE module's receive buffer, in number of bytes. The real
+  * size isn't documented; this is a guess which is consistent with the old
+  * fixed-delay scheme working. */
+#define SIM_MODULE_BUFFER_SIZE		128
+/** Number of bytes in one BLE notification. */
+#define SIM_NOTIFICATION_SIZE		20
+/** Length of the response sent in each simulation, in number of bytes.
+  * This is about the size of a large SignatureComplete message. */
+#define SIM_RESPONSE_LENGTH			5000
+/** Time limit for one simulation, in microseconds. */
+#define SIM_TIME_LIMIT_US			30000000
+
+/** How the air link between the BLE module and the host is modelled. */
+struct SimLink
+{
+	/** Description of the link, for the report. */
+	const char *name;
+	/** BLE connection interval, in microseconds. */
+	uint32_t connection_interval_us;
+	/** Number of notifications sent per connection event. */
+	uint32_t notifications_per_event;
+};
+
+/** The links to simulate. The first one is the slowest link the default
+  * pacing parameters in ble_tx.h are meant to cope with. */
+static const struct SimLink sim_links[] =
+{
+	{"1 notification / 15 ms", 15000, 1},
+	{"2 notifications / 20 ms", 20000, 2},
+	{"4 notifications / 30 ms", 30000, 4}
+};
+
+/** Bytes waiting in the UART driver's transmit buffer. */
+static uint32_t sim_uart_queued;
+/** Bytes handed to the UART, in the order they were handed over. */
+static uint8_t sim_uart_sent[SIM_RESPONSE_LENGTH];
+/** Number of bytes handed to the UART. */
+static uint32_t sim_uart_sent_count;
+/** Bytes waiting in the BLE module's buffer. */
+static uint32_t sim_module_queued;
+/** Number of bytes dropped because the BLE module's buffer was full. */
+static uint32_t sim_module_dropped;
+/** Number of bytes which the host has received. */
+static uint32_t sim_host_received;
+
+bool bleLinkReady(void)
+{
+	return sim_uart_queued < SIM_UART_BUFFER_SIZE;
+}
+
+void bleLinkWrite(uint8_t data)
+{
+	if (sim_uart_sent_count < SIM_RESPONSE_LENGTH)
+	{
+		sim_uart_sent[sim_uart_sent_count] = data;
+	}
+	sim_uart_sent_count++;
+	sim_uart_queued++;
+}
+
+/** Reset the simulated UART, BLE module and host. */
+static void simReset(void)
+{
+	sim_uart_queued = 0;
+	sim_uart_sent_count = 0;
+	sim_module_queued = 0;
+	sim_module_dropped = 0;
+	sim_host_received = 0;
+}
+
+/** Advance the simulated UART, BLE module and air link by 1 microsecond.
+  * \param now Current simulation time, in microseconds.
+  * \param link The air link model to use.
+  */
+static void simStep(uint32_t now, const struct SimLink *link)
+{
+	uint32_t count;
+
+	if (((now % SIM_UART_BYTE_US) == 0) && (sim_uart_queued > 0))
+	{
+		sim_uart_queued--;
+		if (sim_module_queued < SIM_MODULE_BUFFER_SIZE)
+		{
+			sim_module_queued++;
+		}
+		else
+		{
+			sim_module_dropped++;
+		}
+	}
+	if ((now % link->connection_interval_us) == 0)
+	{
+		count = MIN(sim_module_queued, link->notifications_per_event * SIM_NOTIFICATION_SIZE);
+		sim_module_queued -= count;
+		sim_host_received += count;
+	}
+}
+
+/** Send a response the old way: hand bytes straight to the UART, but sleep
+  * for 100 ms after every 80 bytes.
+  * \param link The air link model to use.
+  * \return Time taken for the host to receive everything, in microseconds.
+  */
+static uint32_t simulateFixedDelay(const struct SimLink *link)
+{
+	uint32_t now;
+	uint32_t sent;
+	uint32_t slice_counter;
+	uint32_t sleep_until;
+
+	simReset();
+	sent = 0;
+	slice_counter = 0;
+	sleep_until = 0;
+	for (now = 1; now < SIM_TIME_LIMIT_US; now++)
+	{
+		if ((sent < SIM_RESPONSE_LENGTH) && (now >= sleep_until) && bleLinkReady())
+		{
+			slice_counter++;
+			if (slice_counter == 80)
+			{
+				sleep_until = now + 100000;
+				slice_counter = 0;
+			}
+			bleLinkWrite((uint8_t)sent);
+			sent++;
+		}
+		simStep(now, link);
+		if ((sim_host_received + sim_module_dropped) == SIM_RESPONSE_LENGTH)
+		{
+			break;
+		}
+	}
+	return now;
+}
+
+/** Send a response through the credit-based transmit queue.
+  * \param link The air link model to use.
+  * \return Time taken for the host to receive everything, in microseconds.
+  */
+static uint32_t simulateCredits(const struct SimLink *link)
+{
+	uint32_t now;
+	uint32_t sent;
+
+	simReset();
+	bleTxInit();
+	sent = 0;
+	for (now = 1; now < SIM_TIME_LIMIT_US; now++)
+	{
+		// Fill the queue as fast as bleTxPut() would.
+		while ((sent < SIM_RESPONSE_LENGTH) && (bleTxQueued() < BLE_TX_BUFFER_SIZE))
+		{
+			bleTxPut((uint8_t)sent);
+			sent++;
+		}
+		if ((now % BLE_TX_TICK_US) == 0)
+		{
+			bleTxTick();
+		}
+		simStep(now, link);
+		if ((sim_host_received + sim_module_dropped) == SIM_RESPONSE_LENGTH)
+		{
+			break;
+		}
+	}
+	return now;
+}
+
+/** Send a response through the transmit queue, with the host acknowledging
+  * every #BLE_TX_MAX_WINDOW bytes, like streamPutOneByte() does. The host
+  * sends its acknowledgement as soon as it has received the whole window,
+  * and the acknowledgement takes one connection interval to arrive.
+  * \param link The air link model to use.
+  * \return Time taken for the host to receive everything, in microseconds.
+  */
+static uint32_t simulateHostPaced(const struct SimLink *link)
+{
+	uint32_t now;
+	uint32_t sent;
+	uint32_t window_left;
+	uint32_t ack_arrives;
+
+	simReset();
+	bleTxInit();
+	bleTxSetHostPaced(true);
+	sent = 0;
+	window_left = BLE_TX_MAX_WINDOW;
+	ack_arrives = 0;
+	for (now = 1; now < SIM_TIME_LIMIT_US; now++)
+	{
+		if ((window_left == 0) && (ack_arrives == 0) && (sim_host_received == sent))
+		{
+			ack_arrives = now + link->connection_interval_us;
+		}
+		if ((ack_arrives != 0) && (now >= ack_arrives))
+		{
+			window_left = BLE_TX_MAX_WINDOW;
+			ack_arrives = 0;
+		}
+		while ((sent < SIM_RESPONSE_LENGTH) && (window_left > 0) && (bleTxQueued() < BLE_TX_BUFFER_SIZE))
+		{
+			bleTxPut((uint8_t)sent);
+			sent++;
+			window_left--;
+		}
+		if ((now % BLE_TX_TICK_US) == 0)
+		{
+			bleTxTick();
+		}
+		simStep(now, link);
+		if ((sim_host_received + sim_module_dropped) == SIM_RESPONSE_LENGTH)
+		{
+			break;
+		}
+	}
+	bleTxSetHostPaced(false);
+	return now;
+}
+
+/** Check that the last simulation handed every byte to the UART exactly
+  * once, in order, and that the BLE module didn't drop anything.
+  * \param name Description of the simulation, for failure messages.
+  */
+static void checkSimulation(const char *name)
+{
+	uint32_t i;
+	bool is_in_order;
+
+	is_in_order = (sim_uart_sent_count == SIM_RESPONSE_LENGTH);
+	for (i = 0; is_in_order && (i < SIM_RESPONSE_LENGTH); i++)
+	{
+		if (sim_uart_sent[i] != (uint8_t)i)
+		{
+			is_in_order = false;
+		}
+	}
+	if (!is_in_order)
+	{
+		printf("%s: bytes were not sent in order\n", name);
+		reportFailure();
+	}
+	else if (sim_module_dropped != 0)
+	{
+		printf("%s: BLE module dropped %u bytes\n", name, sim_module_dropped);
+		reportFailure();
+	}
+	else
+	{
+		reportSuccess();
+	}
+}
+
+/** Check that credits are capped at #BLE_TX_MAX_CREDITS, so that an idle
+  * period doesn't let a huge burst through afterwards. */
+static void testCreditCap(void)
+{
+	uint32_t i;
+
+	simReset();
+	bleTxInit();
+	for (i = 0; i < 100; i++)
+	{
+		bleTxTick();
+	}
+	for (i = 0; i < BLE_TX_BUFFER_SIZE; i++)
+	{
+		bleTxPut((uint8_t)i);
+	}
+	bleTxTick();
+	if (sim_uart_sent_count != BLE_TX_MAX_CREDITS)
+	{
+		printf("Burst after idle period was %u bytes\n", sim_uart_sent_count);
+		reportFailure();
+	}
+	else
+	{
+		reportSuccess();
+	}
+	bleTxTick();
+	if (sim_uart_sent_count != (BLE_TX_MAX_CREDITS + BLE_TX_CREDITS_PER_TICK))
+	{
+		printf("Tick after burst sent %u bytes\n", sim_uart_sent_count - BLE_TX_MAX_CREDITS);
+		reportFailure();
+	}
+	else
+	{
+		reportSuccess();
+	}
+	if (bleTxIsIdle())
+	{
+		printf("bleTxIsIdle() returned true with bytes queued\n");
+		reportFailure();
+	}
+	else
+	{
+		reportSuccess();
+	}
+}
+
+int main(void)
+{
+	unsigned int num_links;
+	unsigned int i;
+	uint32_t fixed_delay_us;
+	uint32_t credits_us;
+	uint32_t host_paced_us;
+
+	initTests(__FILE__);
+
+	testCreditCap();
+
+	num_links = sizeof(sim_links) / sizeof(struct SimLink);
+	for (i = 0; i < num_links; i++)
+	{
+		fixed_delay_us = simulateFixedDelay(&(sim_links[i]));
+		checkSimulation("Fixed delay");
+		credits_us = simulateCredits(&(sim_links[i]));
+		checkSimulation("Credits");
+		host_paced_us = simulateHostPaced(&(sim_links[i]));
+		checkSimulation("Host paced");
+		printf("%s: fixed delay %.0f bytes/s, credits %.0f bytes/s, host paced %.0f bytes/s\n",
+			sim_links[i].name,
+			(double)SIM_RESPONSE_LENGTH * 1e6 / fixed_delay_us,
+			(double)SIM_RESPONSE_LENGTH * 1e6 / credits_us,
+			(double)SIM_RESPONSE_LENGTH * 1e6 / host_paced_us);
+		if (credits_us >= fixed_delay_us)
+		{
+			printf("Credits weren't faster than fixed delay\n");
+			reportFailure();
+		}
+		else
+		{
+			reportSuccess();
+		}
+		if (host_paced_us >= credits_us)
+		{
+			printf("Host pacing wasn't faster than credits\n");
+			reportFailure();
+		}
+		else
+		{
+			reportSuccess();
+		}
+	}
+
+	finishTests();
+	exit(0);
+}
+
+#endif // #ifdef TEST_BLE_TX
@@ -0,0 +1,64 @@
+/** \file ble_tx.h
+  *
+  * \brief Describes functions exported by ble_tx.c.
+  *
+  * This file is licensed as described by the file LICENCE.
+  */
+
+#ifndef ARM_BLE_TX_H_INCLUDED
+#define ARM_BLE_TX_H_INCLUDED
+
+#include "../common.h"
+
+#ifdef __cplusplus
+     extern "C" {
+#endif
+
+/** Period, in microseconds, of the tick which calls bleTxTick(). */
+#define BLE_TX_TICK_US				10000
+/** Number of bytes the BLE module is assumed to be able to forward over the
+  * air per tick, when the host doesn't acknowledge what it receives (see
+  * bleTxSetHostPaced()). The default (8 bytes every 10 ms, or 800 bytes/s)
+  * is the rate of the old fixed-delay scheme (80 bytes, then a 100 ms
+  * pause), which is the only rate which has been shown to work on real
+  * hardware. Don't raise it without measuring the module. */
+#define BLE_TX_CREDITS_PER_TICK		8
+/** Maximum number of bytes which can be handed to the BLE module in one
+  * burst. This is the burst size which the old fixed-delay scheme (80 bytes,
+  * then a 100 ms pause) showed the module can absorb. */
+#define BLE_TX_MAX_CREDITS			80
+
+/** Largest acknowledgement window (see PROTOCOL.txt) which is used when
+  * sending to the BLE module. No more than this many bytes can be inside the
+  * module at once, so this is the same as #BLE_TX_MAX_CREDITS. */
+#define BLE_TX_MAX_WINDOW			BLE_TX_MAX_CREDITS
+/** Maximum time, in milliseconds, to wait for the transmit queue to drain.
+  * A full queue plus a full burst takes about 740 ms at the default rate. */
+#define BLE_TX_FLUSH_TIMEOUT_MS		2000
+
+/** Size of the transmit queue, in number of bytes.
+  * \warning This must be a power of 2.
+  */
+#define BLE_TX_BUFFER_SIZE			512
+
+/** Returns true if the link to the BLE module (i.e. the UART) can accept
+  * another byte right now. This must be implemented by the platform, and
+  * must be safe to call from interrupt context. */
+extern bool bleLinkReady(void);
+/** Hand one byte to the link to the BLE module. This will only be called
+  * after bleLinkReady() returned true. This must be implemented by the
+  * platform, and must be safe to call from interrupt context. */
+extern void bleLinkWrite(uint8_t data);
+
+extern void bleTxInit(void);
+extern void bleTxPut(uint8_t data);
+extern void bleTxTick(void);
+extern void bleTxSetHostPaced(bool is_host_paced);
+extern uint32_t bleTxQueued(void);
+extern bool bleTxIsIdle(void);
+
+#ifdef __cplusplus
+     }
+#endif
+
+#endif // #ifndef ARM_BLE_TX_H_INCLUDED
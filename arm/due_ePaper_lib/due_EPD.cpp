@@ -467,6 +467,17 @@ void EPD_Class::frame_sram(const uint8_t *image, EPD_stage stage)
 		this->line(line, &image[line * this->bytes_per_line], 0, false, stage);
 	}
 }
+
+void EPD_Class::lines_sram(const uint8_t *image, const uint8_t *dirty_lines, EPD_stage stage)
+{
+	for (uint8_t line = 0; line < this->lines_per_display ; ++line) 
+    {
+		if (dirty_lines[line >> 3] & (1 << (line & 7)))
+		{
+			this->line(line, &image[line * this->bytes_per_line], 0, false, stage);
+		}
+	}
+}
 #endif
 
 
@@ -482,11 +493,13 @@ void EPD_Class::frame_cb(uint32_t address, EPD_reader *reader, EPD_stage stage)
 void EPD_Class::frame_fixed_repeat(uint8_t fixed_value, EPD_stage stage) 
 {
 	long stage_time = this->factored_stage_time;
+	uint16_t passes = 0;
 	
 	do {
 		
 		unsigned long t_start = millis();
 		this->frame_fixed(fixed_value, stage);
+		++passes;
 		unsigned long t_end = millis();
 		if (t_end > t_start) {
 			stage_time -= t_end - t_start;
@@ -494,6 +507,7 @@ void EPD_Class::frame_fixed_repeat(uint8_t fixed_value, EPD_stage stage)
 			stage_time -= t_start - t_end + 1 + ULONG_MAX;
 		}
 	} while (stage_time > 0);
+	this->passes_per_stage = passes;
 }
 
 
@@ -503,10 +517,12 @@ void EPD_Class::frame_data_repeat(PROGMEM const uint8_t *image, EPD_stage stage)
 	long stage_time = this->factored_stage_time;
 
 #if 1 
+	uint16_t passes = 0;
 
 	do {
 		unsigned long t_start = millis();
 		this->frame_data(image, stage);
+		++passes;
 		unsigned long t_end = millis();
 		if (t_end > t_start) {
 			stage_time -= t_end - t_start;
@@ -514,6 +530,7 @@ void EPD_Class::frame_data_repeat(PROGMEM const uint8_t *image, EPD_stage stage)
 			stage_time -= t_start - t_end + 1 + ULONG_MAX;
 		}
 	} while (stage_time > 0);
+	this->passes_per_stage = passes;
 #else
 
     for(int i=0; i<7; i++)
@@ -551,9 +568,11 @@ void EPD_Class::frame_sram_repeat(const uint8_t *image, EPD_stage stage)
 
 #if 1 
 	long stage_time = this->factored_stage_time;
+	uint16_t passes = 0;
 	do {
 		unsigned long t_start = millis();
 		this->frame_sram(image, stage);
+		++passes;
 		unsigned long t_end = millis();
 		if (t_end > t_start) {
 			stage_time -= t_end - t_start;
@@ -561,10 +580,29 @@ void EPD_Class::frame_sram_repeat(const uint8_t *image, EPD_stage stage)
 			stage_time -= t_start - t_end + 1 + ULONG_MAX;
 		}
 	} while (stage_time > 0);
+	this->passes_per_stage = passes;
 #else
     for(int i=0; i<7; i++)this->frame_sram(image, stage);
 #endif
 }
+
+// Partial update: each dirty line gets the same number of passes it would
+// get from frame_sram_repeat(), so the result looks the same, but the time
+// taken is proportional to the number of dirty lines rather than the height
+// of the panel. Clean lines are never scanned, so they are left untouched.
+void EPD_Class::lines_sram_repeat(const uint8_t *image, const uint8_t *dirty_lines, EPD_stage stage) 
+{
+	uint16_t passes = this->passes_per_stage;
+
+	if (0 == passes) {
+		// no full update has been timed yet; this is what a 2" panel
+		// manages at room temperature
+		passes = 4;
+	}
+	for (uint16_t i = 0; i < passes; ++i) {
+		this->lines_sram(image, dirty_lines, stage);
+	}
+}
 #endif
 
 
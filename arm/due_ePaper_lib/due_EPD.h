@@ -29,6 +29,13 @@
 #define EPD_ENABLE_EXTRA_SRAM 1
 #endif
 
+// size of the panel the SRAM image buffers (eSD.sram_image and
+// ePaper::panel_image) are allocated for; this is the 2.0" panel, which is
+// the one eink.cpp drives
+#define EPD_IMAGE_LINES         96
+#define EPD_IMAGE_LINE_BYTES    (200 / 8)
+#define EPD_IMAGE_BYTES         (EPD_IMAGE_LINES * EPD_IMAGE_LINE_BYTES)
+
 typedef enum {
     EPD_1_44,        // 128 x 96
     EPD_2_0,         // 200 x 96
@@ -60,6 +67,10 @@ class EPD_Class
     uint16_t stage_time;
 
     uint16_t factored_stage_time;
+    // number of whole frames the last frame_*_repeat() managed to send
+    // within factored_stage_time; partial updates drive each line this
+    // many times so they reach the same contrast as a full update
+    uint16_t passes_per_stage;
     uint16_t lines_per_display;
     uint16_t dots_per_line;
     uint16_t bytes_per_line;
@@ -146,6 +157,17 @@ class EPD_Class
 //        this->frame_sram_repeat(new_image, EPD_normal);
         this->frame_sram_repeat(new_image, EPD_normal);
     }
+
+    // change from old image to new image, but only drive the lines whose
+    // bit is set in dirty_lines (bit (line & 7) of dirty_lines[line >> 3]);
+    // every other line is left alone (SRAM version)
+    void image_sram_partial(const uint8_t *old_image, const uint8_t *new_image, const uint8_t *dirty_lines)
+    {
+        this->lines_sram_repeat(old_image, dirty_lines, EPD_compensate);
+        this->lines_sram_repeat(old_image, dirty_lines, EPD_white);
+        this->lines_sram_repeat(new_image, dirty_lines, EPD_inverse);
+        this->lines_sram_repeat(new_image, dirty_lines, EPD_normal);
+    }
 #endif
 
     // Low level API calls
@@ -160,6 +182,7 @@ class EPD_Class
 
 #if defined(EPD_ENABLE_EXTRA_SRAM)
     void frame_sram(const uint8_t *new_image, EPD_stage stage);
+    void lines_sram(const uint8_t *new_image, const uint8_t *dirty_lines, EPD_stage stage);
 #endif
     void frame_cb(uint32_t address, EPD_reader *reader, EPD_stage stage);
 
@@ -172,6 +195,7 @@ class EPD_Class
 
 #if defined(EPD_ENABLE_EXTRA_SRAM)
     void frame_sram_repeat(const uint8_t *new_image, EPD_stage stage);
+    void lines_sram_repeat(const uint8_t *new_image, const uint8_t *dirty_lines, EPD_stage stage);
 #endif
     void frame_cb_repeat(uint32_t address, EPD_reader *reader, EPD_stage stage);
 
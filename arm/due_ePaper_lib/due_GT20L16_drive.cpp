@@ -56,14 +56,30 @@ int GT20L16_drive::getMatrixUnicode(unsigned int uniCode, unsigned char *matrix)
 {
 
     if(matrix == NULL)return 0;
-    
-    
+
+    // Text is drawn one character at a time and the same few dozen glyphs
+    // come up over and over again, so look in the cache before going to
+    // the font ROM.
+    int victim = 0;
+    for(int n=0; n<GT_CACHE_ENTRIES; n++)
+    {
+        if(cache[n].dtaLen != 0 && cache[n].uniCode == uniCode)
+        {
+            cache[n].lastUsed = ++cacheClock;
+            cacheHits++;
+            memcpy(matrix, cache[n].matrix, cache[n].dtaLen);
+            return cache[n].dtaLen;
+        }
+        if(cache[n].lastUsed < cache[victim].lastUsed)
+        {
+            victim = n;                             // least recently used (unused entries are 0)
+        }
+    }
+    cacheMisses++;
     
     EPAPER.init_io();
     begin();
 
-    unsigned char i;
-    unsigned char tempdata;
     unsigned long Add=0;
     
     unsigned char dtaLen = 0;
@@ -81,25 +97,12 @@ int GT20L16_drive::getMatrixUnicode(unsigned int uniCode, unsigned char *matrix)
     
     Add=getAddrFromUnicode(uniCode);
 
-    delayMicroseconds(10);
-    
-    
-    GT_Select();
-    SPI.transfer(0x03);
-    SPI.transfer(Add>>16);
-    SPI.transfer(Add>>8);
-    SPI.transfer(Add);
+    GTReadBurst(Add, matrix, dtaLen);               /*save dot matrix data in matrixdata[i]*/
 
-    SPI.setBitOrder(LSBFIRST);
-
-    for(i=0;i<dtaLen;i++)
-    {
-        tempdata=SPI.transfer(0x00);
-        matrix[i]=(tempdata);                       /*save dot matrix data in matrixdata[i]*/
-        delay(5);
-    }
-    SPI.setBitOrder(MSBFIRST);
-    GT_UnSelect();
+    cache[victim].uniCode = uniCode;
+    cache[victim].dtaLen = dtaLen;
+    cache[victim].lastUsed = ++cacheClock;
+    memcpy(cache[victim].matrix, matrix, dtaLen);
     
     return dtaLen;
 }
@@ -229,6 +232,31 @@ unsigned long GT20L16_drive::GTRead(unsigned long Address)
     return data;
 }
 
+/*********************************************************************************************************
+** Function name:           GTReadBurst
+** Descriptions:            read len bytes starting at Address, as one SPI transaction
+*********************************************************************************************************/
+void GT20L16_drive::GTReadBurst(unsigned long Address, unsigned char *buffer, int len)
+{
+    delayMicroseconds(10);
+    GT_Select();
+    SPI.transfer(0x03);
+    SPI.transfer(Address>>16);
+    SPI.transfer(Address>>8);
+    SPI.transfer(Address);
+    // The command and address go out MSB first; only the dot matrix data
+    // is read LSB first.
+    SPI.setBitOrder(LSBFIRST);
+    // The font ROM auto-increments the address for as long as chip select
+    // stays low, so there's no need to pause between bytes.
+    for(int i=0; i<len; i++)
+    {
+        buffer[i]=SPI.transfer(0x00);
+    }
+    SPI.setBitOrder(MSBFIRST);
+    GT_UnSelect();
+}
+
 GT20L16_drive GT20L16;
 
 /*********************************************************************************************************
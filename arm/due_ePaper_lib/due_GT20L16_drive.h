@@ -32,6 +32,9 @@
 #define PIN_GT20L16_CS      41
 #endif
 
+#define GT_CACHE_ENTRIES    32              // number of glyphs kept in RAM
+#define GT_MAX_GLYPH_LEN    32              // bytes in the largest (16x16) glyph
+
 
 
 class GT20L16_drive{
@@ -40,12 +43,28 @@ private:
 
     int pinCS;
 
+    // LRU cache of glyphs read from the font ROM; a glyph only depends on
+    // its code point (which also decides whether it is 16 or 32 bytes
+    // long), so that is the key
+    struct GlyphCacheEntry
+    {
+        unsigned int uniCode;
+        unsigned char dtaLen;               // 0 means the entry is unused
+        unsigned long lastUsed;
+        unsigned char matrix[GT_MAX_GLYPH_LEN];
+    };
+    GlyphCacheEntry cache[GT_CACHE_ENTRIES];
+    unsigned long cacheClock;
+    unsigned long cacheHits;
+    unsigned long cacheMisses;
+
 private:
 
     void GT_Select();
     void GT_UnSelect();
     unsigned long getAddrFromUnicode(unsigned int uniCode);
     unsigned long GTRead(unsigned long Address);
+    void GTReadBurst(unsigned long Address, unsigned char *buffer, int len);
 public:
 
     void begin(int pinSelect);
@@ -54,6 +73,11 @@ public:
 
     int getMatrixUnicode(unsigned int uniCode, unsigned char *matrix);
 
+    // glyph cache statistics, for sizing GT_CACHE_ENTRIES
+    unsigned long getCacheHits(){return cacheHits;}
+    unsigned long getCacheMisses(){return cacheMisses;}
+    void resetCacheStats(){cacheHits = 0; cacheMisses = 0;}
+
 
 };
 
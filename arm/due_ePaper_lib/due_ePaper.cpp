@@ -797,13 +797,57 @@ void ePaper::fillRectangle(int poX, int poY, int len, int width)
 *********************************************************************************************************/
 unsigned char ePaper::display()
 {
-    start();
 #if defined(__AVR_ATmega32U4__) || defined(__AVR_ATmega328P__)
+    start();
     EPD.image_sd();
+    end();
 #elif defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__)|| defined(__SAM3X8E__)|| defined(__SAM3A8C__)
-    EPD.image_sram(eSD.sram_image);
+    // Work out which lines differ from what is on the panel. A full update
+    // redraws every line for 4 stages, which takes seconds; a status line
+    // or progress counter only touches a small band of the screen.
+    unsigned char dirty_lines[(EPD_IMAGE_LINES + 7) / 8];
+    int line_bytes = SIZE_LEN / 8;
+    int lines = SIZE_WIDTH;
+    int dirty_count = 0;
+
+    memset(dirty_lines, 0, sizeof(dirty_lines));
+    if ((lines > EPD_IMAGE_LINES) || ((lines * line_bytes) > (int)sizeof(panel_image)))
+    {
+        // panel is bigger than the buffers; dirty lines can't be tracked
+        panel_image_valid = false;
+    }
+    if (panel_image_valid)
+    {
+        for (int line = 0; line < lines; line++)
+        {
+            if (memcmp(&panel_image[line * line_bytes], &eSD.sram_image[line * line_bytes], line_bytes) != 0)
+            {
+                dirty_lines[line >> 3] |= (1 << (line & 7));
+                dirty_count++;
+            }
+        }
+        if (dirty_count == 0)
+        {
+            return 0;                       // nothing changed
+        }
+    }
+
+    start();
+    if (!panel_image_valid || (partial_updates >= EP_MAX_PARTIAL_UPDATES) || ((dirty_count * 2) > lines))
+    {
+        EPD.image_sram(eSD.sram_image);
+        end();
+        setPanelImage(eSD.sram_image);
+    }
+    else
+    {
+        EPD.image_sram_partial(panel_image, eSD.sram_image, dirty_lines);
+        end();
+        memcpy(panel_image, eSD.sram_image, sizeof(panel_image));
+        partial_updates++;
+    }
 #endif
-    end();
+    return 1;
 }
 
 ePaper EPAPER;
@@ -26,6 +26,7 @@
 
 #include <SD.h>
 #include <SPI.h>
+#include <string.h>
 
 #include "due_EPD.h"
 #include "due_sd_epaper.h"
@@ -33,6 +34,10 @@
 
 #define EP_DEBUG            1
 
+// partial updates leave a little ghosting behind, so after this many in a
+// row display() does a full update instead
+#define EP_MAX_PARTIAL_UPDATES  8
+
 #if EP_DEBUG
 #define print_ep(X)         Serial.print(X)
 #define println_ep(X)       Serial.println(X)
@@ -88,6 +93,21 @@ private:
     int DISP_WIDTH;
     
     EPD_DIR direction;
+
+#if defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__)|| defined(__SAM3X8E__)|| defined(__SAM3A8C__)
+    // what is currently shown on the panel, in the same layout as
+    // eSD.sram_image; display() compares against this to find dirty lines
+    unsigned char panel_image[EPD_IMAGE_BYTES];
+    bool panel_image_valid;
+    unsigned char partial_updates;
+
+    void setPanelImage(const unsigned char *image)
+    {
+        memcpy(panel_image, image, sizeof(panel_image));
+        panel_image_valid = true;
+        partial_updates = 0;
+    }
+#endif
     
 public:
 
@@ -103,13 +123,16 @@ public:
     
     void init_io();
     
-    unsigned char display();                // refresh 
+    unsigned char display();                // refresh, only the lines which changed if possible
     
     void image_flash(PROGMEM const unsigned char *image)           // read image from flash
     {
         start();
         EPD.image(image);
         end();
+#if defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__)|| defined(__SAM3X8E__)|| defined(__SAM3A8C__)
+        setPanelImage(image);
+#endif
     } 
  
     void clear()                             // clear display
@@ -117,6 +140,11 @@ public:
         start();
         EPD.clear();
         end();
+#if defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__)|| defined(__SAM3X8E__)|| defined(__SAM3A8C__)
+        memset(panel_image, 0x00, sizeof(panel_image));
+        panel_image_valid = true;
+        partial_updates = 0;
+#endif
     } 
     
     void clear_sd();                         // clear sd card 
@@ -253,7 +253,7 @@ unsigned char sd_epaper::clear()
     }
 
 #elif defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__)|| defined(__SAM3X8E__)|| defined(__SAM3A8C__)
-    memset(sram_image, 0x00, 2400);
+    memset(sram_image, 0x00, sizeof(sram_image));
 #endif
 
 }
@@ -69,7 +69,7 @@ private:
 
 public:
 #if defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__)|| defined(__SAM3X8E__)|| defined(__SAM3A8C__)
-    uint8_t sram_image[2400];    // 264*176/8 WRONG! 200*96/8 is the 2" screen
+    uint8_t sram_image[EPD_IMAGE_BYTES];
 #elif defined(__AVR_ATmega32U4__) || defined(__AVR_ATmega328P__)
     unsigned char lineDta[33];
 #endif
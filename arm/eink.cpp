@@ -684,6 +684,29 @@ void display(void)
     EPAPER.display();
 }
 
+// minimum time between two progress updates, in milliseconds
+#define PROGRESS_INTERVAL_MS    2000
+
+static unsigned long last_progress_ms;
+
+// Returns true if a progress indicator (like "3 / 20") should be redrawn
+// now. Even a partial refresh takes a noticeable fraction of a second, so
+// long-running loops only redraw every PROGRESS_INTERVAL_MS rather than on
+// every iteration. Pass first = true at the start of an operation and
+// last = true for its final step to make sure both are always shown, so
+// the screen never stops short of "N / N".
+bool displayProgressDue(bool first, bool last)
+{
+    unsigned long now = millis();
+
+    if (first || last || ((now - last_progress_ms) >= PROGRESS_INTERVAL_MS))
+    {
+        last_progress_ms = now;
+        return true;
+    }
+    return false;
+}
+
 void writeBlankScreen(void)
 {
     EPAPER.begin(EPD_SIZE);                             // setup epaper, size
@@ -98,6 +98,7 @@
      void drawCheckX(void);
      void initDisplay(void);
      void display(void);
+     bool displayProgressDue(bool first, bool last);
      void writeUnderline(int x0, int y0, int x1, int y1);
      void drawCAPSLOCK(int x, int y);
 
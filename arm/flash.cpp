@@ -22,14 +22,21 @@
 
 //#include "flash.h"
 
+#include <string.h>
 #include "../common.h"
 #include "../hwinterface.h"
+#ifdef TEST_FLASH
+#include <stdio.h>
+#include <stdlib.h>
+extern "C" {
+#include "../test_helpers.h"
+}
+#else
 #include "DueFlashStorage_lib/DueFlashStorage.h"
+#endif // #ifdef TEST_FLASH
 
 //#include "eink.h"
 
-DueFlashStorage dueFlashStorage;
-
 struct Configuration {
   uint8_t b;
 };
@@ -37,6 +44,254 @@ struct Configuration {
 /** Size of EEPROM, in number of bytes. */
 //moved to hwinterface.h
 
+/** Size of one page of the embedded flash controller (EFC), in number of
+  * bytes. This is also the granularity of the erase-and-write command, so
+  * the flash is always programmed one whole page at a time. */
+#define FLASH_PAGE_SIZE			256
+
+/** Number of pages which can be held in the write-back cache. When all
+  * slots are in use, the least recently written page is programmed to make
+  * room. */
+#define FLASH_CACHE_PAGES		4
+
+#if (EEPROM_SIZE % FLASH_PAGE_SIZE) != 0
+#error "EEPROM_SIZE must be a multiple of FLASH_PAGE_SIZE"
+#endif
+
+/** Contents of cached pages. These are the contents that the pages will have
+  * once they are programmed. */
+static uint32_t page_cache[FLASH_CACHE_PAGES][FLASH_PAGE_SIZE / sizeof(uint32_t)];
+/** Page number (relative to the start of non-volatile storage) of each slot
+  * in #page_cache. */
+static uint32_t page_cache_number[FLASH_CACHE_PAGES];
+/** Whether each slot in #page_cache holds a page which still needs to be
+  * programmed. */
+static bool page_cache_dirty[FLASH_CACHE_PAGES];
+/** Value of #page_cache_clock when each slot in #page_cache was last
+  * written to. Used to pick the least recently written page for eviction. */
+static uint32_t page_cache_last_write[FLASH_CACHE_PAGES];
+/** Incremented on every cached write. */
+static uint32_t page_cache_clock;
+
+#ifdef TEST_FLASH
+
+/** Simulated contents of the flash. Erased flash reads as all 1s. */
+static uint8_t simulated_flash[EEPROM_SIZE];
+/** Number of page programming commands issued to the simulated EFC. */
+static uint32_t page_program_count;
+/** Number of those page programming commands which didn't erase first. */
+static uint32_t page_program_no_erase_count;
+/** Number of times the simulated flash was unlocked. */
+static uint32_t unlock_count;
+/** Whether the simulated flash is currently unlocked. */
+static bool is_unlocked;
+
+/** Get a pointer to where non-volatile storage is memory-mapped.
+  * \param address Byte offset into non-volatile storage.
+  * \return Pointer to the byte at that offset.
+  */
+static uint8_t *flashAddress(uint32_t address)
+{
+	return &(simulated_flash[address]);
+}
+
+/** Unlock the flash region used for non-volatile storage, in preparation
+  * for programming.
+  * \return See #NonVolatileReturnEnum for return values.
+  */
+static NonVolatileReturn flashUnlock(void)
+{
+	unlock_count++;
+	is_unlocked = true;
+	return NV_NO_ERROR;
+}
+
+/** Lock the flash region used for non-volatile storage.
+  * \return See #NonVolatileReturnEnum for return values.
+  */
+static NonVolatileReturn flashLock(void)
+{
+	is_unlocked = false;
+	return NV_NO_ERROR;
+}
+
+/** Program one page. The region must have been unlocked using
+  * flashUnlock().
+  * \param page Page number, relative to the start of non-volatile storage.
+  * \param buffer The new contents of the page (#FLASH_PAGE_SIZE bytes).
+  * \param erase If true, the page is erased before programming. If false,
+  *              programming can only clear bits, so the page ends up as the
+  *              bitwise AND of its old contents and buffer.
+  * \return See #NonVolatileReturnEnum for return values.
+  */
+static NonVolatileReturn flashProgramPage(uint32_t page, uint32_t *buffer, bool erase)
+{
+	uint32_t i;
+	uint8_t *p;
+
+	if (!is_unlocked)
+	{
+		return NV_IO_ERROR;
+	}
+	p = &(simulated_flash[page * FLASH_PAGE_SIZE]);
+	if (erase)
+	{
+		memcpy(p, buffer, FLASH_PAGE_SIZE);
+	}
+	else
+	{
+		for (i = 0; i < FLASH_PAGE_SIZE; i++)
+		{
+			p[i] &= ((uint8_t *)buffer)[i];
+		}
+		page_program_no_erase_count++;
+	}
+	page_program_count++;
+	return NV_NO_ERROR;
+}
+
+#else
+
+/** Get a pointer to where non-volatile storage is memory-mapped.
+  * \param address Byte offset into non-volatile storage.
+  * \return Pointer to the byte at that offset.
+  */
+static uint8_t *flashAddress(uint32_t address)
+{
+	return FLASH_START + address;
+}
+
+/** Unlock the flash region used for non-volatile storage, in preparation
+  * for programming.
+  * \return See #NonVolatileReturnEnum for return values.
+  */
+static NonVolatileReturn flashUnlock(void)
+{
+	if (flash_unlock((uint32_t)FLASH_START, (uint32_t)FLASH_START + EEPROM_SIZE - 1, 0, 0) != FLASH_RC_OK)
+	{
+		return NV_IO_ERROR;
+	}
+	return NV_NO_ERROR;
+}
+
+/** Lock the flash region used for non-volatile storage.
+  * \return See #NonVolatileReturnEnum for return values.
+  */
+static NonVolatileReturn flashLock(void)
+{
+	if (flash_lock((uint32_t)FLASH_START, (uint32_t)FLASH_START + EEPROM_SIZE - 1, 0, 0) != FLASH_RC_OK)
+	{
+		return NV_IO_ERROR;
+	}
+	return NV_NO_ERROR;
+}
+
+/** Program one page. The region must have been unlocked using
+  * flashUnlock().
+  * \param page Page number, relative to the start of non-volatile storage.
+  * \param buffer The new contents of the page (#FLASH_PAGE_SIZE bytes).
+  * \param erase If true, the page is erased before programming. If false,
+  *              programming can only clear bits, so the page ends up as the
+  *              bitwise AND of its old contents and buffer.
+  * \return See #NonVolatileReturnEnum for return values.
+  */
+static NonVolatileReturn flashProgramPage(uint32_t page, uint32_t *buffer, bool erase)
+{
+	// Since buffer covers the entire page, flash_write() doesn't need to
+	// read anything back from flash; it just issues one erase-and-write page
+	// (EWP) or write page (WP) command.
+	if (flash_write((uint32_t)FLASH_START + page * FLASH_PAGE_SIZE, buffer, FLASH_PAGE_SIZE, erase ? 1 : 0) != FLASH_RC_OK)
+	{
+		return NV_IO_ERROR;
+	}
+	return NV_NO_ERROR;
+}
+
+#endif // #ifdef TEST_FLASH
+
+/** Program the page held in one slot of #page_cache, if it is dirty and
+  * differs from what is already in flash. The flash must have been unlocked
+  * using flashUnlock().
+  * \param slot The slot in #page_cache to write back.
+  * \return See #NonVolatileReturnEnum for return values.
+  */
+static NonVolatileReturn writeBackSlot(uint32_t slot)
+{
+	uint32_t page;
+	NonVolatileReturn r;
+
+	if (!page_cache_dirty[slot])
+	{
+		return NV_NO_ERROR;
+	}
+	page = page_cache_number[slot];
+	r = NV_NO_ERROR;
+	// Skipping unchanged pages avoids wear when, for example, a counter is
+	// rewritten with the value it already has.
+	if (memcmp(flashAddress(page * FLASH_PAGE_SIZE), page_cache[slot], FLASH_PAGE_SIZE))
+	{
+		r = flashProgramPage(page, page_cache[slot], true);
+	}
+	page_cache_dirty[slot] = false;
+	return r;
+}
+
+/** Find the slot in #page_cache which holds a page.
+  * \param page Page number, relative to the start of non-volatile storage.
+  * \return The slot number, or #FLASH_CACHE_PAGES if the page is not cached.
+  */
+static uint32_t findCachedPage(uint32_t page)
+{
+	uint32_t slot;
+
+	for (slot = 0; slot < FLASH_CACHE_PAGES; slot++)
+	{
+		if (page_cache_dirty[slot] && (page_cache_number[slot] == page))
+		{
+			return slot;
+		}
+	}
+	return FLASH_CACHE_PAGES;
+}
+
+/** Get a slot in #page_cache for a page which isn't already cached. If no
+  * slots are free, the least recently written page is programmed (evicted)
+  * to free up its slot.
+  * \param out_slot Will be written with the slot number on success.
+  * \return See #NonVolatileReturnEnum for return values.
+  */
+static NonVolatileReturn allocateSlot(uint32_t *out_slot)
+{
+	uint32_t slot;
+	uint32_t oldest;
+	NonVolatileReturn r;
+
+	oldest = 0;
+	for (slot = 0; slot < FLASH_CACHE_PAGES; slot++)
+	{
+		if (!page_cache_dirty[slot])
+		{
+			*out_slot = slot;
+			return NV_NO_ERROR;
+		}
+		if ((page_cache_clock - page_cache_last_write[slot]) > (page_cache_clock - page_cache_last_write[oldest]))
+		{
+			oldest = slot;
+		}
+	}
+	r = flashUnlock();
+	if (r == NV_NO_ERROR)
+	{
+		r = writeBackSlot(oldest);
+		if (flashLock() != NV_NO_ERROR)
+		{
+			r = NV_IO_ERROR;
+		}
+	}
+	*out_slot = oldest;
+	return r;
+}
+
 /** Write to non-volatile storage.
   * \param data A pointer to the data to be written.
   * \param address Byte offset specifying where in non-volatile storage to
@@ -48,19 +303,52 @@ struct Configuration {
   */
 NonVolatileReturn nonVolatileWrite(uint8_t *data, uint32_t address, uint32_t length)
 {
+	uint32_t page;
+	uint32_t offset;
+	uint32_t chunk;
+	uint32_t slot;
+	NonVolatileReturn r;
+
 	if ((address > EEPROM_SIZE) || (length > EEPROM_SIZE)
 		|| ((address + length) > EEPROM_SIZE))
 	{
 		return NV_INVALID_ADDRESS;
 	}
-//	eeprom_busy_wait();
-	// The (void *)(int) is there because pointers on AVR are 16 bit, so
-	// just doing (void *) would result in a "cast to pointer from integer
-	// of different size" warning.
-//	cli();
-	dueFlashStorage.write(address, data, (size_t)length);
-//	eeprom_write_block(data, (void *)(int)address, (size_t)length);
-//	sei();
+	// Writes are merged into whole-page buffers in RAM. Each page is
+	// programmed once, on eviction or in nonVolatileFlush(), instead of once
+	// per call.
+	while (length > 0)
+	{
+		page = address / FLASH_PAGE_SIZE;
+		offset = address % FLASH_PAGE_SIZE;
+		chunk = FLASH_PAGE_SIZE - offset;
+		if (chunk > length)
+		{
+			chunk = length;
+		}
+		slot = findCachedPage(page);
+		if (slot == FLASH_CACHE_PAGES)
+		{
+			r = allocateSlot(&slot);
+			if (r != NV_NO_ERROR)
+			{
+				return r;
+			}
+			if (chunk != FLASH_PAGE_SIZE)
+			{
+				// Partial page write; preserve the rest of the page.
+				memcpy(page_cache[slot], flashAddress(page * FLASH_PAGE_SIZE), FLASH_PAGE_SIZE);
+			}
+			page_cache_number[slot] = page;
+			page_cache_dirty[slot] = true;
+		}
+		memcpy(&(((uint8_t *)page_cache[slot])[offset]), data, chunk);
+		page_cache_clock++;
+		page_cache_last_write[slot] = page_cache_clock;
+		data += chunk;
+		address += chunk;
+		length -= chunk;
+	}
 	return NV_NO_ERROR;
 }
 
@@ -78,39 +366,541 @@ NonVolatileReturn nonVolatileReadNoPtr(uint8_t data, uint32_t address, uint32_t
 	{
 		return NV_INVALID_ADDRESS;
 	}
-	data = dueFlashStorage.read(address);
+	if (length > 0)
+	{
+		nonVolatileRead(&data, address, 1);
+	}
 
 	return NV_NO_ERROR;
 }
 
 NonVolatileReturn nonVolatileRead(uint8_t *data, uint32_t address, uint32_t length)
 {
+	uint32_t page;
+	uint32_t offset;
+	uint32_t chunk;
+	uint32_t slot;
+
 	if ((address > EEPROM_SIZE) || (length > EEPROM_SIZE)
 		|| ((address + (uint32_t)length) > EEPROM_SIZE))
 	{
 		return NV_INVALID_ADDRESS;
 	}
-//	uint8_t beingRead[length];
-	int i;
-
-	for(i=0; i<length; i++){
-		data[i] = dueFlashStorage.read(address+i);
+	// Flash is memory-mapped, so it can be copied directly, except for pages
+	// which have pending writes in the cache.
+	while (length > 0)
+	{
+		page = address / FLASH_PAGE_SIZE;
+		offset = address % FLASH_PAGE_SIZE;
+		chunk = FLASH_PAGE_SIZE - offset;
+		if (chunk > length)
+		{
+			chunk = length;
+		}
+		slot = findCachedPage(page);
+		if (slot == FLASH_CACHE_PAGES)
+		{
+			memcpy(data, flashAddress(address), chunk);
+		}
+		else
+		{
+			memcpy(data, &(((uint8_t *)page_cache[slot])[offset]), chunk);
+		}
+		data += chunk;
+		address += chunk;
+		length -= chunk;
 	}
 
-//	data = beingRead;
-
-//	writeEink(, false, 10, 10);
-
 	return NV_NO_ERROR;
 }
 
 /** Ensure that all buffered writes are committed to non-volatile storage.
+  * Dirty pages are programmed in address order, with the flash unlocked and
+  * re-locked only once.
   * \return See #NonVolatileReturnEnum for return values.
   */
 NonVolatileReturn nonVolatileFlush(void)
 {
-	// Nothing to do; writes are never buffered.
-	return NV_NO_ERROR;
+	uint32_t slot;
+	uint32_t next_slot;
+	NonVolatileReturn r;
+
+	for (slot = 0; slot < FLASH_CACHE_PAGES; slot++)
+	{
+		if (page_cache_dirty[slot])
+		{
+			break;
+		}
+	}
+	if (slot == FLASH_CACHE_PAGES)
+	{
+		return NV_NO_ERROR; // nothing to do
+	}
+
+	r = flashUnlock();
+	if (r != NV_NO_ERROR)
+	{
+		return r;
+	}
+	do
+	{
+		// Find dirty page with lowest page number.
+		next_slot = FLASH_CACHE_PAGES;
+		for (slot = 0; slot < FLASH_CACHE_PAGES; slot++)
+		{
+			if (page_cache_dirty[slot]
+				&& ((next_slot == FLASH_CACHE_PAGES) || (page_cache_number[slot] < page_cache_number[next_slot])))
+			{
+				next_slot = slot;
+			}
+		}
+		if (next_slot != FLASH_CACHE_PAGES)
+		{
+			if (writeBackSlot(next_slot) != NV_NO_ERROR)
+			{
+				r = NV_IO_ERROR;
+			}
+		}
+	} while (next_slot != FLASH_CACHE_PAGES);
+	if (flashLock() != NV_NO_ERROR)
+	{
+		r = NV_IO_ERROR;
+	}
+	return r;
 }
 
+/** Fill part of one page, through the write-back cache. This is used by
+  * nonVolatileFill() for the partial pages at either end of the area.
+  * \param address Byte offset of the start of the part to fill.
+  * \param length Number of bytes to fill; this must not cross a page
+  *               boundary.
+  * \param value See nonVolatileFill().
+  * \param source See nonVolatileFill().
+  * \param arg See nonVolatileFill().
+  * \return See #NonVolatileReturnEnum for return values.
+  */
+static NonVolatileReturn fillPartialPage(uint32_t address, uint32_t length, uint8_t value, NonVolatileFillSource source, void *arg)
+{
+	uint8_t buffer[FLASH_PAGE_SIZE];
+	NonVolatileReturn r;
+
+	if (source == NULL)
+	{
+		memset(buffer, value, length);
+	}
+	else
+	{
+		source(buffer, length, arg);
+	}
+	r = nonVolatileWrite(buffer, address, length);
+	// source may have supplied random data (e.g. the last pass of a
+	// format), so don't leave it on the stack.
+	memset(buffer, 0, sizeof(buffer));
+	return r;
+}
+
+/** Fill an area of non-volatile storage. Whole pages are programmed
+  * directly, bypassing the write-back cache, with the flash unlocked only
+  * once. If the page contents are all 1s, the erase-and-write page command
+  * alone gives the right result; if they are all 0s, a write page command
+  * without an erase is enough (since programming can only clear bits), which
+  * avoids the erase time. Partial pages at either end of the area go through
+  * the cache, so that the rest of those pages is preserved.
+  * \param address Byte offset specifying where in non-volatile storage to
+  *                start filling.
+  * \param length The number of bytes to fill.
+  * \param value If source is NULL, every byte is set to this value.
+  * \param source If not NULL, this is called to supply the data to fill with.
+  * \param arg Passed to source.
+  * \return See #NonVolatileReturnEnum for return values.
+  */
+NonVolatileReturn nonVolatileFill(uint32_t address, uint32_t length, uint8_t value, NonVolatileFillSource source, void *arg)
+{
+	uint32_t page_buffer[FLASH_PAGE_SIZE / sizeof(uint32_t)];
+	uint32_t chunk;
+	uint32_t page;
+	uint32_t end_page;
+	uint32_t slot;
+	bool erase;
+	NonVolatileReturn r;
+
+	if ((address > EEPROM_SIZE) || (length > EEPROM_SIZE)
+		|| ((address + length) > EEPROM_SIZE))
+	{
+		return NV_INVALID_ADDRESS;
+	}
+
+	// Partial page at the start.
+	if ((address % FLASH_PAGE_SIZE) != 0)
+	{
+		chunk = FLASH_PAGE_SIZE - (address % FLASH_PAGE_SIZE);
+		if (chunk > length)
+		{
+			chunk = length;
+		}
+		r = fillPartialPage(address, chunk, value, source, arg);
+		if (r != NV_NO_ERROR)
+		{
+			return r;
+		}
+		address += chunk;
+		length -= chunk;
+	}
+
+	// Whole pages.
+	page = address / FLASH_PAGE_SIZE;
+	end_page = (address + length) / FLASH_PAGE_SIZE;
+	if (page < end_page)
+	{
+		// Pending writes to these pages are about to be overwritten, so they
+		// must not be written back later.
+		for (slot = 0; slot < FLASH_CACHE_PAGES; slot++)
+		{
+			if (page_cache_dirty[slot] && (page_cache_number[slot] >= page) && (page_cache_number[slot] < end_page))
+			{
+				page_cache_dirty[slot] = false;
+			}
+		}
+		erase = true;
+		if (source == NULL)
+		{
+			memset(page_buffer, value, sizeof(page_buffer));
+			erase = (value != 0x00);
+		}
+		r = flashUnlock();
+		if (r != NV_NO_ERROR)
+		{
+			return r;
+		}
+		for (; page < end_page; page++)
+		{
+			if (source != NULL)
+			{
+				source((uint8_t *)page_buffer, FLASH_PAGE_SIZE, arg);
+			}
+			if (flashProgramPage(page, page_buffer, erase) != NV_NO_ERROR)
+			{
+				r = NV_IO_ERROR;
+				break;
+			}
+		}
+		if (flashLock() != NV_NO_ERROR)
+		{
+			r = NV_IO_ERROR;
+		}
+		memset(page_buffer, 0, sizeof(page_buffer));
+		if (r != NV_NO_ERROR)
+		{
+			return r;
+		}
+		chunk = (end_page * FLASH_PAGE_SIZE) - address;
+		address += chunk;
+		length -= chunk;
+	}
+
+	// Partial page at the end.
+	if (length > 0)
+	{
+		r = fillPartialPage(address, length, value, source, arg);
+		if (r != NV_NO_ERROR)
+		{
+			return r;
+		}
+	}
+	return nonVolatileFlush();
+}
+
+#ifdef TEST_FLASH
+
+/** What the contents of non-volatile storage should be, according to the
+  * writes which have been done so far. */
+static uint8_t reference_contents[EEPROM_SIZE];
+
+/** Check that non-volatile storage (as seen by nonVolatileRead()) matches
+  * #reference_contents.
+  * \param address Byte offset to start checking at.
+  * \param length Number of bytes to check.
+  */
+static void checkRead(uint32_t address, uint32_t length)
+{
+	uint8_t buffer[EEPROM_SIZE];
+
+	if (nonVolatileRead(buffer, address, length) != NV_NO_ERROR)
+	{
+		printf("nonVolatileRead() failed, address = %u, length = %u\n", address, length);
+		reportFailure();
+	}
+	else if (memcmp(buffer, &(reference_contents[address]), length))
+	{
+		printf("Read mismatch, address = %u, length = %u\n", address, length);
+		reportFailure();
+	}
+	else
+	{
+		reportSuccess();
+	}
+}
+
+/** Flush, then check that the simulated flash matches #reference_contents
+  * and that the expected number of pages were programmed.
+  * \param expected_programs Number of pages that the flush (and any evictions
+  *                          since the last call) should have programmed.
+  *                          Use -1 to skip this check.
+  */
+static void flushAndCheck(int expected_programs)
+{
+	if (nonVolatileFlush() != NV_NO_ERROR)
+	{
+		printf("nonVolatileFlush() failed\n");
+		reportFailure();
+	}
+	else if (memcmp(simulated_flash, reference_contents, EEPROM_SIZE))
+	{
+		printf("Flash contents don't match after flush\n");
+		reportFailure();
+	}
+	else if ((expected_programs >= 0) && (page_program_count != (uint32_t)expected_programs))
+	{
+		printf("Expected %d page programs, got %u\n", expected_programs, page_program_count);
+		reportFailure();
+	}
+	else
+	{
+		reportSuccess();
+	}
+	page_program_count = 0;
+}
+
+/** Write to non-volatile storage and #reference_contents.
+  * \param data The data to write.
+  * \param address Byte offset to start writing at.
+  * \param length Number of bytes to write.
+  */
+static void writeBoth(uint8_t *data, uint32_t address, uint32_t length)
+{
+	if (nonVolatileWrite(data, address, length) != NV_NO_ERROR)
+	{
+		printf("nonVolatileWrite() failed, address = %u, length = %u\n", address, length);
+		reportFailure();
+	}
+	else
+	{
+		reportSuccess();
+	}
+	memcpy(&(reference_contents[address]), data, length);
+}
+
+/** Source for nonVolatileFill() which writes an incrementing byte sequence.
+  * \param buffer See #NonVolatileFillSource.
+  * \param length See #NonVolatileFillSource.
+  * \param arg Pointer to a uint8_t, the next byte of the sequence.
+  */
+static void testFillSource(uint8_t *buffer, uint32_t length, void *arg)
+{
+	uint32_t i;
+
+	for (i = 0; i < length; i++)
+	{
+		buffer[i] = *(uint8_t *)arg;
+		(*(uint8_t *)arg)++;
+	}
+}
+
+/** Fill non-volatile storage using nonVolatileFill() and do the
+  * equivalent to #reference_contents.
+  * \param address Byte offset to start filling at.
+  * \param length Number of bytes to fill.
+  * \param value See nonVolatileFill().
+  * \param use_source If true, fill with the sequence which testFillSource()
+  *                   generates, starting at value.
+  */
+static void fillBoth(uint32_t address, uint32_t length, uint8_t value, bool use_source)
+{
+	uint8_t next;
+	NonVolatileReturn r;
+
+	next = value;
+	if (use_source)
+	{
+		r = nonVolatileFill(address, length, 0, testFillSource, &next);
+	}
+	else
+	{
+		r = nonVolatileFill(address, length, value, NULL, NULL);
+	}
+	if (r != NV_NO_ERROR)
+	{
+		printf("nonVolatileFill() failed, address = %u, length = %u\n", address, length);
+		reportFailure();
+	}
+	else
+	{
+		reportSuccess();
+	}
+	next = value;
+	if (use_source)
+	{
+		testFillSource(&(reference_contents[address]), length, &next);
+	}
+	else
+	{
+		memset(&(reference_contents[address]), value, length);
+	}
+}
+
+int main(void)
+{
+	uint8_t buffer[1024];
+	uint32_t address;
+	uint32_t length;
+	uint32_t i;
+	uint32_t j;
+
+	initTests(__FILE__);
+
+	memset(simulated_flash, 0xff, sizeof(simulated_flash));
+	memset(reference_contents, 0xff, sizeof(reference_contents));
+
+	// Out of range writes and reads.
+	if ((nonVolatileWrite(buffer, EEPROM_SIZE - 1, 2) == NV_INVALID_ADDRESS)
+		&& (nonVolatileWrite(buffer, 0xffffffff, 2) == NV_INVALID_ADDRESS)
+		&& (nonVolatileRead(buffer, EEPROM_SIZE, 1) == NV_INVALID_ADDRESS)
+		&& (nonVolatileWrite(buffer, EEPROM_SIZE, 0) == NV_NO_ERROR))
+	{
+		reportSuccess();
+	}
+	else
+	{
+		printf("Out of range access not handled correctly\n");
+		reportFailure();
+	}
+	flushAndCheck(0);
+
+	// Many 1 byte writes to the same page should be merged into a single
+	// program, with a single unlock.
+	unlock_count = 0;
+	for (i = 0; i < FLASH_PAGE_SIZE; i++)
+	{
+		buffer[0] = (uint8_t)(i ^ 0x5a);
+		writeBoth(buffer, FLASH_PAGE_SIZE * 3 + i, 1);
+	}
+	checkRead(0, EEPROM_SIZE);
+	flushAndCheck(1);
+	if (unlock_count != 1)
+	{
+		printf("Expected 1 unlock, got %u\n", unlock_count);
+		reportFailure();
+	}
+	else
+	{
+		reportSuccess();
+	}
+
+	// Rewriting what's already there shouldn't program anything.
+	writeBoth(&(reference_contents[100]), 100, 200);
+	flushAndCheck(0);
+
+	// Flushing with nothing buffered shouldn't program anything.
+	flushAndCheck(0);
+
+	// Sequential 32 byte writes (like sanitiseNonVolatileStorage() does)
+	// should program every page exactly once.
+	for (i = 0; i < 2; i++)
+	{
+		for (address = 0; address < EEPROM_SIZE; address += 32)
+		{
+			memset(buffer, (int)(i + address / 32), 32);
+			writeBoth(buffer, address, 32);
+		}
+		flushAndCheck(EEPROM_SIZE / FLASH_PAGE_SIZE);
+	}
+
+	// A write spanning a page boundary should touch exactly two pages.
+	memset(buffer, 0xa5, 16);
+	writeBoth(buffer, FLASH_PAGE_SIZE * 5 - 8, 16);
+	flushAndCheck(2);
+
+	// Filling: partial pages at either end go through the cache, whole
+	// pages are programmed directly, and zeros don't need an erase. A
+	// pending write inside the area must not reappear later, and one outside
+	// it must be kept.
+	if (nonVolatileFill(EEPROM_SIZE - 1, 2, 0, NULL, NULL) != NV_INVALID_ADDRESS)
+	{
+		printf("Out of range fill not handled correctly\n");
+		reportFailure();
+	}
+	else
+	{
+		reportSuccess();
+	}
+	memset(buffer, 0x3c, 20);
+	writeBoth(buffer, FLASH_PAGE_SIZE * 2 + 10, 20);
+	writeBoth(buffer, FLASH_PAGE_SIZE * 10 + 5, 4);
+	page_program_no_erase_count = 0;
+	fillBoth(FLASH_PAGE_SIZE + 100, FLASH_PAGE_SIZE * 5, 0x00, false);
+	checkRead(0, EEPROM_SIZE);
+	flushAndCheck(7); // 4 whole pages, 2 partial pages, 1 pending write
+	if (page_program_no_erase_count != 4)
+	{
+		printf("Expected 4 programs without erase, got %u\n", page_program_no_erase_count);
+		reportFailure();
+	}
+	else
+	{
+		reportSuccess();
+	}
+
+	// Every pass of a format covers the whole area with one program per page.
+	fillBoth(0, EEPROM_SIZE, 0x00, false);
+	flushAndCheck(EEPROM_SIZE / FLASH_PAGE_SIZE);
+	fillBoth(0, EEPROM_SIZE, 0xff, false);
+	flushAndCheck(EEPROM_SIZE / FLASH_PAGE_SIZE);
+	fillBoth(0, EEPROM_SIZE, 0x17, true);
+	flushAndCheck(EEPROM_SIZE / FLASH_PAGE_SIZE);
+
+	// Fills which don't contain a whole page.
+	fillBoth(FLASH_PAGE_SIZE * 4 + 3, 50, 0x99, true);
+	fillBoth(FLASH_PAGE_SIZE * 7 - 30, 60, 0x00, false);
+	checkRead(0, EEPROM_SIZE);
+	flushAndCheck(3);
+
+	// Random writes, reads and flushes, compared against a reference. This
+	// exercises eviction and reading back of cached pages.
+	srand(42);
+	for (i = 0; i < 20000; i++)
+	{
+		length = (uint32_t)rand() % sizeof(buffer);
+		if ((rand() & 3) == 0)
+		{
+			length = (uint32_t)rand() % 8;
+		}
+		address = (uint32_t)rand() % (EEPROM_SIZE - length + 1);
+		switch (rand() % 4)
+		{
+		case 0:
+		case 1:
+			for (j = 0; j < length; j++)
+			{
+				buffer[j] = (uint8_t)rand();
+			}
+			writeBoth(buffer, address, length);
+			break;
+		case 2:
+			checkRead(address, length);
+			break;
+		default:
+			if ((rand() % 16) == 0)
+			{
+				flushAndCheck(-1);
+			}
+			break;
+		}
+	}
+	checkRead(0, EEPROM_SIZE);
+	flushAndCheck(-1);
+
+	finishTests();
+	exit(0);
+}
 
+#endif // #ifdef TEST_FLASH
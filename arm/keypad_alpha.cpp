@@ -580,6 +580,7 @@ void pinStatusCheckandPremadePIN()
 					uint8_t temp1[1];
 					temp1[0] = s;
 					nonVolatileWrite(temp1, WRONG_DEVICE_PIN_COUNT_ADDRESS, 1);
+					nonVolatileFlush();
 
 					buttonInterjectionNoAckPlusData(ASKUSER_SET_DEVICE_PIN_BIG, bufferPIN1, r);
 					yesOrNo = waitForButtonPress();
@@ -597,6 +598,7 @@ void pinStatusCheckandPremadePIN()
 						uint8_t temp2[1];
 						temp2[0] = type;
 						nonVolatileWrite(temp2, SETUP_TYPE_ADDRESS, 1);
+						nonVolatileFlush();
 
 
 					}else if(yesOrNo)
@@ -816,6 +818,7 @@ void pinStatusCheck()
 			uint8_t temp1[1];
 			temp1[0] = s;
 			nonVolatileWrite(temp1, WRONG_DEVICE_PIN_COUNT_ADDRESS, 1);
+			nonVolatileFlush();
 
 			buttonInterjectionNoAckPlusData(ASKUSER_SET_DEVICE_PIN, bufferPIN1, sizeof(*bufferPIN1));
 
@@ -835,6 +838,7 @@ void pinStatusCheck()
 				uint8_t temp2[1];
 				temp2[0] = type;
 				nonVolatileWrite(temp2, SETUP_TYPE_ADDRESS, 1);
+				nonVolatileFlush();
 
 				delay(1000);
 			}else if(yesOrNo)
@@ -963,6 +967,7 @@ void pinStatusCheckExpert()
 			uint8_t temp1[1];
 			temp1[0] = s;
 			nonVolatileWrite(temp1, WRONG_DEVICE_PIN_COUNT_ADDRESS, 1);
+			nonVolatileFlush();
 
 			buttonInterjectionNoAckPlusData(ASKUSER_SET_DEVICE_PIN, bufferPIN1, 0);
 
@@ -983,6 +988,7 @@ void pinStatusCheckExpert()
 				uint8_t temp2[1];
 				temp2[0] = type;
 				nonVolatileWrite(temp2, SETUP_TYPE_ADDRESS, 1);
+				nonVolatileFlush();
 
 				delay(1000);
 			}else if(yesOrNo)
@@ -2128,6 +2134,7 @@ void checkHashes(char *buffer4, bool displayAlpha)
 		uint8_t temp1[1];
 		temp1[0] = s;
 		nonVolatileWrite(temp1, WRONG_DEVICE_PIN_COUNT_ADDRESS, 1);
+		nonVolatileFlush();
 
 		writeX_Screen();
 		if(entryCount % 10 == 0){
@@ -2152,6 +2159,7 @@ void checkHashes(char *buffer4, bool displayAlpha)
 			uint8_t temp11[1];
 			temp11[0] = s1;
 			nonVolatileWrite(temp11, WRONG_DEVICE_PIN_COUNT_ADDRESS, 1);
+			nonVolatileFlush();
 		}
 	}
 	else
@@ -71,6 +71,7 @@ void setLang(void){
 	uint8_t set[1];
 	set[0] = s;
 	nonVolatileWrite(set, DEVICE_LANG_SET_ADDRESS, 1);
+	nonVolatileFlush();
 
 	sendSuccessPacketOnly();
 }
@@ -104,6 +105,7 @@ void setLangInitially(void){
 	uint8_t set[1];
 	set[0] = s;
 	nonVolatileWrite(set, DEVICE_LANG_SET_ADDRESS, 1);
+	nonVolatileFlush();
 }
 
 
@@ -111,6 +113,7 @@ void resetLang(void){
 	uint8_t set[1];
 	set[0] = 0;
 	nonVolatileWrite(set, DEVICE_LANG_SET_ADDRESS, 1);
+	nonVolatileFlush();
 }
 
 
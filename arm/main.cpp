@@ -200,6 +200,7 @@ void useWhatComms(void)
 		writeUSB_Screen();
 		break;
 	}
+	nonVolatileFlush();
 }
 
 void useWhatCommsStealth(void)
@@ -295,6 +296,7 @@ void useWhatCommsStealth(void)
 		writeUSB_Screen();
 		break;
 	}
+	nonVolatileFlush();
 }
 
 void useWhatCommsDuress(void)
@@ -649,5 +651,7 @@ void setup()
 void loop()
 {
 	processPacket();
+	// Backstop in case a packet handler left writes buffered.
+	nonVolatileFlush();
 }
 
@@ -26,6 +26,7 @@
 #include "../stream_comm.h"
 #include "DueTimer/DueTimer.h"
 #include "keypad_alpha.h"
+#include "ble_tx.h"
 
 /** Size of transmit buffer, in number of bytes.
   * \warning This must be a power of 2.
@@ -74,6 +75,12 @@ static uint32_t rx_acknowledge;
 /** Number of bytes which can be sent before waiting for the next
   * Acknowledgment to be received. */
 static uint32_t tx_acknowledge;
+/** Acknowledgement window in use, or 0 if the host doesn't acknowledge what
+  * it receives. */
+static uint32_t tx_window;
+/** Acknowledgement window which will be used once the packet currently
+  * being sent has been flushed. See usartSetTransmitWindow(). */
+static uint32_t tx_window_pending;
 
 
 /** Initializes USART0 with the parameters:
@@ -101,6 +108,11 @@ void initUsart(void)
 //		Serial1.end();
 
 		Serial1.begin(115200);
+		// Everything sent to the BLE module is paced by bleTxTick(); see
+		// ble_tx.c.
+		Timer3.stop();
+		bleTxInit();
+		Timer3.attachInterrupt(bleTxTick).setPeriod(BLE_TX_TICK_US).start();
 
 //		Serial1.begin(57600);
 //		Serial1.begin(38400);
@@ -112,6 +124,7 @@ void initUsart(void)
 
 
 	}else{
+		Timer3.stop();
 		Serial.begin(57600);
 	}
 //	pmc_enable_periph_clk(ID_TRNG);
@@ -135,28 +148,103 @@ void initFormatting(void)
 
 
 
+/** Check whether the UART to the BLE module can accept another byte without
+  * blocking. This is called by bleTxTick(), in interrupt context.
+  * \return true if Serial1 has room for a byte, false if not.
+  */
+bool bleLinkReady(void)
+{
+	return Serial1.availableForWrite() > 0;
+}
+
+/** Write one byte to the UART to the BLE module. This is called by
+  * bleTxTick(), in interrupt context, after bleLinkReady() returned true.
+  * \param data The byte to send.
+  */
+void bleLinkWrite(uint8_t data)
+{
+	Serial1.write(data);
+}
+
 /** Send one byte through USART0. If the transmit buffer is full, this will
-  * block until it isn't.
+  * block until it isn't. When using the BLE module, the byte is queued and
+  * sent at the rate the module can cope with (see ble_tx.c).
   * \param data The byte to send.
   */
 void usartSend(uint8_t data)
 {
-	message_slice_counter++;
-	if (message_slice_counter == 80)
+	if(bluetooth_on==1)
 	{
-		// 100 ms delay to let the BLE catch its breath.
-		delay(100);
-		message_slice_counter = 0;
+		bleTxPut(data);
+	}else{
+		Serial.write(data);
 	}
+}
+
+/** Wait until everything passed to usartSend() has been sent. When using the
+  * BLE module, this also waits until the module should have had time to
+  * send everything over the air, but gives up after
+  * #BLE_TX_FLUSH_TIMEOUT_MS so that a stuck UART can't hang the device.
+  * This is also where a window set by usartSetTransmitWindow() takes
+  * effect.
+  */
+void usartFlushTransmit(void)
+{
+	uint32_t start_time;
 
 	if(bluetooth_on==1)
 	{
-		Serial1.write(data);
+		start_time = millis();
+		while (!bleTxIsIdle() && ((millis() - start_time) < BLE_TX_FLUSH_TIMEOUT_MS))
+		{
+			// do nothing
+		}
+		Serial1.flush();
+		if (tx_window != tx_window_pending)
+		{
+			tx_window = tx_window_pending;
+			tx_acknowledge = tx_window;
+			bleTxSetHostPaced(tx_window != 0);
+		}
 	}else{
-		Serial.write(data);
+		Serial.flush();
 	}
+}
 
-
+/** Set the acknowledgement window (see PROTOCOL.txt) used when sending.
+  * After every window bytes, streamPutOneByte() waits for the host to
+  * acknowledge them, and the host's acknowledgements (instead of an assumed
+  * rate) then limit how fast bytes go to the BLE module.
+  *
+  * Turning acknowledgements off takes effect straight away. Turning them on
+  * takes effect once the packet currently being sent has been flushed by
+  * usartFlushTransmit(), so that the host can be told about the window in
+  * that packet before it has to start acknowledging.
+  * \param window The window the host asked for, or 0 for no
+  *               acknowledgements.
+  * \return The window which will be used. This is always 0 over USB, which
+  *         has its own flow control, and never more than #BLE_TX_MAX_WINDOW
+  *         over BLE.
+  */
+uint32_t usartSetTransmitWindow(uint32_t window)
+{
+	if(bluetooth_on==1)
+	{
+		window = MIN(window, BLE_TX_MAX_WINDOW);
+	}else{
+		window = 0;
+	}
+	tx_window_pending = window;
+	if (window == 0)
+	{
+		tx_window = 0;
+		tx_acknowledge = 0;
+		if(bluetooth_on==1)
+		{
+			bleTxSetHostPaced(false);
+		}
+	}
+	return window;
 }
 
 void usartSpew(void)
@@ -265,41 +353,64 @@ void usartSpew(void)
 
 
 
-/** Receive one byte through USART0. If there isn't a byte in the receive
-  * buffer, this will block until there is.
-  * \return The byte that was received.
+/** Receive bytes through USART0, without waiting. This takes whatever the
+  * serial port's interrupt handler has already put in its receive buffer,
+  * in one go.
+  * \param buffer The byte array where the received bytes will be written.
+  * \param length The maximum number of bytes to receive.
+  * \return The number of bytes received (possibly 0).
   */
-uint8_t usartReceive(void)
+static uint32_t usartReceiveAvailable(uint8_t *buffer, uint32_t length)
 {
-	uint8_t r;
-	byte rTmp[1];
-//	int bluetooth_on;
-//	bluetooth_on = checkBLE();
+	int available;
 
 	if(bluetooth_on==1)
 	{
-		Serial1.readBytes(rTmp, 1);
+		available = Serial1.available();
 	}else{
-		Serial.readBytes(rTmp, 1);
+		available = Serial.available();
+	}
+	if (available <= 0)
+	{
+		return 0;
 	}
+	length = MIN(length, (uint32_t)available);
+	// This won't wait, since there are at least length bytes available.
+	if(bluetooth_on==1)
+	{
+		Serial1.readBytes(buffer, length);
+	}else{
+		Serial.readBytes(buffer, length);
+	}
+	return length;
+}
 
-	// The check in the loop doesn't need to be atomic, because the worst
-	// that can happen is that the loop spins one extra time.
-//	while ((rx_buffer_start == rx_buffer_end) && !rx_buffer_full)
-//	{
-//		// do nothing
-//	}
-//		cli();
-//		r = rx_buffer[rx_buffer_start];
-//		rx_buffer_start++;
-//		rx_buffer_start = (uint8_t)(rx_buffer_start & RX_BUFFER_MASK);
-//		rx_buffer_full = false;
-//		sei();
-////		usartSpew();
-//	if (rTmp[0] == 0x23){
-//		usartSpew();
-//	};
-	r = rTmp[0];
+/** Receive bytes through USART0. If there aren't enough bytes in the receive
+  * buffer, this will block until there are.
+  * \param buffer The byte array where the received bytes will be written.
+  * \param length The number of bytes to receive.
+  */
+static void usartReceiveBytes(uint8_t *buffer, uint32_t length)
+{
+	uint32_t received;
+
+	while (length > 0)
+	{
+		received = usartReceiveAvailable(buffer, length);
+		buffer += received;
+		length -= received;
+	}
+}
+
+/** Receive one byte through USART0. If there isn't a byte in the receive
+  * buffer, this will block until there is.
+  * \return The byte that was received.
+  */
+uint8_t usartReceive(void)
+{
+	uint8_t r;
+
+	usartReceiveBytes(&r, 1);
 	return r;
 }
 
@@ -346,27 +457,58 @@ uint8_t streamGetOneByte(void)
 {
 	uint8_t one_byte;
 
-	one_byte = usartReceive();
-	rx_acknowledge--;
-	if (rx_acknowledge == 0)
-	{
-		// Send acknowledgement to other side.
-		uint8_t buffer[4];
-		uint8_t i;
+	streamGetBytes(&one_byte, 1);
+	return one_byte;
+}
 
-		rx_acknowledge = RX_BUFFER_SIZE;
-		writeU32LittleEndian(buffer, rx_acknowledge);
-		usartSend(0xff);
-		for (i = 0; i < 4; i++)
+/** Grab a number of bytes from the communication stream. The bytes are
+  * received in chunks which end at acknowledgement boundaries, so
+  * that the acknowledgement bookkeeping is done once per chunk instead of once
+  * per byte. See streamGetOneByte() for why there's no way to indicate a read
+  * error.
+  * \param buffer The byte array where the received bytes will be written.
+  *               This must have space for length bytes.
+  * \param length The number of bytes to receive.
+  */
+void streamGetBytes(uint8_t *buffer, uint32_t length)
+{
+	uint32_t chunk_length;
+
+	while (length > 0)
+	{
+		// rx_acknowledge == 0 means 2 ^ 32 bytes can be received before the
+		// next acknowledgement, since it is decremented before it is checked.
+		if (rx_acknowledge == 0)
 		{
-			usartSend(buffer[i]);
+			chunk_length = length;
+		}
+		else
+		{
+			chunk_length = MIN(length, rx_acknowledge);
+		}
+		usartReceiveBytes(buffer, chunk_length);
+		buffer += chunk_length;
+		length -= chunk_length;
+		rx_acknowledge -= chunk_length;
+		if (rx_acknowledge == 0)
+		{
+			// Send acknowledgement to other side.
+			uint8_t ack_buffer[4];
+			uint8_t i;
+
+			rx_acknowledge = RX_BUFFER_SIZE;
+			writeU32LittleEndian(ack_buffer, rx_acknowledge);
+			usartSend(0xff);
+			for (i = 0; i < 4; i++)
+			{
+				usartSend(ack_buffer[i]);
+			}
+		}
+		if (rx_buffer_overrun)
+		{
+			streamReadOrWriteError();
 		}
 	}
-	if (rx_buffer_overrun)
-	{
-		streamReadOrWriteError();
-	}
-	return one_byte;
 }
 
 /** Send one byte to the communication stream. There is no way for this
@@ -398,6 +540,11 @@ void streamPutOneByte(uint8_t one_byte)
 			buffer[i] = usartReceive();
 		}
 		tx_acknowledge = readU32LittleEndian(buffer);
+		if ((tx_window != 0) && ((tx_acknowledge == 0) || (tx_acknowledge > tx_window)))
+		{
+			// Never let more than the agreed window be outstanding.
+			tx_acknowledge = tx_window;
+		}
 	}
 }
 
@@ -8,14 +8,17 @@
 #ifndef ARM_BITLOX_54_ARM_USART_H_
 #define ARM_BITLOX_54_ARM_USART_H_
 
+#include <stdint.h>
+
 #ifdef __cplusplus
      extern "C" {
 #endif
      void initFormatting(void);
 //     extern uint8_t bluetooth_on;
 //     extern uint8_t is_formatted;
-//     extern uint8_t message_slice_counter;
      void checkFlush(void);
+     void usartFlushTransmit(void);
+     uint32_t usartSetTransmitWindow(uint32_t window);
      void moof(void);
      void startTimer1(void);
      void stopTimer1(void);
@@ -182,10 +182,10 @@ void hashToAddr(char *out, uint8_t *in, uint8_t address_version)
 	sha256Begin(&hs);
 	r[24] = address_version;
 	sha256WriteByte(&hs, address_version);
+	sha256WriteBytes(&hs, in, 20);
 	for (i = 0; i < 20; i++)
 	{
 		r[23 - i] = in[i];
-		sha256WriteByte(&hs, in[i]);
 	}
 	sha256FinishDouble(&hs);
 	writeU32LittleEndian(r, hs.h[0]);
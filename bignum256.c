@@ -23,6 +23,15 @@
   * bytes (such functions will use the typedef #BigNum256), but some functions
   * accept variable-sized arrays.
   *
+  * The field operations (bigModulo(), bigAdd(), bigSubtract() and
+  * bigMultiply()) have two implementations, selected at compile time. The
+  * original one works on 8 bit limbs, which suits AVR. If
+  * #BIGNUM256_32BIT_LIMBS is defined (see bignum256.h), the numbers are
+  * converted to 32 bit limbs internally, which makes use of the
+  * 32 x 32 -> 64 bit multiplier on ARM. The TEST_BIGNUM256 tests should be
+  * run against both implementations, i.e. once with BIGNUM256_8BIT_LIMBS
+  * defined and once without.
+  *
   * To use most of the exported functions here, you must call bigSetField()
   * first to set field parameters. If you don't do this, you'll get a
   * segfault! Functions which do not operate under a prime finite field (eg.
@@ -59,6 +68,28 @@ static uint8_t *complement_n;
 /** The size of #complement_n, in number of bytes. */
 static uint8_t size_complement_n;
 
+#ifdef BIGNUM256_32BIT_LIMBS
+/** #n as 32 bit limbs, least significant limb first. */
+static uint32_t n32[8];
+/** #complement_n as 32 bit limbs, least significant limb first.
+  * \warning The most significant limb of this must be 1. This is the case
+  *          for both of secp256k1's primes.
+  */
+static uint32_t complement_n32[5];
+/** The number of valid limbs in #complement_n32. */
+static uint8_t size_complement_n32;
+/** Non-zero if #complement_n is of the form 2 ^ 32 + c, where c fits in
+  * one limb (as is the case for secp256k1's p). Modular reduction can be
+  * done faster in that case. */
+static uint8_t complement_is_sparse;
+#endif // #ifdef BIGNUM256_32BIT_LIMBS
+
+#ifdef TEST
+/** Number of times bigMultiply() has been called. This is used by
+  * benchmarks to count field multiplications. */
+uint32_t big_multiply_count;
+#endif // #ifdef TEST
+
 /** Compare two multi-precision numbers of arbitrary size.
   * \param op1 One of the numbers to compare.
   * \param op2 The other number to compare. This may alias op1.
@@ -159,6 +190,46 @@ void bigAssign(BigNum256 r, BigNum256 op1)
 	memcpy(r, op1, 32);
 }
 
+#ifdef BIGNUM256_32BIT_LIMBS
+
+/** Convert a 32 byte multi-precision number into 8 32 bit limbs. The byte
+  * array doesn't have to be aligned.
+  * \param out The 8 limbs will be written here, least significant first.
+  * \param in The 32 byte number to convert.
+  */
+static void bigToLimbs(uint32_t *out, const uint8_t *in)
+{
+	uint8_t i;
+
+	for (i = 0; i < 8; i++)
+	{
+		out[i] = ((uint32_t)in[i * 4])
+			| ((uint32_t)in[i * 4 + 1] << 8)
+			| ((uint32_t)in[i * 4 + 2] << 16)
+			| ((uint32_t)in[i * 4 + 3] << 24);
+	}
+}
+
+/** Convert 8 32 bit limbs into a 32 byte multi-precision number.
+  * \param out The 32 byte number will be written here. This doesn't have to
+  *            be aligned.
+  * \param in The 8 limbs to convert, least significant first.
+  */
+static void limbsToBig(uint8_t *out, const uint32_t *in)
+{
+	uint8_t i;
+
+	for (i = 0; i < 8; i++)
+	{
+		out[i * 4] = (uint8_t)in[i];
+		out[i * 4 + 1] = (uint8_t)(in[i] >> 8);
+		out[i * 4 + 2] = (uint8_t)(in[i] >> 16);
+		out[i * 4 + 3] = (uint8_t)(in[i] >> 24);
+	}
+}
+
+#endif // #ifdef BIGNUM256_32BIT_LIMBS
+
 /** Set prime finite field parameters. The arrays passed as parameters to
   * this function will never be written to, hence the const modifiers.
   * \param in_n See #n.
@@ -172,6 +243,23 @@ void bigSetField(const uint8_t *in_n, const uint8_t *in_complement_n, const uint
 	n = (BigNum256)in_n;
 	complement_n = (uint8_t *)in_complement_n;
 	size_complement_n = (uint8_t)in_size_complement_n;
+#ifdef BIGNUM256_32BIT_LIMBS
+	{
+		uint8_t i;
+
+#ifdef TEST
+		assert(in_size_complement_n <= 20);
+#endif // #ifdef TEST
+		bigToLimbs(n32, in_n);
+		memset(complement_n32, 0, sizeof(complement_n32));
+		for (i = 0; i < in_size_complement_n; i++)
+		{
+			complement_n32[i >> 2] |= (uint32_t)in_complement_n[i] << ((i & 3) * 8);
+		}
+		size_complement_n32 = (uint8_t)((in_size_complement_n + 3) >> 2);
+		complement_is_sparse = (uint8_t)((size_complement_n32 == 2) && (complement_n32[1] == 1));
+	}
+#endif // #ifdef BIGNUM256_32BIT_LIMBS
 }
 
 /** Add (r = op1 + op2) two multi-precision numbers of arbitrary size,
@@ -237,6 +325,8 @@ uint8_t bigSubtractVariableSizeNoModulo(uint8_t *r, uint8_t *op1, uint8_t *op2,
 	return bigSubtractVariableSizeNoModulo(r, op1, op2, 32);
 }
 
+#ifndef BIGNUM256_32BIT_LIMBS
+
 /** Compute op1 modulo #n, where op1 is a 32 byte multi-precision number.
   * The "modulo" part makes it sound like this function does division
   * somewhere, but since #n is also a 32 byte multi-precision number, all
@@ -312,6 +402,8 @@ void bigSubtract(BigNum256 r, BigNum256 op1, BigNum256 op2)
 	bigAddVariableSizeNoModulo(r, r, lookup[too_small], 32);
 }
 
+#endif // #ifndef BIGNUM256_32BIT_LIMBS
+
 #ifdef PLATFORM_SPECIFIC_BIGMULTIPLY
 
 /** Multiplies (r = op1 x op2) two multi-precision numbers of arbitrary size,
@@ -495,6 +587,8 @@ void bigMultiplyVariableSizeNoModulo(uint8_t *r, uint8_t *op1, uint8_t op1_size,
 //}
 
 
+#ifndef BIGNUM256_32BIT_LIMBS
+
 /** Multiplies (r = (op1 x op2) modulo #n) two 32 byte multi-precision
   * numbers under the current prime finite field.
   * \param r The 32 byte result will be written into here.
@@ -508,6 +602,9 @@ void bigMultiply(BigNum256 r, BigNum256 op1, BigNum256 op2)
 	uint8_t full_r[64];
 	uint8_t remaining;
 
+#ifdef TEST
+	big_multiply_count++;
+#endif // #ifdef TEST
 	bigMultiplyVariableSizeNoModulo(full_r, op1, 32, op2, 32);
 
 	// The modular reduction is done by subtracting off some multiple of
@@ -542,6 +639,268 @@ void bigMultiply(BigNum256 r, BigNum256 op1, BigNum256 op2)
 	bigAssign(r, full_r);
 }
 
+#endif // #ifndef BIGNUM256_32BIT_LIMBS
+
+#ifdef BIGNUM256_32BIT_LIMBS
+
+/** Subtract (r = op1 - (op2 & mask)) two 256 bit numbers in limb form,
+  * ignoring the current prime finite field.
+  * \param r The 8 limb result will be written here. This may alias op1.
+  * \param op1 The 8 limb number to subtract from.
+  * \param op2 The 8 limb number to subtract off op1.
+  * \param mask Either 0 (to subtract nothing) or 0xffffffff (to subtract
+  *             op2).
+  * \return 1 if borrow occurred, 0 if no borrow occurred.
+  */
+static uint32_t limbsSubtractMasked(uint32_t *r, const uint32_t *op1, const uint32_t *op2, uint32_t mask)
+{
+	uint64_t partial;
+	uint32_t borrow;
+	uint8_t i;
+
+	borrow = 0;
+	for (i = 0; i < 8; i++)
+	{
+		partial = (uint64_t)op1[i] - (uint64_t)(op2[i] & mask) - (uint64_t)borrow;
+		r[i] = (uint32_t)partial;
+		borrow = (uint32_t)(partial >> 32) & 1;
+	}
+	return borrow;
+}
+
+/** Add (r = op1 + (op2 & mask)) two 256 bit numbers in limb form, ignoring
+  * the current prime finite field.
+  * \param r The 8 limb result will be written here. This may alias op1.
+  * \param op1 The first 8 limb number to add.
+  * \param op2 The second 8 limb number to add.
+  * \param mask Either 0 (to add nothing) or 0xffffffff (to add op2).
+  * \return 1 if carry occurred, 0 if no carry occurred.
+  */
+static uint32_t limbsAddMasked(uint32_t *r, const uint32_t *op1, const uint32_t *op2, uint32_t mask)
+{
+	uint64_t partial;
+	uint32_t carry;
+	uint8_t i;
+
+	carry = 0;
+	for (i = 0; i < 8; i++)
+	{
+		partial = (uint64_t)op1[i] + (uint64_t)(op2[i] & mask) + (uint64_t)carry;
+		r[i] = (uint32_t)partial;
+		carry = (uint32_t)(partial >> 32);
+	}
+	return carry;
+}
+
+/** Reduce r modulo #n, assuming r < 2 x #n. This does the same thing as
+  * bigModulo(), but in limb form.
+  * \param r The 8 limb number to reduce. The result is written back here.
+  * \param borrow_in Set this to 1 if r has an implicit 2 ^ 256 bit, 0
+  *                  otherwise.
+  */
+static void limbsModulo(uint32_t *r, uint32_t borrow_in)
+{
+	uint32_t temp[8];
+	uint32_t borrow;
+	uint32_t mask;
+
+	borrow = limbsSubtractMasked(temp, r, n32, 0xffffffff);
+	// Keep r - n if r >= n (no borrow) or if r had a 2 ^ 256 bit. The
+	// following line does: "mask = (borrow_in || !borrow) ? 0xffffffff : 0;".
+	mask = (uint32_t)0 - ((borrow ^ 1) | borrow_in);
+	limbsSubtractMasked(r, r, n32, mask);
+}
+
+/** Compute op1 modulo #n, where op1 is a 32 byte multi-precision number.
+  * The "modulo" part makes it sound like this function does division
+  * somewhere, but since #n is also a 32 byte multi-precision number, all
+  * this function actually does is subtract #n off op1 if op1 is >= #n.
+  * \param r The 32 byte result will be written into here.
+  * \param op1 The 32 byte operand to apply the modulo to. This may alias r.
+  */
+void bigModulo(BigNum256 r, BigNum256 op1)
+{
+	uint32_t a[8];
+
+	bigToLimbs(a, op1);
+	limbsModulo(a, 0);
+	limbsToBig(r, a);
+}
+
+/** Add (r = (op1 + op2) modulo #n) two 32 byte multi-precision numbers under
+  * the current prime finite field.
+  * \param r The 32 byte result will be written into here.
+  * \param op1 The first 32 byte operand to add. This may alias r.
+  * \param op2 The second 32 byte operand to add. This may alias r or op1.
+  * \warning op1 and op2 must both be < #n.
+  */
+void bigAdd(BigNum256 r, BigNum256 op1, BigNum256 op2)
+{
+	uint32_t a[8];
+	uint32_t b[8];
+	uint32_t carry;
+
+#ifdef TEST
+	assert(bigCompare(op1, n) == BIGCMP_LESS);
+	assert(bigCompare(op2, n) == BIGCMP_LESS);
+#endif // #ifdef TEST
+	bigToLimbs(a, op1);
+	bigToLimbs(b, op2);
+	carry = limbsAddMasked(a, a, b, 0xffffffff);
+	limbsModulo(a, carry);
+	limbsToBig(r, a);
+}
+
+/** Subtract (r = (op1 - op2) modulo #n) two 32 byte multi-precision numbers
+  * under the current prime finite field.
+  * \param r The 32 byte result will be written into here.
+  * \param op1 The 32 byte operand to subtract from. This may alias r.
+  * \param op2 The 32 byte operand to sutract off op1. This may alias r or
+  *            op1.
+  * \warning op1 and op2 must both be < #n.
+  */
+void bigSubtract(BigNum256 r, BigNum256 op1, BigNum256 op2)
+{
+	uint32_t a[8];
+	uint32_t b[8];
+	uint32_t borrow;
+
+#ifdef TEST
+	assert(bigCompare(op1, n) == BIGCMP_LESS);
+	assert(bigCompare(op2, n) == BIGCMP_LESS);
+#endif // #ifdef TEST
+	bigToLimbs(a, op1);
+	bigToLimbs(b, op2);
+	borrow = limbsSubtractMasked(a, a, b, 0xffffffff);
+	// If a borrow occurred, add n back on.
+	limbsAddMasked(a, a, n32, (uint32_t)0 - borrow);
+	limbsToBig(r, a);
+}
+
+/** Fold the upper limbs of a multi-precision number into its lower 256 bits,
+  * using the fact that 2 ^ 256 is congruent to #complement_n modulo #n.
+  * This does: t = (t mod 2 ^ 256) + (t[8 ... 8 + hi_size - 1]) x
+  * #complement_n, which is congruent to t modulo #n but (usually) smaller.
+  * \param t The number (17 limbs, least significant first) to fold. All
+  *          limbs at or above 8 + hi_size must be zero.
+  * \param hi_size The number of limbs, starting from t[8], to fold.
+  */
+static void limbsFold(uint32_t *t, uint8_t hi_size)
+{
+	uint32_t hi[8];
+	uint64_t partial;
+	uint32_t carry;
+	uint8_t i;
+	uint8_t j;
+
+	for (i = 0; i < hi_size; i++)
+	{
+		hi[i] = t[8 + i];
+		t[8 + i] = 0;
+	}
+	if (complement_is_sparse)
+	{
+		// complement_n is 2 ^ 32 + complement_n32[0], so multiplication
+		// by it is a shift and a multiplication by a single limb. This is
+		// the case for secp256k1's p.
+		carry = 0;
+		for (i = 0; i < 17; i++)
+		{
+			partial = (uint64_t)t[i] + (uint64_t)carry;
+			if (i < hi_size)
+			{
+				partial += (uint64_t)hi[i] * (uint64_t)complement_n32[0];
+			}
+			if ((i > 0) && (i <= hi_size))
+			{
+				partial += (uint64_t)hi[i - 1];
+			}
+			t[i] = (uint32_t)partial;
+			carry = (uint32_t)(partial >> 32);
+		}
+	}
+	else
+	{
+		for (i = 0; i < hi_size; i++)
+		{
+			carry = 0;
+			for (j = 0; j < size_complement_n32; j++)
+			{
+				partial = (uint64_t)hi[i] * (uint64_t)complement_n32[j] + (uint64_t)t[i + j] + (uint64_t)carry;
+				t[i + j] = (uint32_t)partial;
+				carry = (uint32_t)(partial >> 32);
+			}
+			for (j = (uint8_t)(i + size_complement_n32); j < 17; j++)
+			{
+				partial = (uint64_t)t[j] + (uint64_t)carry;
+				t[j] = (uint32_t)partial;
+				carry = (uint32_t)(partial >> 32);
+			}
+		}
+	}
+}
+
+/** Multiplies (r = (op1 x op2) modulo #n) two 32 byte multi-precision
+  * numbers under the current prime finite field.
+  * \param r The 32 byte result will be written into here.
+  * \param op1 The first 32 byte operand to multiply. This may alias r.
+  * \param op2 The second 32 byte operand to multiply. This may alias r or
+  *            op1.
+  */
+void bigMultiply(BigNum256 r, BigNum256 op1, BigNum256 op2)
+{
+	uint32_t a[8];
+	uint32_t b[8];
+	uint32_t t[17];
+	uint64_t partial;
+	uint32_t carry;
+	uint8_t i;
+	uint8_t j;
+	uint8_t hi_size;
+
+#ifdef TEST
+	big_multiply_count++;
+#endif // #ifdef TEST
+	bigToLimbs(a, op1);
+	bigToLimbs(b, op2);
+	memset(t, 0, sizeof(t));
+	// Schoolbook multiplication, using the 32 x 32 -> 64 bit multiplier.
+	// (2 ^ 32 - 1) ^ 2 + 2 x (2 ^ 32 - 1) = 2 ^ 64 - 1, so partial never
+	// overflows.
+	for (i = 0; i < 8; i++)
+	{
+		carry = 0;
+		for (j = 0; j < 8; j++)
+		{
+			partial = (uint64_t)a[i] * (uint64_t)b[j] + (uint64_t)t[i + j] + (uint64_t)carry;
+			t[i + j] = (uint32_t)partial;
+			carry = (uint32_t)(partial >> 32);
+		}
+		t[i + 8] = carry;
+	}
+
+	// Modular reduction, by repeatedly folding the upper limbs into the lower
+	// 256 bits (see limbsFold()). Since the most significant limb of
+	// complement_n is 1, folding hi_size limbs leaves at most
+	// hi_size + size_complement_n32 - 8 limbs above the lower 256 bits. The
+	// number of folds depends only on the field, not on op1 or op2.
+	hi_size = 8;
+	while ((hi_size + size_complement_n32) > 8)
+	{
+		limbsFold(t, hi_size);
+		hi_size = (uint8_t)(hi_size + size_complement_n32 - 8);
+	}
+	// Now t < 2 ^ 256 + complement_n x 2 ^ (32 x hi_size), so after the next
+	// fold, t[8] is at most 1. After folding that, t < 2 ^ 256.
+	limbsFold(t, hi_size);
+	limbsFold(t, 1);
+	// As long as n > 2 ^ 255, at most one subtraction is required to ensure
+	// that r < n.
+	limbsModulo(t, 0);
+	limbsToBig(r, t);
+}
+
+#endif // #ifdef BIGNUM256_32BIT_LIMBS
 
 /** Compute the modular inverse of a 32 byte multi-precision number under
   * the current prime finite field (i.e. find r such that
@@ -759,6 +1118,12 @@ int main(void)
 
 	initTests(__FILE__);
 
+#ifdef BIGNUM256_32BIT_LIMBS
+	printf("Testing 32 bit limb implementation\n");
+#else
+	printf("Testing 8 bit limb implementation\n");
+#endif // #ifdef BIGNUM256_32BIT_LIMBS
+
 	srand(42);
 
 	// Test bigCompareVariableSize(), since many other functions rely on it.
@@ -54,6 +54,17 @@ typedef struct {
 
 //#define PLATFORM_SPECIFIC_BIGMULTIPLY
 
+/** If this is defined, bignum256.c does its arithmetic on 32 bit limbs
+  * instead of bytes. This is much faster on platforms with a
+  * 32 x 32 -> 64 bit multiplier, such as the ARM Cortex-M3. The interface is
+  * the same either way: numbers are still little-endian byte arrays.
+  * This is defined by default everywhere except AVR. Define
+  * BIGNUM256_8BIT_LIMBS to force the original byte-oriented implementation.
+  */
+#if !defined(AVR) && !defined(BIGNUM256_8BIT_LIMBS)
+#define BIGNUM256_32BIT_LIMBS
+#endif // #if !defined(AVR) && !defined(BIGNUM256_8BIT_LIMBS)
+
 extern uint8_t bigCompareVariableSize(uint8_t *op1, uint8_t *op2, uint8_t size);
 extern uint8_t bigCompare(BigNum256 op1, BigNum256 op2);
 extern uint8_t bigIsZero(BigNum256 op1);
@@ -68,6 +79,9 @@ extern void bigAdd(BigNum256 r, BigNum256 op1, BigNum256 op2);
 extern void bigSubtract(BigNum256 r, BigNum256 op1, BigNum256 op2);
 extern void bigMultiplyVariableSizeNoModulo(uint8_t *r, uint8_t *op1, uint8_t op1_size, uint8_t *op2, uint8_t op2_size);
 extern void bigMultiply(BigNum256 r, BigNum256 op1, BigNum256 op2);
+#ifdef TEST
+extern uint32_t big_multiply_count;
+#endif // #ifdef TEST
 extern void bigInvert(BigNum256 r, BigNum256 op1);
 extern uint8_t bigSubtractNoModulo(BigNum256 r, BigNum256 op1, BigNum256 op2);
 
@@ -24,9 +24,9 @@
 #include <string.h>
 
 #include "base58_trez.h"
-#include "bignum_trez.h"
 #include "bip32_trez.h"
-#include "ecdsa_trez.h"
+#include "endian.h"
+#include "ecdsa.h"
 #include "hmac_trez.h"
 #include "ripemd160_trez.h"
 #include "sha2_trez.h"
@@ -51,6 +51,11 @@ void hdnode_from_xprv(uint32_t depth, uint32_t fingerprint, uint32_t child_num,
 	hdnode_fill_public_key(out);
 }
 
+// The BIP32 master key HMAC always uses the same key, so its pad states
+// are only computed once.
+static HMAC_SHA512_CTX bitcoin_seed_hctx;
+static int is_bitcoin_seed_hctx_valid = 0;
+
 void hdnode_from_seed(uint8_t *seed, int seed_len, HDNode *out)
 {
 	uint8_t I[32 + 32];
@@ -58,7 +63,11 @@ void hdnode_from_seed(uint8_t *seed, int seed_len, HDNode *out)
 	out->depth = 0;
 	out->fingerprint = 0x00000000;
 	out->child_num = 0;
-	hmac_sha512((uint8_t *)"Bitcoin seed", 12, seed, seed_len, I);
+	if (!is_bitcoin_seed_hctx_valid) {
+		hmac_sha512_prepare((uint8_t *)"Bitcoin seed", 12, &bitcoin_seed_hctx);
+		is_bitcoin_seed_hctx_valid = 1;
+	}
+	hmac_sha512_prepared(&bitcoin_seed_hctx, seed, seed_len, I);
 	memcpy(out->chain_code, I + 32, 32);
 	memcpy(out->private_key, I, 32);
 	hdnode_fill_public_key(out);
@@ -69,7 +78,6 @@ int hdnode_private_ckd(HDNode *inout, uint32_t i)
 	uint8_t data[1 + 32 + 4];
 	uint8_t I[32 + 32];
 	uint8_t fingerprint[32];
-	bignum256 a, b;
 
 	if (i & 0x80000000) { // private derivation
 		data[0] = 0;
@@ -77,24 +85,18 @@ int hdnode_private_ckd(HDNode *inout, uint32_t i)
 	} else { // public derivation
 		memcpy(data, inout->public_key, 33);
 	}
-	write_be(data + 33, i);
+	writeU32BigEndian(data + 33, i);
 
 	sha256_Raw(inout->public_key, 33, fingerprint);
 	ripemd160(fingerprint, 32, fingerprint);
 	inout->fingerprint = (fingerprint[0] << 24) + (fingerprint[1] << 16) + (fingerprint[2] << 8) + fingerprint[3];
 
-	bn_read_be(inout->private_key, &a);
-
 	hmac_sha512(inout->chain_code, 32, data, sizeof(data), I);
 	memcpy(inout->chain_code, I + 32, 32);
-	memcpy(inout->private_key, I, 32);
-
-	bn_read_be(inout->private_key, &b);
-	bn_addmod(&a, &b, &order256k1);
+	ecdsaAddToPrivateKey(inout->private_key, I); // private_key += I (mod n)
 
 	inout->depth++;
 	inout->child_num = i;
-	bn_write_be(&a, inout->private_key);
 
 	hdnode_fill_public_key(inout);
 
@@ -106,32 +108,28 @@ int hdnode_public_ckd(HDNode *inout, uint32_t i)
 	uint8_t data[1 + 32 + 4];
 	uint8_t I[32 + 32];
 	uint8_t fingerprint[32];
-	curve_point a, b;
-	bignum256 c;
+	uint8_t public_key[33];
 
 	if (i & 0x80000000) { // private derivation
 		return 0;
 	} else { // public derivation
 		memcpy(data, inout->public_key, 33);
 	}
-	write_be(data + 33, i);
+	writeU32BigEndian(data + 33, i);
 
 	sha256_Raw(inout->public_key, 33, fingerprint);
 	ripemd160(fingerprint, 32, fingerprint);
 	inout->fingerprint = (fingerprint[0] << 24) + (fingerprint[1] << 16) + (fingerprint[2] << 8) + fingerprint[3];
 
 	memset(inout->private_key, 0, 32);
-	if (!ecdsa_read_pubkey(inout->public_key, &a)) {
-		return 0;
-	}
 
 	hmac_sha512(inout->chain_code, 32, data, sizeof(data), I);
+	memcpy(public_key, inout->public_key, 33);
+	if (ecdsaAddToPublicKey33(public_key, I)) { // public_key += I * G
+		return 0;
+	}
 	memcpy(inout->chain_code, I + 32, 32);
-	bn_read_be(I, &c);
-	scalar_multiply(&c, &b); // b = c * G
-	point_add(&a, &b);       // b = a + b
-	inout->public_key[0] = 0x02 | (b.y.val[0] & 0x01);
-	bn_write_be(&b.x, inout->public_key + 1);
+	memcpy(inout->public_key, public_key, 33);
 
 	inout->depth++;
 	inout->child_num = i;
@@ -142,16 +140,16 @@ int hdnode_public_ckd(HDNode *inout, uint32_t i)
 
 void hdnode_fill_public_key(HDNode *node)
 {
-	ecdsa_get_public_key33(node->private_key, node->public_key);
+	ecdsaGetPublicKey33(node->public_key, node->private_key);
 }
 
 void hdnode_serialize(const HDNode *node, uint32_t version, char use_public, char *str)
 {
 	uint8_t node_data[78];
-	write_be(node_data, version);
+	writeU32BigEndian(node_data, version);
 	node_data[4] = node->depth;
-	write_be(node_data + 5, node->fingerprint);
-	write_be(node_data + 9, node->child_num);
+	writeU32BigEndian(node_data + 5, node->fingerprint);
+	writeU32BigEndian(node_data + 9, node->child_num);
 	memcpy(node_data + 13, node->chain_code, 32);
 	if (use_public) {
 		memcpy(node_data + 45, node->public_key, 33);
@@ -180,7 +178,7 @@ int hdnode_deserialize(const char *str, HDNode *node)
 	if (!base58_decode_check(str, node_data)) {
 		return -1;
 	}
-	uint32_t version = read_be(node_data);
+	uint32_t version = readU32BigEndian(node_data);
 	if (version == 0x0488B21E) { // public node
 		memcpy(node->public_key, node_data + 45, 33);
 	} else if (version == 0x0488ADE4) { // private node
@@ -193,8 +191,8 @@ int hdnode_deserialize(const char *str, HDNode *node)
 		return -3; // invalid version
 	}
 	node->depth = node_data[4];
-	node->fingerprint = read_be(node_data + 5);
-	node->child_num = read_be(node_data + 9);
+	node->fingerprint = readU32BigEndian(node_data + 5);
+	node->child_num = readU32BigEndian(node_data + 9);
 	memcpy(node->chain_code, node_data + 13, 32);
 	return 0;
 }
@@ -97,6 +97,16 @@ typedef enum BoolEnum
 #define NOINLINE
 #endif // #if defined(__GNUC__)
 
+/** The opposite of #NOINLINE. This is for tiny helper functions in hot loops,
+  * which compilers optimising for size (as the Arduino toolchain does) would
+  * otherwise leave as calls. The call overhead can then cost more than the
+  * helper itself. */
+#if defined(__GNUC__)
+#define ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define ALWAYS_INLINE
+#endif // #if defined(__GNUC__)
+
 /** On certain platforms, unchanging, read-only data (eg. lookup tables) needs
   * to be marked and accessed in a way that is different to read/write data.
   * Marking this data with PROGMEM saves valuable RAM space. However, any data
@@ -95,6 +95,604 @@ static const uint8_t secp256k1_Gy[32] PROGMEM = {
 0x65, 0xc4, 0xa3, 0x26, 0x77, 0xda, 0x3a, 0x48};
 
 
+/** (#secp256k1_p + 1) / 4. Raising a quadratic residue to this power gives
+  * its square root, since #secp256k1_p = 3 (mod 4). */
+static const uint8_t secp256k1_p_plus_1_over_4[32] = {
+0x0c, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f};
+
+/** Number of bits in each window used by pointMultiply(). This must divide
+  * 8. */
+#define WINDOW_BITS		4
+/** Number of entries in the table of multiples used by pointMultiply(),
+  * including the point at infinity. */
+#define WINDOW_SIZE		(1 << WINDOW_BITS)
+
+/** Number of teeth (rows) of the comb used by pointMultiplyG().
+  * \warning #secp256k1_comb_table must be regenerated if this is changed.
+  */
+#define COMB_TEETH		6
+/** Spacing between the teeth of the comb used by pointMultiplyG(), in bits.
+  * This is ceil(256 / #COMB_TEETH). */
+#define COMB_SPACING	43
+
+/** Precomputed multiples of the base point G used by pointMultiplyG(). Entry
+  * i - 1 is the sum of 2 ^ (j * #COMB_SPACING) x G over every bit j that is
+  * set in i (bit 0 is the least significant). Each entry is the x component
+  * followed by the y component, both as 32 byte little-endian
+  * multi-precision integers. Entry 0 is G itself. The point at infinity
+  * (i = 0) is not stored. */
+static const uint8_t secp256k1_comb_table[(1 << COMB_TEETH) - 1][64] PROGMEM = {
+{
+0x98, 0x17, 0xf8, 0x16, 0x5b, 0x81, 0xf2, 0x59,
+0xd9, 0x28, 0xce, 0x2d, 0xdb, 0xfc, 0x9b, 0x02,
+0x07, 0x0b, 0x87, 0xce, 0x95, 0x62, 0xa0, 0x55,
+0xac, 0xbb, 0xdc, 0xf9, 0x7e, 0x66, 0xbe, 0x79,
+0xb8, 0xd4, 0x10, 0xfb, 0x8f, 0xd0, 0x47, 0x9c,
+0x19, 0x54, 0x85, 0xa6, 0x48, 0xb4, 0x17, 0xfd,
+0xa8, 0x08, 0x11, 0x0e, 0xfc, 0xfb, 0xa4, 0x5d,
+0x65, 0xc4, 0xa3, 0x26, 0x77, 0xda, 0x3a, 0x48},
+{
+0x59, 0x83, 0xff, 0x43, 0x60, 0xb0, 0x48, 0x60,
+0x51, 0x76, 0x5e, 0xc6, 0x1d, 0x82, 0xb4, 0x46,
+0x14, 0xa0, 0x1d, 0xc2, 0xb5, 0x82, 0xd2, 0xb7,
+0x53, 0xd2, 0x7b, 0x9f, 0x62, 0xb3, 0xb7, 0xa2,
+0xc2, 0xfe, 0x86, 0xfe, 0xec, 0x7f, 0x39, 0xa2,
+0x35, 0x38, 0x6f, 0x04, 0x35, 0x08, 0xd1, 0x10,
+0xc9, 0x29, 0x1e, 0xf7, 0xa3, 0x37, 0xa9, 0x57,
+0x2d, 0x12, 0x95, 0x16, 0x94, 0x38, 0x30, 0x69},
+{
+0x04, 0xd3, 0x0f, 0xb1, 0x57, 0xd0, 0x27, 0xbe,
+0x26, 0x3a, 0x7f, 0x34, 0x38, 0x06, 0x96, 0x86,
+0xad, 0xa8, 0xe4, 0x18, 0xd6, 0xb2, 0xd0, 0x8c,
+0xd4, 0x88, 0x4d, 0x8b, 0x54, 0xd5, 0x76, 0x65,
+0x7e, 0x5a, 0xb3, 0x74, 0xf6, 0xfb, 0x14, 0x32,
+0x3c, 0xa5, 0xdc, 0x19, 0xff, 0xc8, 0x91, 0xde,
+0xcd, 0xa2, 0x71, 0x74, 0xbd, 0x82, 0xa2, 0x4b,
+0x39, 0x8c, 0x1e, 0x3a, 0x3e, 0xe6, 0x81, 0xb4},
+{
+0xdc, 0xa4, 0xbf, 0xdf, 0xe4, 0x06, 0x67, 0x47,
+0x17, 0x5b, 0xc8, 0x04, 0x78, 0x8a, 0x94, 0xf5,
+0x1f, 0xb4, 0xdb, 0x7a, 0x9d, 0x11, 0x92, 0x83,
+0x19, 0xea, 0x1f, 0x73, 0x90, 0x85, 0x78, 0xd6,
+0x06, 0x54, 0x3b, 0xbd, 0x6b, 0xcd, 0x7b, 0xca,
+0x7c, 0xa0, 0xc9, 0xdd, 0xc4, 0xf1, 0x06, 0x62,
+0xaa, 0x13, 0x1c, 0xd2, 0xc6, 0xf5, 0x0e, 0x94,
+0xc4, 0x63, 0x50, 0x9d, 0xc8, 0xa8, 0xea, 0x28},
+{
+0x96, 0x61, 0x86, 0xf7, 0xc8, 0xfc, 0x73, 0x3e,
+0xaa, 0xf4, 0xb3, 0x81, 0x36, 0x1c, 0xe2, 0x25,
+0x07, 0xae, 0x39, 0x93, 0x80, 0x5e, 0x56, 0x52,
+0xc0, 0x3c, 0x1e, 0x89, 0xab, 0x7e, 0xc4, 0x29,
+0xcd, 0x3d, 0xac, 0x26, 0xa9, 0x8a, 0x9d, 0x3d,
+0xdf, 0x0f, 0xf1, 0x2f, 0x5b, 0x81, 0x49, 0x3e,
+0xf4, 0x3e, 0xca, 0x6a, 0xec, 0x8d, 0x5a, 0xd5,
+0xf0, 0x3d, 0xb8, 0x88, 0xb7, 0x94, 0x0d, 0x4e},
+{
+0x47, 0xc8, 0xec, 0xed, 0x08, 0x50, 0x37, 0xea,
+0x4c, 0xa0, 0x44, 0x58, 0xfb, 0xef, 0x9f, 0x30,
+0xe0, 0xf7, 0x58, 0xcf, 0xe4, 0x37, 0x0a, 0x17,
+0x62, 0x19, 0xd3, 0x1a, 0x85, 0x12, 0x3c, 0xf7,
+0xe2, 0x70, 0x5d, 0x4b, 0xdb, 0x14, 0xf7, 0x2c,
+0x4f, 0x86, 0xb6, 0x17, 0xdf, 0xbe, 0xed, 0x99,
+0x81, 0x25, 0x0d, 0x3e, 0x7d, 0x8a, 0x3a, 0x8c,
+0x14, 0xb1, 0xc6, 0x59, 0x27, 0x9e, 0x6b, 0x50},
+{
+0xb1, 0xe6, 0x7f, 0x2b, 0xc4, 0xf9, 0x6f, 0x8f,
+0x30, 0xd4, 0xde, 0x65, 0xb0, 0xb5, 0x47, 0xa6,
+0x4b, 0x5f, 0xaa, 0x29, 0x26, 0xc3, 0x53, 0x5d,
+0xc5, 0x26, 0xd3, 0x63, 0x72, 0xe1, 0xa2, 0xce,
+0xd1, 0x7b, 0xcf, 0xb3, 0xe5, 0x11, 0x51, 0x7e,
+0xa7, 0x47, 0xc5, 0x99, 0xa2, 0x7f, 0x15, 0x2c,
+0xe4, 0xb9, 0x51, 0xc2, 0xab, 0x42, 0x4e, 0x88,
+0x6f, 0xd9, 0x97, 0x9b, 0xb5, 0x5d, 0x68, 0x31},
+{
+0x76, 0x70, 0xf2, 0x4c, 0xf8, 0x7d, 0x84, 0xe6,
+0xae, 0x7e, 0x62, 0xe7, 0xad, 0x58, 0x98, 0xd8,
+0x59, 0xaf, 0xd9, 0x7f, 0xe7, 0xeb, 0xaf, 0xfc,
+0x58, 0x81, 0x4e, 0x78, 0xfd, 0xae, 0x49, 0x4d,
+0x1e, 0x78, 0xaa, 0x03, 0x62, 0xb6, 0x90, 0x6b,
+0x46, 0xd8, 0xf4, 0x7d, 0x1a, 0x2d, 0x0f, 0x6e,
+0xf0, 0xa6, 0x9c, 0x35, 0x10, 0xf2, 0x23, 0xe7,
+0x35, 0xd1, 0x0d, 0xa1, 0x59, 0xfc, 0x32, 0xcd},
+{
+0x45, 0x9a, 0x27, 0xce, 0x89, 0x79, 0x2f, 0x04,
+0xbf, 0x23, 0x0f, 0x27, 0xa8, 0x0f, 0x8b, 0xea,
+0xd6, 0x23, 0x26, 0xbd, 0xe5, 0x7c, 0x5c, 0x50,
+0xc6, 0x23, 0x01, 0xcd, 0x87, 0x45, 0x0e, 0x2c,
+0xa8, 0x8d, 0x85, 0x79, 0xed, 0x91, 0x54, 0xaa,
+0xbe, 0x8e, 0x34, 0xc5, 0xf3, 0xdb, 0x81, 0xc8,
+0xeb, 0x01, 0x68, 0x94, 0x5c, 0xaa, 0x5b, 0xf4,
+0x62, 0x27, 0xd4, 0x07, 0x27, 0x61, 0x2f, 0xa0},
+{
+0x27, 0xf8, 0x56, 0x7f, 0x53, 0xaf, 0x35, 0x00,
+0xa6, 0xe9, 0x53, 0xd2, 0x81, 0xfc, 0x44, 0x83,
+0x76, 0x2f, 0xe9, 0x99, 0x6a, 0x1b, 0x8f, 0xca,
+0x52, 0xa9, 0xd4, 0x3c, 0xc1, 0x7f, 0xb9, 0xdc,
+0x3d, 0x7c, 0xb6, 0x87, 0x4e, 0x4b, 0x0a, 0x16,
+0x30, 0x61, 0x8c, 0x40, 0x4b, 0x3f, 0x44, 0x42,
+0x14, 0x1d, 0xc0, 0x12, 0x12, 0x05, 0x19, 0x0a,
+0x7b, 0x73, 0x5d, 0xff, 0x69, 0xd1, 0xfb, 0x2e},
+{
+0x0a, 0x1f, 0xf4, 0x16, 0xba, 0x69, 0x55, 0x35,
+0x70, 0x0c, 0x85, 0xa5, 0x05, 0xbb, 0x1e, 0x4d,
+0x8a, 0x5d, 0xe5, 0x57, 0x98, 0x76, 0x95, 0x5a,
+0x33, 0xd8, 0xe7, 0x1c, 0xf8, 0xe5, 0x43, 0x25,
+0x8c, 0x23, 0x96, 0x05, 0xa0, 0x13, 0xe9, 0x50,
+0xdd, 0xc3, 0xbf, 0x2f, 0x31, 0x40, 0x0e, 0xef,
+0xad, 0x34, 0x36, 0x57, 0x66, 0xb5, 0x3e, 0xc2,
+0x1f, 0x88, 0x3c, 0x17, 0x33, 0x05, 0xf0, 0x9a},
+{
+0x60, 0x59, 0xb4, 0x74, 0x43, 0xa8, 0xb3, 0xe0,
+0xa8, 0xf5, 0x3d, 0x72, 0x46, 0x1c, 0x67, 0x76,
+0x7f, 0xa3, 0x1c, 0xc6, 0x17, 0x95, 0x42, 0xd2,
+0x24, 0xbe, 0x68, 0xbb, 0x13, 0x8b, 0xe0, 0xe5,
+0xc6, 0xcf, 0x90, 0x69, 0x9c, 0x63, 0xaf, 0x1c,
+0xf0, 0xcf, 0xba, 0xaa, 0xe7, 0xb8, 0x50, 0xf1,
+0x68, 0x6c, 0xa7, 0x19, 0x9e, 0x20, 0xec, 0xe2,
+0xa9, 0x29, 0x23, 0x39, 0x38, 0x0d, 0xe0, 0xea},
+{
+0xda, 0xe9, 0xe4, 0x78, 0x21, 0x2e, 0xac, 0xf4,
+0x67, 0xc8, 0x3d, 0xd3, 0x70, 0xd8, 0xb8, 0x37,
+0xa9, 0x6e, 0xba, 0x39, 0xe4, 0x13, 0x08, 0xb7,
+0xac, 0x0b, 0x0c, 0x7d, 0x04, 0xce, 0x56, 0x3d,
+0x31, 0x5f, 0x00, 0x6e, 0xc7, 0x05, 0x72, 0x1a,
+0xfa, 0x0e, 0xbf, 0x0b, 0x92, 0x18, 0x5b, 0x0b,
+0xab, 0x28, 0xd9, 0x79, 0xbb, 0xd9, 0xb4, 0x8a,
+0xd6, 0x16, 0xb1, 0x2c, 0x97, 0x98, 0x50, 0x42},
+{
+0xd6, 0x56, 0x2a, 0xcc, 0x1c, 0x94, 0x30, 0x8c,
+0xba, 0x17, 0x4c, 0x00, 0x85, 0x82, 0xec, 0xa0,
+0xd1, 0xd6, 0x04, 0xa7, 0xc0, 0x07, 0x4f, 0xb5,
+0xf7, 0x9b, 0xfe, 0x14, 0x0e, 0x95, 0x2d, 0x40,
+0x94, 0x7a, 0xd3, 0xff, 0xc7, 0x6e, 0x29, 0x78,
+0xc1, 0x3a, 0xa0, 0xb7, 0xe1, 0x98, 0x32, 0xbe,
+0x52, 0x28, 0x12, 0x07, 0xef, 0xc0, 0xbb, 0x72,
+0x7c, 0x06, 0x4e, 0xa0, 0x8f, 0xe9, 0xea, 0x92},
+{
+0x20, 0xba, 0xcf, 0xfa, 0x66, 0x61, 0x77, 0xbd,
+0x91, 0xf4, 0xb1, 0x32, 0x62, 0x41, 0xa9, 0xbd,
+0x6d, 0xd6, 0x09, 0x79, 0xa1, 0xa1, 0xd8, 0x25,
+0x80, 0xf3, 0x92, 0x21, 0xd8, 0x5d, 0xd8, 0x8f,
+0x8d, 0xd6, 0x75, 0x12, 0x3b, 0x97, 0xf5, 0x0b,
+0xb6, 0x9a, 0x5b, 0x7b, 0x19, 0xc7, 0x56, 0xca,
+0xe9, 0xb9, 0x3f, 0xcb, 0x4f, 0xb3, 0x4c, 0x14,
+0xf6, 0xff, 0xb2, 0xaf, 0x91, 0x05, 0xe0, 0x90},
+{
+0x71, 0xad, 0x58, 0xbe, 0x89, 0x38, 0x76, 0x8f,
+0x20, 0x3a, 0x9a, 0xcf, 0xf5, 0xd1, 0x30, 0xbb,
+0x38, 0x8c, 0xde, 0x29, 0x96, 0xfe, 0x05, 0x0a,
+0xe3, 0xc3, 0xde, 0x28, 0x8c, 0xa7, 0x78, 0x77,
+0xac, 0x43, 0x9f, 0xfd, 0xc1, 0x3f, 0x51, 0x3b,
+0x56, 0xac, 0x24, 0xff, 0x11, 0x84, 0xb3, 0x87,
+0x00, 0x58, 0xff, 0xf2, 0x12, 0x8e, 0x09, 0xf7,
+0x2f, 0xb2, 0xa5, 0xb5, 0x9a, 0x6d, 0x62, 0x34},
+{
+0x67, 0x13, 0xed, 0x48, 0xdd, 0x72, 0xb0, 0x92,
+0x97, 0x12, 0x03, 0x3d, 0xdd, 0xce, 0x02, 0x9c,
+0x7e, 0x94, 0x8e, 0xb3, 0xa0, 0xa5, 0xb0, 0xfd,
+0x07, 0x66, 0x2f, 0xa8, 0x80, 0x75, 0x20, 0x0d,
+0x8e, 0xd2, 0x93, 0xf6, 0x26, 0x73, 0x60, 0x97,
+0x5f, 0x04, 0xd7, 0x73, 0xd4, 0xe9, 0xf8, 0x4b,
+0x21, 0xa8, 0x06, 0x78, 0x5e, 0x10, 0x9d, 0x24,
+0xe6, 0x5a, 0x2e, 0x9f, 0x8e, 0x57, 0x6f, 0x7f},
+{
+0xa8, 0xb0, 0x5c, 0xb1, 0xca, 0x4a, 0xc7, 0xe1,
+0xf2, 0x20, 0xaf, 0x59, 0x70, 0x6c, 0x7e, 0x55,
+0x0d, 0x83, 0xdd, 0x33, 0x82, 0xad, 0xce, 0x02,
+0x3f, 0xaf, 0xba, 0xf4, 0x4a, 0x63, 0xa4, 0x42,
+0x3c, 0x51, 0xda, 0xe0, 0xf5, 0xcc, 0xf7, 0xb2,
+0xa9, 0xc0, 0x8f, 0x63, 0x59, 0x5d, 0xfa, 0xf4,
+0xce, 0x43, 0x9f, 0xa3, 0xa3, 0x23, 0xdc, 0x8c,
+0xb0, 0x89, 0x1e, 0x81, 0x4b, 0x26, 0x39, 0xb2},
+{
+0x95, 0x24, 0xe8, 0x48, 0x51, 0x19, 0x0f, 0xb3,
+0x7a, 0xde, 0x0a, 0x98, 0x87, 0x67, 0x7f, 0x0f,
+0xb5, 0x26, 0x72, 0x8f, 0x50, 0xd0, 0x1e, 0xed,
+0xa7, 0x13, 0x8c, 0xfa, 0x0e, 0x4e, 0x96, 0xc1,
+0x2c, 0x5f, 0xab, 0xdd, 0x7c, 0x05, 0x8b, 0x24,
+0x01, 0x5b, 0xe3, 0x5e, 0x62, 0xe3, 0xd4, 0x74,
+0x4c, 0x22, 0x8e, 0x3b, 0xbf, 0x9b, 0x01, 0x9b,
+0xfe, 0x1f, 0xc2, 0x01, 0x16, 0x05, 0xc3, 0x9b},
+{
+0x42, 0xe2, 0x66, 0x1d, 0x55, 0x28, 0xa0, 0xaa,
+0x20, 0x4e, 0xe6, 0xe3, 0x5e, 0x89, 0x14, 0xd1,
+0x63, 0xf1, 0x1f, 0x98, 0x9d, 0x40, 0xe1, 0xa4,
+0x63, 0x31, 0x37, 0x59, 0xdc, 0x6c, 0x63, 0x7c,
+0xe3, 0x6b, 0xa8, 0xbd, 0x0e, 0x13, 0xe7, 0x22,
+0xdc, 0x11, 0xc4, 0xe9, 0xde, 0x62, 0x20, 0x77,
+0x16, 0x1c, 0x6a, 0xfd, 0xef, 0xc1, 0xe6, 0x3b,
+0x72, 0xc2, 0x2c, 0x95, 0xe2, 0xa8, 0x74, 0x72},
+{
+0x68, 0xea, 0x2a, 0x1b, 0x26, 0x85, 0x66, 0xf9,
+0x81, 0xa3, 0xad, 0x3f, 0x2b, 0xbc, 0xac, 0x6f,
+0x3e, 0x51, 0xcd, 0x23, 0xef, 0x4b, 0x13, 0xce,
+0x7b, 0xca, 0x35, 0xfa, 0x5c, 0xfc, 0xab, 0xc7,
+0x1c, 0x8c, 0x65, 0x92, 0xd1, 0xab, 0xb5, 0xa1,
+0xb0, 0x0e, 0x9d, 0xd1, 0x30, 0xb7, 0x85, 0xbc,
+0xc5, 0xcc, 0xa3, 0x29, 0xa0, 0xfb, 0xc5, 0xcf,
+0xd9, 0x55, 0xf7, 0x38, 0xf1, 0xb7, 0x58, 0x87},
+{
+0x97, 0x76, 0x77, 0xeb, 0xd9, 0x2d, 0xb5, 0x6e,
+0x65, 0x3c, 0x33, 0x55, 0x87, 0xca, 0x30, 0x8e,
+0x35, 0x69, 0x49, 0xbd, 0xac, 0xad, 0xc4, 0x2e,
+0x1f, 0xc6, 0x38, 0x51, 0x7b, 0x10, 0x78, 0x02,
+0xa9, 0x31, 0xfc, 0x00, 0x35, 0xd7, 0x9b, 0x80,
+0xba, 0x17, 0x7f, 0x90, 0x64, 0xe0, 0x50, 0xd4,
+0x9f, 0xf9, 0x27, 0x09, 0x80, 0x26, 0xe6, 0xb4,
+0xa7, 0x82, 0x02, 0x28, 0x0e, 0x26, 0xfe, 0xb5},
+{
+0x0d, 0x0a, 0x7b, 0x95, 0x48, 0x36, 0x66, 0x30,
+0x45, 0x37, 0x64, 0xf7, 0x55, 0xb6, 0xd9, 0xf0,
+0x91, 0x48, 0x61, 0x46, 0x46, 0x0c, 0x0b, 0x2a,
+0x25, 0x3f, 0x4e, 0x2c, 0x24, 0x4e, 0xe9, 0x40,
+0x05, 0x3e, 0x0e, 0xa6, 0xf5, 0xf6, 0x58, 0x8d,
+0x6c, 0xd6, 0xa1, 0xe5, 0x6f, 0x1d, 0x73, 0x6d,
+0xdf, 0x84, 0x3e, 0xbd, 0x1d, 0x8e, 0xe0, 0xec,
+0x23, 0x5c, 0x74, 0xab, 0x13, 0xe3, 0x9e, 0x16},
+{
+0x67, 0x48, 0x54, 0x15, 0xf4, 0xde, 0x05, 0x40,
+0x3c, 0x86, 0x03, 0x44, 0x51, 0x3d, 0x13, 0x41,
+0xe4, 0x58, 0x5f, 0xb1, 0xdc, 0xfb, 0xe4, 0xc0,
+0x99, 0x8a, 0x95, 0x3d, 0x97, 0xd6, 0x67, 0x5e,
+0xcf, 0xe2, 0x26, 0xde, 0x8e, 0x4e, 0x0a, 0x41,
+0x92, 0x37, 0x70, 0x82, 0x5f, 0xff, 0x2d, 0x29,
+0xa9, 0x3b, 0x84, 0xd4, 0x44, 0xd1, 0x43, 0xe0,
+0xe9, 0x01, 0x13, 0xa6, 0x49, 0xc1, 0x22, 0x1d},
+{
+0x71, 0x36, 0xd6, 0x35, 0xc7, 0x81, 0xfa, 0x87,
+0xa9, 0x49, 0xeb, 0xf2, 0x62, 0x53, 0x88, 0x64,
+0xc1, 0xb3, 0x7e, 0x3d, 0x7f, 0x48, 0xeb, 0xf5,
+0xdf, 0x84, 0x7b, 0x45, 0xe5, 0xea, 0xa5, 0xf1,
+0xa7, 0xdc, 0x57, 0xaf, 0x95, 0x4b, 0x66, 0x1f,
+0xc2, 0xaf, 0x62, 0x1b, 0x9c, 0xce, 0x94, 0xa3,
+0x91, 0x81, 0x2c, 0xa2, 0xfe, 0x40, 0x89, 0x9a,
+0xb4, 0xb5, 0x8c, 0xcb, 0x38, 0xc9, 0xeb, 0x0a},
+{
+0x98, 0x82, 0x8c, 0xbb, 0x1e, 0x3e, 0x17, 0xda,
+0x03, 0x72, 0x64, 0xac, 0x3a, 0x3e, 0x57, 0xe4,
+0xc8, 0x28, 0x6e, 0xac, 0x50, 0x34, 0xd5, 0x2b,
+0x84, 0xba, 0x01, 0x76, 0x71, 0xa7, 0x7e, 0xfa,
+0x0c, 0x27, 0xf4, 0xd1, 0x78, 0x76, 0x9d, 0xfd,
+0x9b, 0xa8, 0x3f, 0x06, 0x96, 0xed, 0x2b, 0x43,
+0xae, 0x23, 0x2b, 0xeb, 0x88, 0xf8, 0x1a, 0xd7,
+0x3e, 0xfd, 0x20, 0xc6, 0x10, 0xb8, 0x11, 0xdb},
+{
+0x30, 0xa2, 0x53, 0x01, 0x8f, 0x5b, 0x20, 0x76,
+0x21, 0x1a, 0xdd, 0x20, 0x6f, 0xf8, 0xb7, 0xe7,
+0x7e, 0xc3, 0xc0, 0x83, 0x6d, 0x5d, 0xae, 0xd3,
+0x7d, 0x82, 0xc2, 0x32, 0xa5, 0x48, 0x10, 0x5c,
+0x33, 0xa5, 0x73, 0xbc, 0xd1, 0xd4, 0xf3, 0x2c,
+0xad, 0xb3, 0xa8, 0x98, 0x41, 0xb6, 0xff, 0x91,
+0xd0, 0x2a, 0x3e, 0x0f, 0xc7, 0x69, 0x24, 0xbf,
+0x91, 0xc8, 0x80, 0x26, 0x33, 0xfc, 0x59, 0x68},
+{
+0x25, 0x7a, 0x08, 0x34, 0xe9, 0x13, 0x9a, 0xe1,
+0xe7, 0x17, 0xc2, 0x1e, 0x0d, 0x00, 0x48, 0x6e,
+0x04, 0x04, 0xf2, 0x7a, 0x48, 0x6a, 0x64, 0x30,
+0x55, 0xbc, 0xd1, 0xdb, 0xcd, 0x05, 0x3e, 0xd4,
+0xbc, 0x39, 0xe4, 0x86, 0xb9, 0xfa, 0xfe, 0x70,
+0x1c, 0xdc, 0x20, 0x13, 0x71, 0x6a, 0xf6, 0x67,
+0x9f, 0xc1, 0x83, 0x24, 0x42, 0xb2, 0xb7, 0xd0,
+0x17, 0x92, 0x08, 0x58, 0x25, 0x00, 0xee, 0x0a},
+{
+0x26, 0x10, 0x0f, 0x71, 0x19, 0xc4, 0xc3, 0xdd,
+0x4a, 0x7c, 0x26, 0xca, 0x62, 0x23, 0x6f, 0x94,
+0x90, 0xc1, 0x53, 0xa7, 0x08, 0xb8, 0x04, 0x06,
+0xe7, 0xe2, 0xce, 0xfe, 0x13, 0xbb, 0x34, 0x0a,
+0x96, 0x45, 0x7b, 0x83, 0x51, 0x05, 0x66, 0xbc,
+0x58, 0x75, 0xe1, 0x0e, 0xfe, 0x1c, 0x41, 0xd9,
+0x55, 0x0f, 0x5f, 0xc1, 0x02, 0xaf, 0x1e, 0x0c,
+0x3c, 0x90, 0x8a, 0xe0, 0x2c, 0x73, 0x69, 0x1d},
+{
+0x99, 0xd4, 0x54, 0xe9, 0xe5, 0x08, 0xdc, 0x18,
+0x20, 0xc1, 0x5f, 0x3b, 0x0f, 0xc6, 0xd0, 0x1a,
+0x85, 0xf5, 0x7c, 0xf9, 0xd2, 0x34, 0x7e, 0x38,
+0xb5, 0x9a, 0xe0, 0xa6, 0xeb, 0x18, 0xb6, 0xdd,
+0xd3, 0x5d, 0xcb, 0x0a, 0x3f, 0x97, 0x60, 0xeb,
+0x2b, 0x81, 0x70, 0xd7, 0x9e, 0xb2, 0xab, 0x54,
+0x95, 0xdb, 0x92, 0x71, 0xc6, 0x95, 0x20, 0x8c,
+0x78, 0x19, 0x22, 0x6d, 0x0c, 0xf3, 0x59, 0x74},
+{
+0x70, 0x6a, 0x50, 0x48, 0xcf, 0x5f, 0x21, 0x4b,
+0xac, 0x1f, 0x27, 0xe7, 0x9a, 0xbf, 0x58, 0x87,
+0x2b, 0xbb, 0xca, 0xc0, 0xa2, 0xfb, 0x70, 0xad,
+0xfe, 0xf3, 0x06, 0x1d, 0x9f, 0xc3, 0x7a, 0x0e,
+0xa9, 0xe7, 0x0a, 0x10, 0x0e, 0xfa, 0x55, 0x14,
+0x81, 0x7a, 0x3c, 0x76, 0x41, 0x47, 0x46, 0x93,
+0x92, 0x78, 0xcd, 0xed, 0xea, 0xc5, 0x0a, 0x2d,
+0x8d, 0xa2, 0xc7, 0x94, 0x99, 0x78, 0x71, 0x25},
+{
+0xf1, 0x64, 0x6b, 0xb2, 0x44, 0x99, 0xf3, 0x5c,
+0x99, 0x6d, 0x47, 0xf5, 0x28, 0xcf, 0xed, 0xb7,
+0x9d, 0xe5, 0x11, 0x25, 0xc6, 0xa4, 0xcd, 0xd4,
+0x10, 0xf0, 0x58, 0x1b, 0x7f, 0x40, 0x75, 0x71,
+0xd5, 0x34, 0x42, 0xb2, 0xfa, 0x7e, 0x6e, 0x42,
+0x2a, 0x1d, 0x47, 0x74, 0xb7, 0xe8, 0x1f, 0xb0,
+0x6e, 0xc8, 0x4c, 0x13, 0x01, 0x34, 0x6d, 0xf3,
+0x50, 0xd5, 0xe3, 0x44, 0x43, 0x55, 0xb4, 0x43},
+{
+0xef, 0x52, 0x09, 0x70, 0xcc, 0xdd, 0xf3, 0xae,
+0x41, 0x91, 0xca, 0x53, 0xbd, 0xf9, 0x97, 0x32,
+0xda, 0xea, 0x3a, 0x55, 0xd1, 0x8f, 0xd2, 0x2d,
+0x8e, 0xd4, 0xcc, 0xb0, 0xb6, 0x17, 0xc8, 0x1c,
+0x8e, 0x53, 0x7f, 0x12, 0x83, 0xdd, 0xb1, 0x26,
+0x22, 0x6a, 0x3d, 0x78, 0xdd, 0x09, 0xe3, 0xcb,
+0x5a, 0x3d, 0x03, 0x75, 0x3c, 0x28, 0x44, 0xe4,
+0x9c, 0xc2, 0x85, 0xda, 0xc7, 0x58, 0x3e, 0x1e},
+{
+0x15, 0x11, 0x72, 0xd7, 0x9b, 0x15, 0x84, 0x58,
+0xc1, 0x6d, 0xe1, 0xb8, 0x10, 0x48, 0x66, 0xb3,
+0x2f, 0xa6, 0x35, 0x61, 0x53, 0x9d, 0x81, 0xfa,
+0x87, 0xdb, 0x7d, 0x21, 0x4d, 0xc1, 0xca, 0x60,
+0x82, 0xe4, 0x69, 0xfb, 0x71, 0x34, 0x5e, 0x4b,
+0xd2, 0xca, 0x0b, 0xd2, 0x63, 0x0d, 0x33, 0x5d,
+0xd0, 0xf1, 0x76, 0x69, 0xd2, 0xe5, 0x5e, 0x45,
+0x44, 0xe4, 0x25, 0x4e, 0x35, 0xb9, 0xfe, 0xc2},
+{
+0xad, 0xac, 0x9b, 0x95, 0x00, 0x85, 0xd4, 0x53,
+0x3d, 0x2a, 0x2a, 0x60, 0x7a, 0x12, 0x9b, 0x33,
+0x81, 0xcb, 0x41, 0xe6, 0xf4, 0xbe, 0x48, 0x14,
+0x3e, 0xae, 0x0d, 0x7e, 0x42, 0x3f, 0xa5, 0xef,
+0x2a, 0xfd, 0x6a, 0xca, 0x5e, 0xa1, 0xa2, 0xcf,
+0x25, 0x9e, 0x1f, 0x89, 0x47, 0xc8, 0xd7, 0x25,
+0xf7, 0x9d, 0x94, 0xdd, 0x70, 0x7e, 0xa2, 0x07,
+0xc7, 0x65, 0xbb, 0xa2, 0xe1, 0xba, 0x5b, 0x6f},
+{
+0xdd, 0xe5, 0xcb, 0x3d, 0xea, 0xde, 0xa3, 0x7c,
+0xfb, 0xb4, 0x3e, 0xd0, 0xb5, 0x7d, 0xe6, 0xac,
+0xd5, 0xc4, 0x39, 0xbe, 0x33, 0x69, 0xc9, 0x1c,
+0x6d, 0xa1, 0x56, 0x7a, 0xb8, 0x89, 0x0e, 0xe1,
+0xcd, 0x06, 0x18, 0x3d, 0x43, 0x50, 0x9d, 0xb9,
+0x33, 0x6a, 0x46, 0xe1, 0xc5, 0x9a, 0x31, 0xe8,
+0x7a, 0x1e, 0x1b, 0x65, 0x13, 0xfa, 0x56, 0xae,
+0x19, 0xcb, 0x98, 0x44, 0x9d, 0xd1, 0x4c, 0x8e},
+{
+0x71, 0x0f, 0x2f, 0x12, 0x99, 0x51, 0x08, 0x4f,
+0x19, 0x36, 0x4b, 0x56, 0x1d, 0xf2, 0xbf, 0x98,
+0xf7, 0x44, 0x13, 0xea, 0x18, 0x49, 0x55, 0x3c,
+0x53, 0xf9, 0x29, 0xc7, 0xa6, 0x18, 0xf1, 0x80,
+0xa2, 0x9c, 0x1a, 0x1f, 0x60, 0x7c, 0x20, 0x26,
+0x3d, 0x56, 0xb6, 0x04, 0xa1, 0x24, 0x66, 0x2b,
+0xed, 0x7f, 0xde, 0x9d, 0x2f, 0x03, 0xaf, 0x92,
+0x48, 0xaf, 0x56, 0x77, 0x8c, 0x40, 0xc9, 0x43},
+{
+0x6c, 0x59, 0xa4, 0x76, 0x14, 0xd4, 0x3f, 0xe4,
+0xe9, 0xfb, 0xf4, 0x74, 0xed, 0x84, 0x79, 0xd0,
+0x71, 0xd2, 0x03, 0x1a, 0xcc, 0x44, 0x07, 0xe1,
+0x85, 0x8c, 0xa8, 0x1f, 0x59, 0xa9, 0xa3, 0x3f,
+0xa2, 0x42, 0x7b, 0x4a, 0x16, 0xf7, 0x42, 0x0d,
+0x54, 0x39, 0x88, 0x30, 0xa4, 0xfc, 0x89, 0xeb,
+0x67, 0x8f, 0x78, 0x3a, 0xb2, 0x18, 0xeb, 0xb1,
+0x21, 0xf1, 0x60, 0xbc, 0x22, 0xda, 0x47, 0x7d},
+{
+0xed, 0x81, 0xf7, 0x5f, 0x04, 0xc2, 0x08, 0x54,
+0x0e, 0x90, 0x87, 0x76, 0xa7, 0x05, 0x02, 0x67,
+0xb2, 0x53, 0x79, 0x11, 0x7c, 0x84, 0xf2, 0x44,
+0x0c, 0x51, 0x89, 0x97, 0x7a, 0x89, 0xc5, 0x38,
+0x68, 0x39, 0x6f, 0xfd, 0xc9, 0x87, 0xe3, 0x9f,
+0x1b, 0xfd, 0xae, 0x1c, 0x26, 0x48, 0xeb, 0xff,
+0x11, 0x73, 0xca, 0x23, 0x64, 0x31, 0x4d, 0x1b,
+0x09, 0x3c, 0xfb, 0x6d, 0xd5, 0x58, 0x78, 0x94},
+{
+0xed, 0xb9, 0xc1, 0x0c, 0x87, 0xa0, 0xb4, 0xcf,
+0xb2, 0xbe, 0x53, 0x6b, 0x62, 0xe8, 0xde, 0xa9,
+0xbc, 0x20, 0x16, 0xd5, 0xae, 0xe3, 0xd8, 0x0b,
+0xf2, 0xe5, 0x80, 0x09, 0xc8, 0x11, 0x7f, 0x6e,
+0x3e, 0x8b, 0xee, 0x07, 0x05, 0xa2, 0xc8, 0x28,
+0xb9, 0x24, 0x8e, 0x7c, 0xe5, 0x9a, 0x5f, 0xd0,
+0xd8, 0xf0, 0x55, 0xb3, 0x15, 0xa6, 0xd3, 0xde,
+0x26, 0xca, 0x8a, 0x3b, 0xf1, 0xb6, 0x98, 0x14},
+{
+0x91, 0xaf, 0xad, 0xfb, 0x43, 0xd1, 0xa6, 0xe6,
+0x48, 0x71, 0xe4, 0x39, 0x03, 0xf2, 0x5a, 0xe4,
+0x13, 0x9c, 0x4b, 0xd0, 0x74, 0x1b, 0xc6, 0x9b,
+0xf4, 0xae, 0x6e, 0xd2, 0x5f, 0x48, 0x92, 0x2f,
+0x26, 0x89, 0x2d, 0x19, 0x95, 0x37, 0x6a, 0x0b,
+0xfa, 0x99, 0x76, 0x4a, 0xad, 0x5c, 0x6b, 0x12,
+0xba, 0xf4, 0xc6, 0x7f, 0x33, 0x62, 0x17, 0x1a,
+0xa8, 0x4c, 0x82, 0xf3, 0x88, 0x0b, 0x07, 0x20},
+{
+0xa2, 0x68, 0xbb, 0xdf, 0xcf, 0x5e, 0x9b, 0xb7,
+0xbd, 0x9b, 0x27, 0x4f, 0xe9, 0x05, 0xde, 0xf6,
+0x7d, 0x84, 0x39, 0x7a, 0x8d, 0xd7, 0x06, 0xb9,
+0xbf, 0x28, 0xb9, 0x79, 0x2f, 0xc9, 0x7a, 0x19,
+0x0e, 0x2f, 0x91, 0x08, 0x7a, 0x62, 0x38, 0x6b,
+0x06, 0x6e, 0x09, 0xf2, 0x3b, 0x35, 0xda, 0x66,
+0x94, 0xfb, 0xf7, 0x80, 0xf1, 0x6f, 0x13, 0xdf,
+0xdc, 0xa5, 0xfb, 0xbd, 0xfe, 0x3f, 0x2b, 0xac},
+{
+0xba, 0xa0, 0xb8, 0x99, 0x6c, 0x2b, 0x8e, 0x5c,
+0xc2, 0xaf, 0x6e, 0x77, 0xbb, 0xaa, 0xcb, 0xd2,
+0x41, 0xc5, 0x6b, 0xbc, 0xc2, 0x24, 0x20, 0x1d,
+0x18, 0xdc, 0xd0, 0x90, 0x5a, 0xfd, 0xb0, 0x75,
+0xec, 0xe2, 0x9c, 0x60, 0x8e, 0xf1, 0x9e, 0xc0,
+0xf6, 0xd2, 0x31, 0x40, 0xeb, 0xe1, 0xb2, 0xfb,
+0x34, 0xf4, 0xf1, 0xfc, 0x4c, 0x73, 0x9d, 0xe5,
+0x58, 0x26, 0xbf, 0x58, 0x4b, 0xa4, 0xf9, 0x3c},
+{
+0xb7, 0x6b, 0xbf, 0xee, 0x90, 0x20, 0xa4, 0x7f,
+0xb4, 0x65, 0x85, 0x3e, 0x81, 0x08, 0x04, 0xae,
+0x84, 0xbf, 0x51, 0xae, 0xf6, 0x4c, 0x28, 0x09,
+0x11, 0x95, 0xa2, 0xe0, 0xa4, 0xb3, 0xb2, 0x27,
+0x0a, 0xec, 0x97, 0x13, 0xe5, 0x67, 0x8b, 0xc8,
+0x9b, 0x9c, 0x21, 0x1b, 0xb7, 0x3d, 0xbe, 0x7a,
+0x3a, 0xdb, 0xbc, 0xe3, 0x6d, 0xb6, 0x64, 0xae,
+0x0c, 0x80, 0x42, 0x69, 0xb4, 0x23, 0x0e, 0x80},
+{
+0xa6, 0x02, 0xb0, 0xae, 0x9d, 0x9c, 0xd5, 0x2c,
+0x4a, 0xd0, 0x32, 0x8e, 0xdb, 0x98, 0x2c, 0x5c,
+0x05, 0xaa, 0xf6, 0xed, 0x91, 0x9e, 0x90, 0xa7,
+0xdc, 0x16, 0x77, 0x45, 0xc6, 0xdd, 0x2d, 0x80,
+0x02, 0x4d, 0xa3, 0x20, 0xeb, 0x3a, 0xbb, 0xc1,
+0x58, 0x6c, 0xfd, 0xc7, 0x8a, 0xe0, 0x20, 0x99,
+0xa0, 0xe4, 0x1b, 0xd9, 0xea, 0x4f, 0x42, 0xe4,
+0x62, 0x8e, 0x84, 0xdb, 0x27, 0x7e, 0x6b, 0xd4},
+{
+0x36, 0xbe, 0x1d, 0x3c, 0xc6, 0xe2, 0xc5, 0xfb,
+0x7d, 0x8c, 0x9a, 0x49, 0xf2, 0x90, 0x43, 0x4e,
+0xb4, 0x71, 0xf7, 0x7e, 0x98, 0x9e, 0xb8, 0x09,
+0xfa, 0xf8, 0x2d, 0x4d, 0x31, 0x9e, 0x17, 0x03,
+0x2b, 0xad, 0xb5, 0x48, 0xbe, 0x1a, 0x87, 0x71,
+0x5e, 0xb1, 0xcb, 0x01, 0x6f, 0x67, 0x76, 0x22,
+0x12, 0x50, 0x93, 0x43, 0x32, 0x63, 0xbe, 0x0f,
+0xcb, 0x95, 0x3f, 0xb7, 0x20, 0x1b, 0x46, 0xfa},
+{
+0x95, 0x69, 0xd3, 0xc9, 0x14, 0xcc, 0xcd, 0x24,
+0xe6, 0xb6, 0x97, 0x3b, 0x7a, 0xa7, 0x82, 0xc3,
+0xb3, 0xef, 0xcd, 0xbc, 0x79, 0xd0, 0xa6, 0x85,
+0xe2, 0x67, 0x38, 0x69, 0x48, 0x16, 0xa6, 0x7a,
+0x90, 0x9e, 0x4e, 0xad, 0xc1, 0x3d, 0xa3, 0x6f,
+0x89, 0x0b, 0x21, 0x0c, 0x43, 0xb2, 0x15, 0x97,
+0x1c, 0x1d, 0x99, 0x99, 0xee, 0x7a, 0x1d, 0x6b,
+0xd6, 0xb7, 0xc3, 0x56, 0x06, 0xa7, 0x5e, 0x21},
+{
+0xa3, 0x0b, 0xe6, 0x5a, 0x78, 0xd0, 0x35, 0xbe,
+0xd6, 0xc6, 0x68, 0x53, 0x73, 0xbd, 0x17, 0x27,
+0x17, 0x02, 0x66, 0x1d, 0xc1, 0xeb, 0xfa, 0x20,
+0x64, 0xc4, 0xa4, 0x4e, 0xdb, 0x4a, 0xb4, 0x91,
+0x1b, 0xd7, 0xb7, 0x5e, 0xdd, 0x17, 0x02, 0xff,
+0x25, 0xdb, 0xac, 0xcb, 0x81, 0x4f, 0x86, 0x64,
+0x49, 0x16, 0xdb, 0x79, 0xd7, 0x43, 0x56, 0xfa,
+0x74, 0x47, 0x8a, 0xc5, 0x8c, 0xa6, 0xa2, 0xf9},
+{
+0x3d, 0x03, 0x76, 0x5d, 0x5d, 0x0d, 0x5b, 0x31,
+0xe7, 0xa2, 0xa2, 0x39, 0x2c, 0x52, 0x25, 0x17,
+0xdd, 0xc1, 0x70, 0x12, 0x89, 0x96, 0x13, 0x8e,
+0xb1, 0x5b, 0xe6, 0x77, 0x0e, 0x99, 0xcf, 0x97,
+0x89, 0x40, 0xd3, 0x64, 0x3c, 0x0e, 0x15, 0xab,
+0x92, 0xcd, 0x79, 0x0a, 0x4a, 0xe2, 0x27, 0xa4,
+0x4e, 0x02, 0xb4, 0x6e, 0x3c, 0x94, 0xa8, 0x66,
+0xb1, 0xf3, 0x9b, 0xf3, 0x6a, 0x12, 0x6f, 0x0c},
+{
+0x34, 0xcd, 0xa5, 0x8a, 0x3c, 0x27, 0x92, 0x24,
+0x2f, 0xed, 0xb1, 0xae, 0x26, 0x6c, 0x79, 0x1c,
+0x57, 0x1f, 0x71, 0x49, 0x49, 0x0b, 0xe6, 0xe6,
+0x26, 0x18, 0x55, 0x65, 0x46, 0x10, 0xb2, 0x10,
+0x13, 0x06, 0x68, 0x0c, 0x54, 0xa1, 0x42, 0xaf,
+0x39, 0xd9, 0xc8, 0x0f, 0x0c, 0x70, 0x5b, 0x6f,
+0xdc, 0x41, 0x0a, 0x7f, 0xa2, 0x59, 0x4f, 0xb1,
+0xe4, 0x9b, 0x2d, 0x09, 0x37, 0x8b, 0x49, 0xf5},
+{
+0x0d, 0x35, 0x99, 0x14, 0x7c, 0x6a, 0x75, 0x19,
+0xb0, 0x27, 0x61, 0x47, 0xc1, 0x3a, 0xe3, 0x0c,
+0x59, 0x10, 0xec, 0x2b, 0x23, 0x90, 0xbd, 0xdd,
+0x8d, 0xe5, 0xcc, 0xf5, 0xe6, 0x2f, 0xca, 0x6f,
+0x9f, 0xf1, 0xe0, 0x01, 0x3a, 0xf8, 0xf0, 0xe0,
+0xb1, 0x24, 0x3b, 0x3a, 0x5a, 0xc8, 0x3c, 0x90,
+0x2b, 0xb6, 0x9b, 0xf7, 0x64, 0x1b, 0xf6, 0xd1,
+0xf7, 0xad, 0x2d, 0x7b, 0x64, 0x22, 0xbf, 0x81},
+{
+0xfe, 0x57, 0xe7, 0xac, 0x0a, 0x9f, 0xc7, 0x28,
+0xef, 0x79, 0xca, 0x2d, 0x57, 0x14, 0x19, 0x75,
+0x33, 0x16, 0x76, 0x14, 0xbe, 0xbb, 0xa6, 0xd1,
+0x6b, 0x38, 0x71, 0x45, 0xe4, 0x32, 0xb8, 0x17,
+0x97, 0x05, 0x5b, 0xcb, 0x26, 0xcf, 0xa6, 0xf0,
+0xa5, 0x71, 0x39, 0xac, 0x6a, 0x24, 0xcf, 0x92,
+0x28, 0x3d, 0x3c, 0xc7, 0xc1, 0x75, 0x66, 0x4e,
+0xc9, 0xfc, 0xc5, 0x44, 0x36, 0xb5, 0x7a, 0x5a},
+{
+0xa7, 0x5b, 0x7e, 0x60, 0x60, 0x08, 0xb9, 0x40,
+0x9b, 0x54, 0xc5, 0xf5, 0xbf, 0x84, 0xa5, 0x1a,
+0x2c, 0xd9, 0x62, 0xe9, 0x5c, 0x6e, 0xf7, 0x57,
+0x44, 0x91, 0x4e, 0x2b, 0xfb, 0x5e, 0xd4, 0x60,
+0xd3, 0xe3, 0x17, 0x04, 0x0e, 0xaf, 0x84, 0xac,
+0x6c, 0x5b, 0xae, 0x0f, 0xad, 0x3d, 0x8e, 0x24,
+0x6e, 0x34, 0xa1, 0xe9, 0x61, 0x09, 0xee, 0x26,
+0x6c, 0x08, 0xa9, 0x8b, 0xbe, 0x90, 0xad, 0xca},
+{
+0x3d, 0x42, 0x4f, 0x40, 0x99, 0xd3, 0xd7, 0x8a,
+0xf7, 0xa5, 0xb8, 0x4a, 0x98, 0x85, 0x55, 0x59,
+0x3c, 0xf5, 0x6e, 0x27, 0xfa, 0xd3, 0x14, 0xf7,
+0x5b, 0x2a, 0xb3, 0xe3, 0xd7, 0x41, 0xc4, 0x71,
+0xb8, 0x8e, 0x38, 0x07, 0xc1, 0xd4, 0x5b, 0x49,
+0x6d, 0xcb, 0x2b, 0xc6, 0xd7, 0xb4, 0x4e, 0x16,
+0xda, 0x2c, 0xbb, 0x66, 0x81, 0xb9, 0x40, 0x51,
+0x6c, 0x89, 0x09, 0xe3, 0xaf, 0xd5, 0x42, 0xf6},
+{
+0xc1, 0xee, 0xae, 0x40, 0xce, 0xb0, 0xa6, 0xa1,
+0x26, 0xed, 0x52, 0x82, 0x97, 0x55, 0x1b, 0x86,
+0x49, 0xf8, 0xef, 0x78, 0xe2, 0x6d, 0x5f, 0x6c,
+0xa0, 0xae, 0xbd, 0x18, 0x6d, 0x44, 0xfb, 0xb0,
+0x4b, 0xcb, 0x52, 0xcc, 0x4e, 0x2e, 0x4c, 0xdd,
+0x62, 0x9a, 0x4f, 0xa9, 0x8c, 0x65, 0x4f, 0x61,
+0xc2, 0x23, 0x48, 0x73, 0x3e, 0x45, 0x02, 0x4a,
+0x54, 0x07, 0x57, 0xcb, 0x4f, 0x3f, 0x57, 0x44},
+{
+0xf6, 0x66, 0x2b, 0x9d, 0x7e, 0xb9, 0x47, 0x08,
+0x7a, 0x53, 0x0e, 0xae, 0xec, 0x06, 0x9a, 0xfd,
+0x30, 0x16, 0x12, 0xe4, 0x2a, 0xf8, 0x8a, 0xfb,
+0xa2, 0xf9, 0xd8, 0xe6, 0x87, 0x34, 0x5a, 0x2b,
+0x8f, 0x38, 0xfd, 0x07, 0x3a, 0x4c, 0xb9, 0x8b,
+0xb3, 0x4c, 0xa9, 0xb8, 0x37, 0xd0, 0xc3, 0x55,
+0x27, 0xa6, 0xac, 0xfa, 0x50, 0x26, 0x60, 0x53,
+0x81, 0x32, 0x0f, 0x8e, 0x2e, 0x4f, 0xea, 0x5b},
+{
+0x6c, 0x7b, 0x6e, 0x71, 0x2c, 0xa9, 0x2e, 0x79,
+0xff, 0x22, 0xc8, 0xb2, 0xaa, 0xd0, 0xa2, 0x91,
+0x4b, 0xa7, 0xe2, 0x45, 0x71, 0x12, 0xaf, 0x39,
+0xf6, 0xf5, 0xc8, 0x05, 0xff, 0x13, 0xc6, 0xad,
+0xf4, 0xcb, 0x00, 0xfb, 0x3e, 0x79, 0xd9, 0xe9,
+0xa7, 0xd7, 0xb4, 0x71, 0xcc, 0xa7, 0xb7, 0x31,
+0xc1, 0x03, 0x87, 0xe3, 0x04, 0x4c, 0x25, 0xb5,
+0xe9, 0x80, 0x22, 0xf2, 0x92, 0x9a, 0x7f, 0xc9},
+{
+0xfa, 0xa7, 0x67, 0x6f, 0xe7, 0x76, 0xee, 0xbc,
+0x60, 0x87, 0xb1, 0x93, 0xa3, 0xeb, 0xd7, 0x9e,
+0xa8, 0x03, 0x94, 0xa6, 0x09, 0x4f, 0x46, 0x2d,
+0xce, 0x30, 0x3c, 0xd0, 0x3f, 0xe2, 0xf4, 0xe0,
+0x6f, 0x77, 0xcd, 0x92, 0x77, 0x85, 0x93, 0x43,
+0x84, 0x0a, 0x65, 0x6d, 0x15, 0x13, 0xf5, 0xba,
+0xeb, 0x50, 0x1b, 0x56, 0x27, 0x6c, 0xaa, 0xf7,
+0xbe, 0x21, 0x8a, 0x36, 0xf2, 0x1b, 0x28, 0xf4},
+{
+0x59, 0x52, 0x60, 0x93, 0x32, 0x0c, 0x6e, 0x88,
+0x0b, 0xb9, 0x59, 0x8d, 0x8a, 0x12, 0xdf, 0x78,
+0x94, 0x30, 0x22, 0x40, 0x02, 0xa2, 0xeb, 0x93,
+0x7f, 0xef, 0x7b, 0x06, 0x14, 0x7f, 0xac, 0x37,
+0x4a, 0xe7, 0x29, 0xda, 0x5d, 0xbb, 0xbb, 0x83,
+0x01, 0x9b, 0x6e, 0xa7, 0x8f, 0x5f, 0x45, 0x5f,
+0xc4, 0xb4, 0xec, 0xb5, 0x33, 0x35, 0xba, 0x58,
+0xbd, 0xc6, 0xc1, 0x57, 0x1f, 0x32, 0x8e, 0x28},
+{
+0x95, 0x46, 0xf5, 0x59, 0xb9, 0x4c, 0x6d, 0x1a,
+0xec, 0xfe, 0x33, 0xa3, 0xb7, 0xbd, 0x32, 0x23,
+0x6a, 0x14, 0x2c, 0x87, 0xd0, 0xf4, 0xc5, 0x7f,
+0xcc, 0xa4, 0xf7, 0xca, 0xc1, 0xef, 0x3f, 0x2b,
+0x11, 0xaf, 0x9f, 0x70, 0x75, 0x4f, 0xd0, 0x15,
+0x40, 0x8b, 0x97, 0xf8, 0xac, 0x37, 0xf8, 0xea,
+0x28, 0x92, 0x90, 0x59, 0x97, 0x42, 0xb6, 0x28,
+0xd5, 0x2f, 0x60, 0x24, 0x3d, 0x32, 0xe6, 0x92},
+{
+0xe5, 0x59, 0xda, 0x95, 0x90, 0xb7, 0x71, 0x86,
+0x75, 0x85, 0x74, 0x0a, 0xf6, 0x4f, 0xa0, 0x7a,
+0x6e, 0xa2, 0xd6, 0xd5, 0x47, 0x99, 0xb5, 0xc9,
+0x3e, 0x5a, 0x89, 0x3b, 0x38, 0xee, 0x7d, 0x9e,
+0x5b, 0x48, 0xee, 0x53, 0x1a, 0xba, 0x0f, 0x3e,
+0x4f, 0xa8, 0x6c, 0x02, 0x21, 0x19, 0x4a, 0x35,
+0x2f, 0xcc, 0xc7, 0x0a, 0xc3, 0xb3, 0x1a, 0xdd,
+0xa4, 0x22, 0x07, 0x78, 0xfa, 0x1b, 0x83, 0x49},
+{
+0x44, 0x9f, 0xd7, 0x3c, 0x14, 0x9d, 0xd1, 0xf8,
+0x87, 0xbd, 0xd0, 0x59, 0xbe, 0xf6, 0xc9, 0x7b,
+0x60, 0x6c, 0xe3, 0x31, 0x77, 0x30, 0xad, 0xfa,
+0xb2, 0x5a, 0xc7, 0x90, 0x83, 0x62, 0x1e, 0x1c,
+0x9f, 0xff, 0x14, 0x37, 0x1e, 0xba, 0xa3, 0xbb,
+0x07, 0x9b, 0x96, 0x27, 0x0b, 0xb2, 0x7b, 0x1e,
+0x33, 0x11, 0x39, 0x4d, 0x91, 0x17, 0x3b, 0x52,
+0x16, 0xb3, 0x57, 0x9c, 0x42, 0xd2, 0xf4, 0xa7},
+{
+0xee, 0x0f, 0x53, 0x1f, 0x49, 0xad, 0xcc, 0x93,
+0x98, 0x1b, 0x3b, 0xfb, 0x7f, 0x1d, 0xe9, 0x5a,
+0x45, 0xbf, 0x91, 0xba, 0xfd, 0x93, 0x28, 0x14,
+0x39, 0xba, 0x0f, 0x57, 0xd2, 0x8a, 0x89, 0x25,
+0xe3, 0x80, 0x71, 0x1b, 0x82, 0x59, 0xaa, 0x0b,
+0x52, 0x4c, 0xc5, 0xc7, 0x4c, 0xe3, 0x89, 0x8a,
+0xdb, 0x03, 0x82, 0xf2, 0xd1, 0xaa, 0xd4, 0xc9,
+0x81, 0x76, 0x26, 0xb0, 0xd4, 0xb6, 0x88, 0x21}};
+
 /** Threshold value for High-S transactions */
 static const uint8_t high_s_threshold[32] = {
 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
@@ -156,12 +754,14 @@ static NOINLINE void jacobianToAffine(PointAffine *out, PointJacobian *in)
 	out->is_point_at_infinity = in->is_point_at_infinity;
 	// If out->is_point_at_infinity != 0, the rest of this function consists
 	// of dummy operations.
-	bigMultiply(s, in->z, in->z);
-	bigMultiply(t, s, in->z);
-	// Now s = z ^ 2 and t = z ^ 3.
-	bigInvert(s, s);
-	bigInvert(t, t);
-	bigMultiply(out->x, in->x, s);
+	// Only z is inverted; z ^ -2 and z ^ -3 are derived from z ^ -1. An
+	// inversion costs hundreds of multiplications, so this is much faster
+	// than inverting z ^ 2 and z ^ 3 separately.
+	bigInvert(s, in->z);
+	bigMultiply(t, s, s);
+	// Now s = z ^ -1 and t = z ^ -2.
+	bigMultiply(out->x, in->x, t);
+	bigMultiply(t, t, s);
 	bigMultiply(out->y, in->y, t);
 }
 
@@ -315,11 +915,46 @@ void setFieldToN(void)
 	bigSetField(secp256k1_n, secp256k1_complement_n, sizeof(secp256k1_complement_n));
 }
 
+/** Select one entry from a table of affine points. Every entry of the table
+  * is read, regardless of which one is selected, so that the memory access
+  * pattern does not depend on the (secret) index.
+  * \param out The selected point will be written here.
+  * \param table The table of points to select from.
+  * \param size The number of entries in the table.
+  * \param index The index of the entry to select. This must be less than
+  *              size.
+  */
+static void lookupPoint(PointAffine *out, PointAffine *table, uint8_t size, uint8_t index)
+{
+	uint8_t i;
+	uint8_t j;
+	uint8_t mask;
+
+	memset(out, 0, sizeof(PointAffine));
+	for (i = 0; i < size; i++)
+	{
+		// The following line does: "mask = (i == index) ? 0xff : 0;".
+		mask = (uint8_t)(((uint16_t)((i ^ index) - 1)) >> 8);
+		for (j = 0; j < 32; j++)
+		{
+			out->x[j] |= (uint8_t)(table[i].x[j] & mask);
+			out->y[j] |= (uint8_t)(table[i].y[j] & mask);
+		}
+		out->is_point_at_infinity |= (uint8_t)(table[i].is_point_at_infinity & mask);
+	}
+}
+
 /** Perform scalar multiplication (p = k x p) of the point p by the scalar k.
-  * The result will be stored back into p. The multiplication is
-  * accomplished by repeated point doubling and adding of the
-  * original point. All multi-precision integer operations are done under
-  * the prime finite field specified by #secp256k1_p.
+  * The result will be stored back into p. The multiplication uses a fixed
+  * window of #WINDOW_BITS bits: a table of the multiples
+  * 0, p, 2p, ..., (#WINDOW_SIZE - 1)p is built, then for each window of k
+  * (most significant first), the accumulator is doubled #WINDOW_BITS times
+  * and the table entry selected by the window is added. All multi-precision
+  * integer operations are done under the prime finite field specified by
+  * #secp256k1_p.
+  *
+  * If k is a private key and p is the base point, use pointMultiplyG()
+  * instead; it's several times faster.
   * \param p The point (in affine coordinates) to multiply.
   * \param k The 32 byte multi-precision scalar to multiply p by.
   */
@@ -327,41 +962,178 @@ void pointMultiply(PointAffine *p, BigNum256 k)
 {
 	PointJacobian accumulator;
 	PointJacobian junk;
-	PointAffine always_point_at_infinity; // for dummy operations
+	PointAffine table[WINDOW_SIZE];
+	PointAffine selected;
+	uint8_t z[WINDOW_SIZE][32];
+	uint8_t prefix[WINDOW_SIZE][32];
+	uint8_t inverse[32];
+	uint8_t z_inverse[32];
 	uint8_t i;
 	uint8_t j;
+	uint8_t l;
 	uint8_t one_byte;
-	uint8_t one_bit;
-	PointAffine *lookup_affine[2];
 
 	memset(&accumulator, 0, sizeof(PointJacobian));
 	memset(&junk, 0, sizeof(PointJacobian));
-	memset(&always_point_at_infinity, 0, sizeof(PointAffine));
+	memset(table, 0, sizeof(table));
+	setFieldToP();
+
+	// Build the table of multiples of p, in Jacobian coordinates at first.
+	// If p is the point at infinity, all entries will be flagged as the
+	// point at infinity and the rest of this consists of dummy operations.
+	table[0].is_point_at_infinity = 1;
+	memcpy(&(table[1]), p, sizeof(PointAffine));
+	affineToJacobian(&accumulator, p);
+	for (i = 2; i < WINDOW_SIZE; i++)
+	{
+		if (i == 2)
+		{
+			pointDouble(&accumulator);
+		}
+		else
+		{
+			pointAdd(&accumulator, &junk, p);
+		}
+		bigAssign(table[i].x, accumulator.x);
+		bigAssign(table[i].y, accumulator.y);
+		bigAssign(z[i], accumulator.z);
+		table[i].is_point_at_infinity = accumulator.is_point_at_infinity;
+	}
+
+	// Convert the table to affine coordinates. Converting each entry with
+	// jacobianToAffine() would cost one inversion per entry; instead,
+	// Montgomery's trick is used to get away with a single inversion.
+	// prefix[i] is the product of z[2], z[3], ..., z[i].
+	bigAssign(prefix[2], z[2]);
+	for (i = 3; i < WINDOW_SIZE; i++)
+	{
+		bigMultiply(prefix[i], prefix[i - 1], z[i]);
+	}
+	bigInvert(inverse, prefix[WINDOW_SIZE - 1]);
+	for (i = WINDOW_SIZE - 1; i >= 2; i--)
+	{
+		// inverse is now 1 / (z[2] * z[3] * ... * z[i]).
+		if (i == 2)
+		{
+			bigAssign(z_inverse, inverse);
+		}
+		else
+		{
+			bigMultiply(z_inverse, inverse, prefix[i - 1]);
+			bigMultiply(inverse, inverse, z[i]);
+		}
+		bigMultiply(z[i], z_inverse, z_inverse);
+		bigMultiply(table[i].x, table[i].x, z[i]);
+		bigMultiply(z[i], z[i], z_inverse);
+		bigMultiply(table[i].y, table[i].y, z[i]);
+	}
+
+	// Like the ladder this replaced, dummy operations (adding the point at
+	// infinity, which is table[0]) are used to make point multiplication a
+	// constant time operation. See the comments in pointMultiplyG() for
+	// caveats regarding fault analysis.
+	memset(&accumulator, 0, sizeof(PointJacobian));
+	accumulator.is_point_at_infinity = 1;
+	for (i = 31; i < 32; i--)
+	{
+		one_byte = k[i];
+		for (j = 0; j < (8 / WINDOW_BITS); j++)
+		{
+			for (l = 0; l < WINDOW_BITS; l++)
+			{
+				pointDouble(&accumulator);
+			}
+			lookupPoint(&selected, table, WINDOW_SIZE, (uint8_t)(one_byte >> (8 - WINDOW_BITS)));
+			pointAdd(&accumulator, &junk, &selected);
+			one_byte = (uint8_t)(one_byte << WINDOW_BITS);
+		}
+	}
+	jacobianToAffine(p, &accumulator);
+}
+
+/** Select one entry from #secp256k1_comb_table, in the same manner as
+  * lookupPoint(). Index 0 selects the point at infinity.
+  * \param out The selected point will be written here.
+  * \param index The index of the entry to select. This must be less than
+  *              2 ^ #COMB_TEETH.
+  */
+static void lookupCombPoint(PointAffine *out, uint8_t index)
+{
+	uint8_t i;
+	uint8_t j;
+	uint8_t mask;
+
+	memset(out, 0, sizeof(PointAffine));
+	for (i = 1; i < (1 << COMB_TEETH); i++)
+	{
+		// The following line does: "mask = (i == index) ? 0xff : 0;".
+		mask = (uint8_t)(((uint16_t)((i ^ index) - 1)) >> 8);
+		for (j = 0; j < 32; j++)
+		{
+			out->x[j] |= (uint8_t)(LOOKUP_BYTE(secp256k1_comb_table[i - 1][j]) & mask);
+			out->y[j] |= (uint8_t)(LOOKUP_BYTE(secp256k1_comb_table[i - 1][j + 32]) & mask);
+		}
+	}
+	// The following line does: "out->is_point_at_infinity = (index == 0) ? 1 : 0;".
+	out->is_point_at_infinity = (uint8_t)((((uint16_t)(index - 1)) >> 8) & 1);
+}
+
+/** Perform scalar multiplication (p = k x G) of the base point G by the
+  * scalar k. This is what's needed to compute a public key from a private
+  * key or the ephemeral point in ecdsaSign().
+  *
+  * This uses the comb method (see "Guide to Elliptic Curve Cryptography" by
+  * Hankerson, Menezes and Vanstone, algorithm 3.44). k is split into
+  * #COMB_TEETH rows of #COMB_SPACING bits each. Each column of bits forms an
+  * index into #secp256k1_comb_table, which was precomputed at compile time.
+  * So only #COMB_SPACING point doublings and #COMB_SPACING point additions
+  * are needed, instead of the 256 doublings that pointMultiply() requires.
+  * All multi-precision integer operations are done under the prime finite
+  * field specified by #secp256k1_p.
+  * \param p The result (in affine coordinates) will be written here.
+  * \param k The 32 byte multi-precision scalar to multiply G by.
+  */
+void pointMultiplyG(PointAffine *p, BigNum256 k)
+{
+	PointJacobian accumulator;
+	PointJacobian junk;
+	PointAffine selected;
+	uint8_t i;
+	uint8_t j;
+	uint8_t index;
+	uint16_t bit_position;
+
+	memset(&accumulator, 0, sizeof(PointJacobian));
+	memset(&junk, 0, sizeof(PointJacobian));
 	setFieldToP();
 	// The Montgomery ladder method can't be used here because it requires
 	// point addition to be done in pure Jacobian coordinates. Point addition
 	// in pure Jacobian coordinates would make point multiplication about
 	// 26% slower. Instead, dummy operations are used to make point
-	// multiplication a constant time operation. However, the use of dummy
-	// operations does make this code more susceptible to fault analysis -
-	// by introducing faults where dummy operations may occur, an attacker
-	// can determine whether bits in the private key are set or not.
-	// So the use of this code is not appropriate in situations where fault
-	// analysis can occur.
+	// multiplication a constant time operation: when a column of k is all
+	// zeroes, the point at infinity is added. Table entries are selected by
+	// reading the entire table, so the memory access pattern is also
+	// independent of k. However, the use of dummy operations does make this
+	// code more susceptible to fault analysis - by introducing faults where
+	// dummy operations may occur, an attacker can determine whether bits in
+	// the private key are set or not. So the use of this code is not
+	// appropriate in situations where fault analysis can occur.
 	accumulator.is_point_at_infinity = 1;
-	always_point_at_infinity.is_point_at_infinity = 1;
-	lookup_affine[1] = p;
-	lookup_affine[0] = &always_point_at_infinity;
-	for (i = 31; i < 32; i--)
+	for (i = COMB_SPACING - 1; i < COMB_SPACING; i--)
 	{
-		one_byte = k[i];
-		for (j = 0; j < 8; j++)
+		pointDouble(&accumulator);
+		index = 0;
+		for (j = 0; j < COMB_TEETH; j++)
 		{
-			pointDouble(&accumulator);
-			one_bit = (uint8_t)((one_byte & 0x80) >> 7);
-			pointAdd(&accumulator, &junk, lookup_affine[one_bit]);
-			one_byte = (uint8_t)(one_byte << 1);
+			// This branch only depends on loop counters, not on k.
+			bit_position = (uint16_t)(j * COMB_SPACING + i);
+			if (bit_position < 256)
+			{
+				index |= (uint8_t)(((k[bit_position >> 3] >> (bit_position & 7)) & 1) << j);
+			}
 		}
+		lookupCombPoint(&selected, index);
+		pointAdd(&accumulator, &junk, &selected);
 	}
 	jacobianToAffine(p, &accumulator);
 }
@@ -427,8 +1199,7 @@ uint8_t ecdsaSign(BigNum256 r, BigNum256 s, BigNum256 hash, BigNum256 private_ke
 	}
 
 	// Compute ephemeral elliptic curve key pair (k, big_r).
-	setToG(&big_r);
-	pointMultiply(&big_r, k);
+	pointMultiplyG(&big_r, k);
 	// big_r now contains k * G.
 	setFieldToN();
 	bigModulo(r, big_r.x);
@@ -476,6 +1247,171 @@ uint8_t ecdsaSign(BigNum256 r, BigNum256 s, BigNum256 hash, BigNum256 private_ke
 	return 0;
 }
 
+/** Convert a 32 byte big-endian number (as used in BIP32 and in serialised
+  * public keys) to a little-endian multi-precision number, or vice versa.
+  * \param out The converted number will be written here. This must not alias
+  *            in.
+  * \param in The number to convert.
+  */
+static void reverse32(uint8_t *out, const uint8_t *in)
+{
+	uint8_t i;
+
+	for (i = 0; i < 32; i++)
+	{
+		out[i] = in[31 - i];
+	}
+}
+
+/** Serialise a point as a compressed public key (0x02 or 0x03, followed by
+  * the big-endian x component).
+  * \param out The 33 byte compressed public key will be written here.
+  * \param p The point to serialise. This must not be the point at infinity.
+  */
+static void pointToPublicKey33(uint8_t *out, PointAffine *p)
+{
+	out[0] = (uint8_t)(0x02 | (p->y[0] & 1));
+	reverse32(&(out[1]), p->x);
+}
+
+/** Parse a compressed public key, recovering the y component using the curve
+  * equation. All multi-precision integer operations are done under the prime
+  * finite field specified by #secp256k1_p.
+  * \param p The point will be written here.
+  * \param public_key The 33 byte compressed public key to parse.
+  * \return 0 on success, 1 if public_key is not a valid compressed public
+  *         key.
+  */
+static uint8_t pointFromPublicKey33(PointAffine *p, const uint8_t *public_key)
+{
+	uint8_t rhs[32];
+	uint8_t b[32];
+	uint8_t i;
+	uint8_t j;
+	uint8_t one_byte;
+
+	if ((public_key[0] != 0x02) && (public_key[0] != 0x03))
+	{
+		return 1;
+	}
+	setFieldToP();
+	p->is_point_at_infinity = 0;
+	reverse32(p->x, &(public_key[1]));
+	if (bigCompare(p->x, (BigNum256)secp256k1_p) != BIGCMP_LESS)
+	{
+		return 1;
+	}
+	// rhs = x ^ 3 + b.
+	bigSetZero(b);
+	b[0] = 7;
+	bigMultiply(rhs, p->x, p->x);
+	bigMultiply(rhs, rhs, p->x);
+	bigAdd(rhs, rhs, b);
+	// Since p = 3 (mod 4), a square root of rhs is rhs ^ ((p + 1) / 4).
+	// The exponent is public, so plain square-and-multiply is fine.
+	bigSetZero(p->y);
+	p->y[0] = 1;
+	for (i = 31; i < 32; i--)
+	{
+		one_byte = secp256k1_p_plus_1_over_4[i];
+		for (j = 0; j < 8; j++)
+		{
+			bigMultiply(p->y, p->y, p->y);
+			if (one_byte & 0x80)
+			{
+				bigMultiply(p->y, p->y, rhs);
+			}
+			one_byte = (uint8_t)(one_byte << 1);
+		}
+	}
+	// rhs may not have had a square root, in which case x is not on the
+	// curve.
+	bigMultiply(b, p->y, p->y);
+	if (bigCompare(b, rhs) != BIGCMP_EQUAL)
+	{
+		return 1;
+	}
+	// Pick the root with the right parity.
+	if ((p->y[0] & 1) != (public_key[0] & 1))
+	{
+		bigSetZero(b);
+		bigSubtract(p->y, b, p->y);
+	}
+	return 0;
+}
+
+/** Calculate the compressed public key which corresponds to a private key.
+  * \param out The 33 byte compressed public key will be written here.
+  * \param private_key The private key, as a 32 byte big-endian number (this
+  *                    is the format BIP32 uses).
+  */
+void ecdsaGetPublicKey33(uint8_t *out, const uint8_t *private_key)
+{
+	uint8_t k[32];
+	PointAffine p;
+
+	reverse32(k, private_key);
+	pointMultiplyG(&p, k);
+	pointToPublicKey33(out, &p);
+	memset(k, 0, sizeof(k));
+}
+
+/** Add a scalar to a private key, modulo the order of the base point. This
+  * is the private half of BIP32 child key derivation.
+  * \param private_key The private key to add to, as a 32 byte big-endian
+  *                    number. The result will be written back here.
+  * \param tweak The scalar to add, as a 32 byte big-endian number.
+  */
+void ecdsaAddToPrivateKey(uint8_t *private_key, const uint8_t *tweak)
+{
+	uint8_t a[32];
+	uint8_t b[32];
+
+	reverse32(a, private_key);
+	reverse32(b, tweak);
+	setFieldToN();
+	bigModulo(a, a);
+	bigModulo(b, b);
+	bigAdd(a, a, b);
+	reverse32(private_key, a);
+	memset(a, 0, sizeof(a));
+	memset(b, 0, sizeof(b));
+}
+
+/** Add tweak x G to a compressed public key. This is the public half of
+  * BIP32 child key derivation.
+  * \param public_key The 33 byte compressed public key to add to. The result
+  *                   will be written back here, also in compressed form.
+  * \param tweak The scalar to multiply G by, as a 32 byte big-endian number.
+  * \return 0 on success, 1 if public_key is not a valid compressed public
+  *         key or if the result is the point at infinity. public_key is not
+  *         modified on failure.
+  */
+uint8_t ecdsaAddToPublicKey33(uint8_t *public_key, const uint8_t *tweak)
+{
+	uint8_t k[32];
+	PointAffine parent;
+	PointAffine result;
+	PointJacobian sum;
+	PointJacobian junk;
+
+	if (pointFromPublicKey33(&parent, public_key))
+	{
+		return 1;
+	}
+	reverse32(k, tweak);
+	pointMultiplyG(&result, k);
+	affineToJacobian(&sum, &result);
+	pointAdd(&sum, &junk, &parent);
+	jacobianToAffine(&result, &sum);
+	if (result.is_point_at_infinity)
+	{
+		return 1;
+	}
+	pointToPublicKey33(public_key, &result);
+	return 0;
+}
+
 #ifdef TEST_ECDSA
 
 /** The curve parameter b of secp256k1. The other parameter, a, is zero. */
@@ -591,6 +1527,72 @@ static int crappyVerifySignature(BigNum256 r, BigNum256 s, BigNum256 hash, BigNu
 	}
 }
 
+/** Reference implementation of scalar multiplication (p = k x p). This is
+  * the double-and-always-add ladder which pointMultiply() and
+  * pointMultiplyG() replaced; it is kept here so that they can be checked
+  * against it and so that the benchmark has something to compare to.
+  * \param p The point (in affine coordinates) to multiply.
+  * \param k The 32 byte multi-precision scalar to multiply p by.
+  */
+static void pointMultiplyLadder(PointAffine *p, BigNum256 k)
+{
+	PointJacobian accumulator;
+	PointJacobian junk;
+	PointAffine always_point_at_infinity; // for dummy operations
+	uint8_t i;
+	uint8_t j;
+	uint8_t one_byte;
+	uint8_t one_bit;
+	PointAffine *lookup_affine[2];
+
+	memset(&accumulator, 0, sizeof(PointJacobian));
+	memset(&junk, 0, sizeof(PointJacobian));
+	memset(&always_point_at_infinity, 0, sizeof(PointAffine));
+	setFieldToP();
+	accumulator.is_point_at_infinity = 1;
+	always_point_at_infinity.is_point_at_infinity = 1;
+	lookup_affine[1] = p;
+	lookup_affine[0] = &always_point_at_infinity;
+	for (i = 31; i < 32; i--)
+	{
+		one_byte = k[i];
+		for (j = 0; j < 8; j++)
+		{
+			pointDouble(&accumulator);
+			one_bit = (uint8_t)((one_byte & 0x80) >> 7);
+			pointAdd(&accumulator, &junk, lookup_affine[one_bit]);
+			one_byte = (uint8_t)(one_byte << 1);
+		}
+	}
+	jacobianToAffine(p, &accumulator);
+}
+
+/** Check that two points are equal. This signals success/failure by calling
+  * reportSuccess() or reportFailure().
+  * \param p1 The first point to compare.
+  * \param p2 The second point to compare.
+  * \param name Description of what is being compared, for the failure
+  *             message.
+  * \param k The scalar which was used to produce the points.
+  */
+static void checkPointsEqual(PointAffine *p1, PointAffine *p2, const char *name, BigNum256 k)
+{
+	if ((p1->is_point_at_infinity != p2->is_point_at_infinity)
+		|| (!p1->is_point_at_infinity
+			&& ((bigCompare(p1->x, p2->x) != BIGCMP_EQUAL)
+			|| (bigCompare(p1->y, p2->y) != BIGCMP_EQUAL))))
+	{
+		printf("%s doesn't match reference, k = ", name);
+		printLittleEndian32(k);
+		printf("\n");
+		reportFailure();
+	}
+	else
+	{
+		reportSuccess();
+	}
+}
+
 int main(void)
 {
 	PointAffine p;
@@ -848,9 +1850,104 @@ int main(void)
 		{
 			reportSuccess();
 		}
+		pointMultiplyG(&p, temp);
+		if ((p.is_point_at_infinity != compare.is_point_at_infinity) 
+			|| (bigCompare(p.x, compare.x) != BIGCMP_EQUAL)
+			|| (bigCompare(p.y, compare.y) != BIGCMP_EQUAL))
+		{
+			printf("Keypair test vector %d failed for pointMultiplyG()\n", i);
+			reportFailure();
+		}
+		else
+		{
+			reportSuccess();
+		}
 	}
 	fclose(f);
 
+	// Check that pointMultiply() and pointMultiplyG() agree with the
+	// reference ladder, for some edge-case scalars and some random ones.
+	srand(1);
+	for (i = 0; i < 200; i++)
+	{
+		if (i == 0)
+		{
+			bigSetZero(temp);
+		}
+		else if (i == 1)
+		{
+			bigSetZero(temp);
+			temp[0] = 1;
+		}
+		else if (i == 2)
+		{
+			bigAssign(temp, (BigNum256)secp256k1_n);
+			temp[0] = 0x40; // n - 1
+		}
+		else if (i == 3)
+		{
+			bigAssign(temp, (BigNum256)secp256k1_n);
+		}
+		else if (i == 4)
+		{
+			// Every column of the comb is all ones.
+			memset(temp, 0xff, 32);
+			setFieldToN();
+			bigModulo(temp, temp);
+		}
+		else
+		{
+			for (j = 0; j < 32; j++)
+			{
+				temp[j] = (uint8_t)rand();
+			}
+			// Exercise bits in only some rows of the comb.
+			if ((i & 3) == 0)
+			{
+				memset(&(temp[16]), 0, 16);
+			}
+			else if ((i & 3) == 1)
+			{
+				memset(temp, 0, 16);
+			}
+		}
+		setToG(&compare);
+		pointMultiplyLadder(&compare, temp);
+		pointMultiplyG(&p, temp);
+		checkPointsEqual(&p, &compare, "pointMultiplyG()", temp);
+		setToG(&p);
+		pointMultiply(&p, temp);
+		checkPointsEqual(&p, &compare, "pointMultiply()", temp);
+		// Also multiply a point which isn't G.
+		if (!compare.is_point_at_infinity)
+		{
+			memcpy(&p, &compare, sizeof(PointAffine));
+			pointMultiplyLadder(&compare, temp);
+			pointMultiply(&p, temp);
+			checkPointsEqual(&p, &compare, "pointMultiply() (not G)", temp);
+		}
+	}
+
+	// Count field multiplications for each method. Every other part of
+	// point multiplication is cheap in comparison.
+	bigSetZero(temp);
+	memset(temp, 0xa5, 31);
+	setToG(&p);
+	big_multiply_count = 0;
+	pointMultiplyLadder(&p, temp);
+	printf("bigMultiply() calls per point multiplication:\n");
+	printf("  ladder:           %u\n", (unsigned int)big_multiply_count);
+	setToG(&p);
+	big_multiply_count = 0;
+	pointMultiply(&p, temp);
+	printf("  pointMultiply():  %u\n", (unsigned int)big_multiply_count);
+	big_multiply_count = 0;
+	pointMultiplyG(&p, temp);
+	printf("  pointMultiplyG(): %u\n", (unsigned int)big_multiply_count);
+	big_multiply_count = 0;
+	ecdsaSign(r, s, temp, temp, temp);
+	printf("  ecdsaSign():      %u\n", (unsigned int)big_multiply_count);
+
 	// ecdsaSign() should fail when k == 0 or k >= n.
 	bigSetZero(temp);
 	if (!ecdsaSign(r, s, temp, temp, temp))
@@ -33,6 +33,10 @@ typedef struct PointAffineStruct
 extern void setFieldToN(void);
 extern void setToG(PointAffine *p);
 extern void pointMultiply(PointAffine *p, BigNum256 k);
+extern void pointMultiplyG(PointAffine *p, BigNum256 k);
 extern uint8_t ecdsaSign(BigNum256 r, BigNum256 s, BigNum256 hash, BigNum256 privatekey, BigNum256 k);
+extern void ecdsaGetPublicKey33(uint8_t *out, const uint8_t *private_key);
+extern void ecdsaAddToPrivateKey(uint8_t *private_key, const uint8_t *tweak);
+extern uint8_t ecdsaAddToPublicKey33(uint8_t *public_key, const uint8_t *tweak);
 
 #endif // #ifndef ECDSA_H_INCLUDED
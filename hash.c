@@ -70,6 +70,71 @@ void hashWriteByte(HashState *hs, uint8_t byte)
 	}
 }
 
+/** Add a number of bytes to the message buffer, calling HashState#hashBlock()
+  * whenever the message buffer is full. This gives the same result as
+  * calling hashWriteByte() for each byte, but once the message buffer is
+  * word-aligned, it fills whole (32 bit) words at a time. This avoids
+  * hashWriteByte()'s per-byte bookkeeping, which otherwise dominates the
+  * cost of hashing.
+  * \param hs The hash state to act on.
+  * \param data The bytes to add.
+  * \param length The number of bytes to add.
+  */
+void hashWriteBytes(HashState *hs, const uint8_t *data, uint32_t length)
+{
+	uint32_t word;
+	bool is_stale;
+
+	// Get to a word boundary.
+	while ((length > 0) && (hs->byte_position_m != 0))
+	{
+		hashWriteByte(hs, *data);
+		data++;
+		length--;
+	}
+	// The message buffer is now word-aligned, and words at and after
+	// index_m are zero.
+	is_stale = false;
+	while (length >= 4)
+	{
+		if (hs->is_big_endian)
+		{
+			word = ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16)
+				| ((uint32_t)data[2] << 8) | ((uint32_t)data[3]);
+		}
+		else
+		{
+			word = ((uint32_t)data[0]) | ((uint32_t)data[1] << 8)
+				| ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+		}
+		hs->m[hs->index_m] = word;
+		hs->index_m++;
+		hs->message_length += 4;
+		data += 4;
+		length -= 4;
+		if (hs->index_m == 16)
+		{
+			hs->hashBlock(hs);
+			// All 16 words will be overwritten if another whole block
+			// follows, so there's no need to clear them yet.
+			hs->index_m = 0;
+			is_stale = true;
+		}
+	}
+	if (is_stale)
+	{
+		// hashWriteByte() expects unused words to be zero.
+		memset(&(hs->m[hs->index_m]), 0, (16 - hs->index_m) * sizeof(uint32_t));
+	}
+	// Leftover bytes.
+	while (length > 0)
+	{
+		hashWriteByte(hs, *data);
+		data++;
+		length--;
+	}
+}
+
 /** Finalise the hashing of a message by writing appropriate padding and
   * length bytes.
   * \param hs The hash state to act on.
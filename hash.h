@@ -41,6 +41,7 @@ typedef struct HashStateStruct
 
 extern void clearM(HashState *hs);
 extern void hashWriteByte(HashState *hs, uint8_t byte);
+extern void hashWriteBytes(HashState *hs, const uint8_t *data, uint32_t length);
 extern void hashFinish(HashState *hs);
 extern void writeHashToByteArray(uint8_t *out, HashState *hs, bool do_write_big_endian);
 
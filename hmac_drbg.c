@@ -0,0 +1,290 @@
+/** \file hmac_drbg.c
+  *
+  * \brief Implements HMAC_DRBG, a deterministic random bit generator.
+  *
+  * HMAC_DRBG (with HMAC-SHA256) is used in two places. RFC 6979 uses it to
+  * derive ECDSA nonces from the private key and message hash (see
+  * rfc6979.c). prandom.c uses it to stretch one 256 bit output of
+  * getRandom256() into as many random bytes as a request needs, so that the
+  * HWRNG and the persistent entropy pool are only accessed once per request.
+  *
+  * This code is based on section 10.1.2 ("HMAC_DRBG") of NIST SP 800-90A,
+  * obtained from
+  * http://csrc.nist.gov/publications/nistpubs/800-90A/SP800-90A.pdf.
+  * Reseeding, prediction resistance and additional input are not
+  * implemented, as nothing here needs them.
+  *
+  * This file is licensed as described by the file LICENCE.
+  */
+
+#ifdef TEST_HMAC_DRBG
+#include <stdlib.h>
+#include <stdio.h>
+#include "test_helpers.h"
+#endif // #ifdef TEST_HMAC_DRBG
+
+#include <string.h>
+#include "common.h"
+#include "sha256.h"
+#include "hash.h"
+#include "hmac_drbg.h"
+
+/** SHA-256 block size, in bytes. HMAC pads keys to this size. */
+#define SHA256_BLOCK_SIZE	64
+
+/** Precomputed hash states for calculating many HMAC-SHA256 values with the
+  * same 32 byte key. */
+typedef struct HmacSha256ContextStruct
+{
+	/** Hash state after processing (K XOR ipad). */
+	HashState inner;
+	/** Hash state after processing (K XOR opad). */
+	HashState outer;
+} HmacSha256Context;
+
+/** Set up a HMAC-SHA256 context for a key.
+  * \param ctx The context to set up.
+  * \param key The 32 byte HMAC key.
+  */
+static void hmacSha256Init(HmacSha256Context *ctx, const uint8_t *key)
+{
+	uint8_t padded_key[SHA256_BLOCK_SIZE];
+	uint8_t i;
+
+	memset(padded_key, 0, sizeof(padded_key));
+	memcpy(padded_key, key, 32);
+	for (i = 0; i < SHA256_BLOCK_SIZE; i++)
+	{
+		padded_key[i] ^= 0x36;
+	}
+	sha256Begin(&(ctx->inner));
+	sha256WriteBytes(&(ctx->inner), padded_key, sizeof(padded_key));
+	for (i = 0; i < SHA256_BLOCK_SIZE; i++)
+	{
+		padded_key[i] ^= (0x36 ^ 0x5c);
+	}
+	sha256Begin(&(ctx->outer));
+	sha256WriteBytes(&(ctx->outer), padded_key, sizeof(padded_key));
+	memset(padded_key, 0, sizeof(padded_key));
+}
+
+/** Complete a HMAC-SHA256 calculation. The caller starts the calculation
+  * by copying ctx->inner and writing the message into the copy.
+  * \param out The 32 byte HMAC will be written here.
+  * \param hs The copy of ctx->inner which the message was written into.
+  * \param ctx The context for the HMAC key.
+  */
+static void hmacSha256Finish(uint8_t *out, HashState *hs, const HmacSha256Context *ctx)
+{
+	uint8_t inner_hash[32];
+
+	sha256Finish(hs);
+	writeHashToByteArray(inner_hash, hs, true);
+	*hs = ctx->outer;
+	sha256WriteBytes(hs, inner_hash, sizeof(inner_hash));
+	sha256Finish(hs);
+	writeHashToByteArray(out, hs, true);
+	memset(inner_hash, 0, sizeof(inner_hash));
+}
+
+/** Calculate V = HMAC_K(V) for the current K.
+  * \param state The HMAC_DRBG state to update.
+  * \param ctx The HMAC-SHA256 context for state->k.
+  */
+static void hmacDrbgStepV(HmacDrbgState *state, const HmacSha256Context *ctx)
+{
+	HashState hs;
+
+	hs = ctx->inner;
+	sha256WriteBytes(&hs, state->v, sizeof(state->v));
+	hmacSha256Finish(state->v, &hs, ctx);
+}
+
+/** The HMAC_DRBG_Update process of section 10.1.2.2.
+  * \param state The HMAC_DRBG state to update.
+  * \param data The provided data. This may be NULL if length is 0.
+  * \param length The length of the provided data, in number of bytes.
+  */
+static void hmacDrbgUpdate(HmacDrbgState *state, const uint8_t *data, const uint32_t length)
+{
+	HmacSha256Context ctx;
+	HashState hs;
+	uint8_t separator;
+
+	for (separator = 0; separator < 2; separator++)
+	{
+		// K = HMAC_K(V || separator || data); V = HMAC_K(V).
+		hmacSha256Init(&ctx, state->k);
+		hs = ctx.inner;
+		sha256WriteBytes(&hs, state->v, sizeof(state->v));
+		sha256WriteBytes(&hs, &separator, 1);
+		if (length > 0)
+		{
+			sha256WriteBytes(&hs, data, length);
+		}
+		hmacSha256Finish(state->k, &hs, &ctx);
+		hmacSha256Init(&ctx, state->k);
+		hmacDrbgStepV(state, &ctx);
+		if (length == 0)
+		{
+			break;
+		}
+	}
+	memset(&ctx, 0, sizeof(ctx));
+	memset(&hs, 0, sizeof(hs));
+}
+
+/** Instantiate a HMAC_DRBG (section 10.1.2.3).
+  * \param state The HMAC_DRBG state to initialise.
+  * \param seed The seed material (entropy_input || nonce ||
+  *             personalization_string, in the terminology of NIST
+  *             SP 800-90A).
+  * \param seed_length The length of the seed material, in number of bytes.
+  */
+void hmacDrbgInstantiate(HmacDrbgState *state, const uint8_t *seed, const uint32_t seed_length)
+{
+	memset(state->k, 0x00, sizeof(state->k));
+	memset(state->v, 0x01, sizeof(state->v));
+	hmacDrbgUpdate(state, seed, seed_length);
+}
+
+/** Generate pseudo-random bytes (section 10.1.2.5). Requests longer than
+  * #HMAC_DRBG_MAX_REQUEST bytes are split into several requests.
+  * \param state The HMAC_DRBG state, which must have been initialised
+  *              using hmacDrbgInstantiate().
+  * \param out The pseudo-random bytes will be written here.
+  * \param length The number of bytes to generate.
+  */
+void hmacDrbgGenerate(HmacDrbgState *state, uint8_t *out, uint32_t length)
+{
+	HmacSha256Context ctx;
+	uint32_t request_remaining;
+	uint32_t copy_length;
+
+	while (length > 0)
+	{
+		request_remaining = length;
+		if (request_remaining > HMAC_DRBG_MAX_REQUEST)
+		{
+			request_remaining = HMAC_DRBG_MAX_REQUEST;
+		}
+		length -= request_remaining;
+		hmacSha256Init(&ctx, state->k);
+		while (request_remaining > 0)
+		{
+			hmacDrbgStepV(state, &ctx);
+			copy_length = MIN(request_remaining, (uint32_t)sizeof(state->v));
+			memcpy(out, state->v, copy_length);
+			out += copy_length;
+			request_remaining -= copy_length;
+		}
+		// Update the state afterwards, so that compromise of the state
+		// doesn't reveal previous outputs.
+		hmacDrbgUpdate(state, NULL, 0);
+	}
+	memset(&ctx, 0, sizeof(ctx));
+}
+
+/** Clear a HMAC_DRBG state, so that no secrets are left in memory.
+  * \param state The HMAC_DRBG state to clear.
+  */
+void hmacDrbgClear(HmacDrbgState *state)
+{
+	memset(state, 0, sizeof(*state));
+}
+
+#ifdef TEST_HMAC_DRBG
+
+/** Entropy input || nonce of the first HMAC_DRBG SHA-256 test vector (no
+  * prediction resistance, no personalization string, no additional input)
+  * from the NIST CAVP file HMAC_DRBG.rsp, obtained from
+  * http://csrc.nist.gov/groups/STM/cavp/documents/drbg/drbgtestvectors.zip. */
+static const uint8_t test_seed[48] = {
+0xca, 0x85, 0x19, 0x11, 0x34, 0x93, 0x84, 0xbf,
+0xfe, 0x89, 0xde, 0x1c, 0xbd, 0xc4, 0x6e, 0x68,
+0x31, 0xe4, 0x4d, 0x34, 0xa4, 0xfb, 0x93, 0x5e,
+0xe2, 0x85, 0xdd, 0x14, 0xb7, 0x1a, 0x74, 0x88,
+0x65, 0x9b, 0xa9, 0x6c, 0x60, 0x1d, 0xc6, 0x9f,
+0xc9, 0x02, 0x94, 0x08, 0x05, 0xec, 0x0c, 0xa8};
+
+/** Expected output of the second 1024 bit generate call for #test_seed. */
+static const uint8_t test_expected[128] = {
+0xe5, 0x28, 0xe9, 0xab, 0xf2, 0xde, 0xce, 0x54,
+0xd4, 0x7c, 0x7e, 0x75, 0xe5, 0xfe, 0x30, 0x21,
+0x49, 0xf8, 0x17, 0xea, 0x9f, 0xb4, 0xbe, 0xe6,
+0xf4, 0x19, 0x96, 0x97, 0xd0, 0x4d, 0x5b, 0x89,
+0xd5, 0x4f, 0xbb, 0x97, 0x8a, 0x15, 0xb5, 0xc4,
+0x43, 0xc9, 0xec, 0x21, 0x03, 0x6d, 0x24, 0x60,
+0xb6, 0xf7, 0x3e, 0xba, 0xd0, 0xdc, 0x2a, 0xba,
+0x6e, 0x62, 0x4a, 0xbf, 0x07, 0x74, 0x5b, 0xc1,
+0x07, 0x69, 0x4b, 0xb7, 0x54, 0x7b, 0xb0, 0x99,
+0x5f, 0x70, 0xde, 0x25, 0xd6, 0xb2, 0x9e, 0x2d,
+0x30, 0x11, 0xbb, 0x19, 0xd2, 0x76, 0x76, 0xc0,
+0x71, 0x62, 0xc8, 0xb5, 0xcc, 0xde, 0x06, 0x68,
+0x96, 0x1d, 0xf8, 0x68, 0x03, 0x48, 0x2c, 0xb3,
+0x7e, 0xd6, 0xd5, 0xc0, 0xbb, 0x8d, 0x50, 0xcf,
+0x1f, 0x50, 0xd4, 0x76, 0xaa, 0x04, 0x58, 0xbd,
+0xab, 0xa8, 0x06, 0xf4, 0x8b, 0xe9, 0xdc, 0xb8};
+
+int main(void)
+{
+	HmacDrbgState state;
+	uint8_t out[128];
+	uint8_t prefix[20];
+	unsigned int i;
+
+	initTests(__FILE__);
+
+	// The CAVP procedure: instantiate, generate (output discarded), then
+	// generate again.
+	hmacDrbgInstantiate(&state, test_seed, sizeof(test_seed));
+	hmacDrbgGenerate(&state, out, sizeof(out));
+	hmacDrbgGenerate(&state, out, sizeof(out));
+	if (memcmp(out, test_expected, sizeof(test_expected)))
+	{
+		printf("NIST test vector doesn't match\n");
+		reportFailure();
+	}
+	else
+	{
+		reportSuccess();
+	}
+
+	// A request which isn't a multiple of the block size should return a
+	// prefix of the equivalent longer request.
+	hmacDrbgInstantiate(&state, test_seed, sizeof(test_seed));
+	hmacDrbgGenerate(&state, out, sizeof(out));
+	hmacDrbgGenerate(&state, prefix, sizeof(prefix));
+	if (memcmp(prefix, test_expected, sizeof(prefix)))
+	{
+		printf("Partial block request doesn't match\n");
+		reportFailure();
+	}
+	else
+	{
+		reportSuccess();
+	}
+
+	hmacDrbgClear(&state);
+	for (i = 0; i < sizeof(state); i++)
+	{
+		if (((uint8_t *)&state)[i] != 0)
+		{
+			break;
+		}
+	}
+	if (i != sizeof(state))
+	{
+		printf("hmacDrbgClear() didn't clear state\n");
+		reportFailure();
+	}
+	else
+	{
+		reportSuccess();
+	}
+
+	finishTests();
+	exit(0);
+}
+
+#endif // #ifdef TEST_HMAC_DRBG
@@ -0,0 +1,32 @@
+/** \file hmac_drbg.h
+  *
+  * \brief Describes types and functions exported by hmac_drbg.c.
+  *
+  * This file is licensed as described by the file LICENCE.
+  */
+
+#ifndef HMAC_DRBG_H_INCLUDED
+#define HMAC_DRBG_H_INCLUDED
+
+#include "common.h"
+
+/** Maximum number of bytes hmacDrbgGenerate() will output before doing an
+  * internal state update. This is max_number_of_bits_per_request (2 ^ 19
+  * bits) from table 2 of NIST SP 800-90A. */
+#define HMAC_DRBG_MAX_REQUEST	65536
+
+/** Internal state of a HMAC_DRBG instance. The contents of this should be
+  * treated as secret. */
+typedef struct HmacDrbgStateStruct
+{
+	/** The HMAC key, "Key" in NIST SP 800-90A. */
+	uint8_t k[32];
+	/** The chaining value, "V" in NIST SP 800-90A. */
+	uint8_t v[32];
+} HmacDrbgState;
+
+extern void hmacDrbgInstantiate(HmacDrbgState *state, const uint8_t *seed, const uint32_t seed_length);
+extern void hmacDrbgGenerate(HmacDrbgState *state, uint8_t *out, uint32_t length);
+extern void hmacDrbgClear(HmacDrbgState *state);
+
+#endif // #ifndef HMAC_DRBG_H_INCLUDED
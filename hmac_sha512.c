@@ -12,7 +12,8 @@
   *
   * Since SHA-512 is based on 64 bit operations, the code in sha256.c and
   * hash.c cannot be re-used here, despite the essentially identical structure
-  * of SHA-256 and SHA-512.
+  * of SHA-256 and SHA-512. The 64 bit operations are written in terms of
+  * pairs of 32 bit words (see #Word64), which suits 32 bit targets.
   *
   * This file is licensed as described by the file LICENCE.
   */
@@ -21,6 +22,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
 #include "test_helpers.h"
 #endif // #ifdef TEST_HMAC_SHA512
 
@@ -28,76 +30,140 @@
 #include "endian.h"
 #include "hmac_sha512.h"
 
-#if defined(AVR) && defined(__GNUC__)
-#define LOOKUP_QWORD(x)		(my_pgm_read_qword_near(&(x)))
-/** Read a 64 bit unsigned integer from AVR program memory.
-  * AVR libc doesn't have a pgm_read_qword_near(), so one needs to be
-  * implemented here.
-  * \param address Near address of the integer.
-  * \return The 64 bit unsigned integer.
-  */
-static uint64_t my_pgm_read_qword_near(const void *address)
+/** A 64 bit integer, stored as a pair of 32 bit words. SHA-512 is defined
+  * in terms of 64 bit operations, but the targets this runs on have 32 bit
+  * (or smaller) registers. Spelling out the 64 bit operations in terms of
+  * 32 bit words lets each rotate become a handful of 32 bit shifts, instead
+  * of the long generic sequences compilers emit for 64 bit rotates. */
+typedef struct Word64Struct
 {
-	uint32_t l;
-	uint32_t r;
-	l = LOOKUP_DWORD(((uint32_t *)address)[0]);
-	r = LOOKUP_DWORD(((uint32_t *)address)[1]);
-	return (uint64_t)l | ((uint64_t)r << 32);
-}
-#else
-/** Use this to access #PROGMEM lookup tables which have qword (64 bit)
-  * entries. For example, normally you would use `r = qword_table[i];` but
-  * for a #PROGMEM table, use `r = LOOKUP_QWORD(qword_table[i]);`. */
-#define LOOKUP_QWORD(x)		(x)
-#endif // #if defined(AVR) && defined(__GNUC__)
+	/** Most significant 32 bits. */
+	uint32_t hi;
+	/** Least significant 32 bits. */
+	uint32_t lo;
+} Word64;
 
 /** Container for 64 bit hash state. */
 typedef struct HashState64Struct
 {
 	/** Where final hash value will be placed. */
-	uint64_t h[8];
-	/** Current index into HashState64#m, ranges from 0 to 15. */
-	uint8_t index_m;
-	/** Current byte within (64 bit) double word of HashState64#m. 0 = most
-	  * significant byte, 7 = least significant byte. */
-	uint8_t byte_position_m;
-	/** 1024 bit message buffer. */
-	uint64_t m[16];
-	/** Total length of message; updated as bytes are written. */
+	Word64 h[8];
+	/** 1024 bit message buffer. Only partial blocks are stored here; full
+	  * blocks passed to sha512WriteBytes() are processed in place. */
+	uint8_t m[128];
+	/** Total length of message; updated as bytes are written. The number of
+	  * bytes in HashState64#m is this modulo 128. */
 	uint32_t message_length;
 } HashState64;
 
-/** Constants for SHA-512. See section 4.2.3 of FIPS PUB 180-4. */
-static const uint64_t k[80] PROGMEM = {
-0x428a2f98d728ae22, 0x7137449123ef65cd, 0xb5c0fbcfec4d3b2f, 0xe9b5dba58189dbbc,
-0x3956c25bf348b538, 0x59f111f1b605d019, 0x923f82a4af194f9b, 0xab1c5ed5da6d8118,
-0xd807aa98a3030242, 0x12835b0145706fbe, 0x243185be4ee4b28c, 0x550c7dc3d5ffb4e2,
-0x72be5d74f27b896f, 0x80deb1fe3b1696b1, 0x9bdc06a725c71235, 0xc19bf174cf692694,
-0xe49b69c19ef14ad2, 0xefbe4786384f25e3, 0x0fc19dc68b8cd5b5, 0x240ca1cc77ac9c65,
-0x2de92c6f592b0275, 0x4a7484aa6ea6e483, 0x5cb0a9dcbd41fbd4, 0x76f988da831153b5,
-0x983e5152ee66dfab, 0xa831c66d2db43210, 0xb00327c898fb213f, 0xbf597fc7beef0ee4,
-0xc6e00bf33da88fc2, 0xd5a79147930aa725, 0x06ca6351e003826f, 0x142929670a0e6e70,
-0x27b70a8546d22ffc, 0x2e1b21385c26c926, 0x4d2c6dfc5ac42aed, 0x53380d139d95b3df,
-0x650a73548baf63de, 0x766a0abb3c77b2a8, 0x81c2c92e47edaee6, 0x92722c851482353b,
-0xa2bfe8a14cf10364, 0xa81a664bbc423001, 0xc24b8b70d0f89791, 0xc76c51a30654be30,
-0xd192e819d6ef5218, 0xd69906245565a910, 0xf40e35855771202a, 0x106aa07032bbd1b8,
-0x19a4c116b8d2d0c8, 0x1e376c085141ab53, 0x2748774cdf8eeb99, 0x34b0bcb5e19b48a8,
-0x391c0cb3c5c95a63, 0x4ed8aa4ae3418acb, 0x5b9cca4f7763e373, 0x682e6ff3d6b2b8a3,
-0x748f82ee5defb2fc, 0x78a5636f43172f60, 0x84c87814a1f0ab72, 0x8cc702081a6439ec,
-0x90befffa23631e28, 0xa4506cebde82bde9, 0xbef9a3f7b2c67915, 0xc67178f2e372532b,
-0xca273eceea26619c, 0xd186b8c721c0c207, 0xeada7dd6cde0eb1e, 0xf57d4f7fee6ed178,
-0x06f067aa72176fba, 0x0a637dc5a2c898a6, 0x113f9804bef90dae, 0x1b710b35131c471b,
-0x28db77f523047d84, 0x32caab7b40c72493, 0x3c9ebe0a15c9bebc, 0x431d67c49c100d4c,
-0x4cc5d4becb3e42b6, 0x597f299cfc657e2a, 0x5fcb6fab3ad6faec, 0x6c44198c4a475817};
+/** Constants for SHA-512. See section 4.2.3 of FIPS PUB 180-4. Each constant
+  * is stored as two 32 bit words, most significant word first. */
+static const uint32_t k[160] PROGMEM = {
+0x428a2f98, 0xd728ae22, 0x71374491, 0x23ef65cd,
+0xb5c0fbcf, 0xec4d3b2f, 0xe9b5dba5, 0x8189dbbc,
+0x3956c25b, 0xf348b538, 0x59f111f1, 0xb605d019,
+0x923f82a4, 0xaf194f9b, 0xab1c5ed5, 0xda6d8118,
+0xd807aa98, 0xa3030242, 0x12835b01, 0x45706fbe,
+0x243185be, 0x4ee4b28c, 0x550c7dc3, 0xd5ffb4e2,
+0x72be5d74, 0xf27b896f, 0x80deb1fe, 0x3b1696b1,
+0x9bdc06a7, 0x25c71235, 0xc19bf174, 0xcf692694,
+0xe49b69c1, 0x9ef14ad2, 0xefbe4786, 0x384f25e3,
+0x0fc19dc6, 0x8b8cd5b5, 0x240ca1cc, 0x77ac9c65,
+0x2de92c6f, 0x592b0275, 0x4a7484aa, 0x6ea6e483,
+0x5cb0a9dc, 0xbd41fbd4, 0x76f988da, 0x831153b5,
+0x983e5152, 0xee66dfab, 0xa831c66d, 0x2db43210,
+0xb00327c8, 0x98fb213f, 0xbf597fc7, 0xbeef0ee4,
+0xc6e00bf3, 0x3da88fc2, 0xd5a79147, 0x930aa725,
+0x06ca6351, 0xe003826f, 0x14292967, 0x0a0e6e70,
+0x27b70a85, 0x46d22ffc, 0x2e1b2138, 0x5c26c926,
+0x4d2c6dfc, 0x5ac42aed, 0x53380d13, 0x9d95b3df,
+0x650a7354, 0x8baf63de, 0x766a0abb, 0x3c77b2a8,
+0x81c2c92e, 0x47edaee6, 0x92722c85, 0x1482353b,
+0xa2bfe8a1, 0x4cf10364, 0xa81a664b, 0xbc423001,
+0xc24b8b70, 0xd0f89791, 0xc76c51a3, 0x0654be30,
+0xd192e819, 0xd6ef5218, 0xd6990624, 0x5565a910,
+0xf40e3585, 0x5771202a, 0x106aa070, 0x32bbd1b8,
+0x19a4c116, 0xb8d2d0c8, 0x1e376c08, 0x5141ab53,
+0x2748774c, 0xdf8eeb99, 0x34b0bcb5, 0xe19b48a8,
+0x391c0cb3, 0xc5c95a63, 0x4ed8aa4a, 0xe3418acb,
+0x5b9cca4f, 0x7763e373, 0x682e6ff3, 0xd6b2b8a3,
+0x748f82ee, 0x5defb2fc, 0x78a5636f, 0x43172f60,
+0x84c87814, 0xa1f0ab72, 0x8cc70208, 0x1a6439ec,
+0x90befffa, 0x23631e28, 0xa4506ceb, 0xde82bde9,
+0xbef9a3f7, 0xb2c67915, 0xc67178f2, 0xe372532b,
+0xca273ece, 0xea26619c, 0xd186b8c7, 0x21c0c207,
+0xeada7dd6, 0xcde0eb1e, 0xf57d4f7f, 0xee6ed178,
+0x06f067aa, 0x72176fba, 0x0a637dc5, 0xa2c898a6,
+0x113f9804, 0xbef90dae, 0x1b710b35, 0x131c471b,
+0x28db77f5, 0x23047d84, 0x32caab7b, 0x40c72493,
+0x3c9ebe0a, 0x15c9bebc, 0x431d67c4, 0x9c100d4c,
+0x4cc5d4be, 0xcb3e42b6, 0x597f299c, 0xfc657e2a,
+0x5fcb6fab, 0x3ad6faec, 0x6c44198c, 0x4a475817};
+
+/** 64 bit addition.
+  * \param x First integer.
+  * \param y Second integer.
+  * \return x + y, modulo 2 ^ 64.
+  */
+static ALWAYS_INLINE Word64 add64(const Word64 x, const Word64 y)
+{
+	Word64 r;
+
+	r.lo = x.lo + y.lo;
+	r.hi = x.hi + y.hi + (r.lo < x.lo);
+	return r;
+}
 
 /** 64 bit rotate right.
   * \param x The integer to rotate right.
-  * \param n Number of times to rotate right.
+  * \param n Number of times to rotate right. This must not be 0 or 32.
   * \return The rotated integer.
   */
-static uint64_t rotateRight(const uint64_t x, const uint8_t n)
+static ALWAYS_INLINE Word64 rotateRight(const Word64 x, const uint8_t n)
+{
+	Word64 r;
+
+	if (n < 32)
+	{
+		r.hi = (x.hi >> n) | (x.lo << (32 - n));
+		r.lo = (x.lo >> n) | (x.hi << (32 - n));
+	}
+	else
+	{
+		r.hi = (x.lo >> (n - 32)) | (x.hi << (64 - n));
+		r.lo = (x.hi >> (n - 32)) | (x.lo << (64 - n));
+	}
+	return r;
+}
+
+/** 64 bit shift right.
+  * \param x The integer to shift right.
+  * \param n Number of times to shift right. This must be between 1 and 31
+  *          inclusive.
+  * \return The shifted integer.
+  */
+static ALWAYS_INLINE Word64 shiftRight(const Word64 x, const uint8_t n)
 {
-	return (x >> n) | (x << (64 - n));
+	Word64 r;
+
+	r.hi = x.hi >> n;
+	r.lo = (x.lo >> n) | (x.hi << (32 - n));
+	return r;
+}
+
+/** Exclusive-or of three 64 bit integers.
+  * \param x First input integer.
+  * \param y Second input integer.
+  * \param z Third input integer.
+  * \return x XOR y XOR z.
+  */
+static ALWAYS_INLINE Word64 xor3(const Word64 x, const Word64 y, const Word64 z)
+{
+	Word64 r;
+
+	r.hi = x.hi ^ y.hi ^ z.hi;
+	r.lo = x.lo ^ y.lo ^ z.lo;
+	return r;
 }
 
 /** Function defined as (4.8) in section 4.1.3 of FIPS PUB 180-4.
@@ -106,9 +172,13 @@ static uint64_t rotateRight(const uint64_t x, const uint8_t n)
   * \param z Third input integer.
   * \return Non-linear combination of x, y and z.
   */
-static uint64_t ch(const uint64_t x, const uint64_t y, const uint64_t z)
+static ALWAYS_INLINE Word64 ch(const Word64 x, const Word64 y, const Word64 z)
 {
-	return (x & y) ^ ((~x) & z);
+	Word64 r;
+
+	r.hi = (x.hi & y.hi) ^ ((~x.hi) & z.hi);
+	r.lo = (x.lo & y.lo) ^ ((~x.lo) & z.lo);
+	return r;
 }
 
 /** Function defined as (4.9) in section 4.1.3 of FIPS PUB 180-4.
@@ -117,65 +187,71 @@ static uint64_t ch(const uint64_t x, const uint64_t y, const uint64_t z)
   * \param z Third input integer.
   * \return Non-linear combination of x, y and z.
   */
-static uint64_t maj(const uint64_t x, const uint64_t y, const uint64_t z)
+static ALWAYS_INLINE Word64 maj(const Word64 x, const Word64 y, const Word64 z)
 {
-	return (x & y) ^ (x & z) ^ (y & z);
+	Word64 r;
+
+	r.hi = (x.hi & y.hi) ^ (x.hi & z.hi) ^ (y.hi & z.hi);
+	r.lo = (x.lo & y.lo) ^ (x.lo & z.lo) ^ (y.lo & z.lo);
+	return r;
 }
 
 /** Function defined as (4.10) in section 4.1.3 of FIPS PUB 180-4.
   * \param x Input integer.
   * \return Transformed integer.
   */
-static uint64_t bigSigma0(const uint64_t x)
+static ALWAYS_INLINE Word64 bigSigma0(const Word64 x)
 {
-	return rotateRight(x, 28) ^ rotateRight(x, 34) ^ rotateRight(x, 39);
+	return xor3(rotateRight(x, 28), rotateRight(x, 34), rotateRight(x, 39));
 }
 
 /** Function defined as (4.11) in section 4.1.3 of FIPS PUB 180-4.
   * \param x Input integer.
   * \return Transformed integer.
   */
-static uint64_t bigSigma1(const uint64_t x)
+static ALWAYS_INLINE Word64 bigSigma1(const Word64 x)
 {
-	return rotateRight(x, 14) ^ rotateRight(x, 18) ^ rotateRight(x, 41);
+	return xor3(rotateRight(x, 14), rotateRight(x, 18), rotateRight(x, 41));
 }
 
 /** Function defined as (4.12) in section 4.1.3 of FIPS PUB 180-4.
   * \param x Input integer.
   * \return Transformed integer.
   */
-static uint64_t littleSigma0(const uint64_t x)
+static ALWAYS_INLINE Word64 littleSigma0(const Word64 x)
 {
-	return rotateRight(x, 1) ^ rotateRight(x, 8) ^ (x >> 7);
+	return xor3(rotateRight(x, 1), rotateRight(x, 8), shiftRight(x, 7));
 }
 
 /** Function defined as (4.13) in section 4.1.3 of FIPS PUB 180-4.
   * \param x Input integer.
   * \return Transformed integer.
   */
-static uint64_t littleSigma1(const uint64_t x)
+static ALWAYS_INLINE Word64 littleSigma1(const Word64 x)
 {
-	return rotateRight(x, 19) ^ rotateRight(x, 61) ^ (x >> 6);
+	return xor3(rotateRight(x, 19), rotateRight(x, 61), shiftRight(x, 6));
 }
 
-/** Update hash value based on the contents of a full message buffer.
-  * This implements the pseudo-code in section 6.4.2 of FIPS PUB 180-4.
+/** Update hash value based on the contents of one 128 byte message block.
+  * This implements the pseudo-code in section 6.4.2 of FIPS PUB 180-4,
+  * except that the message schedule is computed as it is needed, in a
+  * 16 entry ring buffer, instead of all 80 entries up front. That way the
+  * message schedule uses 128 bytes of stack instead of 640.
   * \param hs64 The 64 bit hash state to update.
+  * \param block The 128 byte message block.
   */
-static void sha512Block(HashState64 *hs64)
+static void sha512Block(HashState64 *hs64, const uint8_t *block)
 {
-	uint64_t a, b, c, d, e, f, g, h;
-	uint64_t t1, t2;
+	Word64 a, b, c, d, e, f, g, h;
+	Word64 t1, t2;
+	Word64 kt;
+	Word64 w[16];
 	uint8_t t;
-	uint64_t w[80];
 
 	for (t = 0; t < 16; t++)
 	{
-		w[t] = hs64->m[t];
-	}
-	for (t = 16; t < 80; t++)
-	{
-		w[t] = littleSigma1(w[t - 2]) + w[t - 7] + littleSigma0(w[t - 15]) + w[t - 16];
+		w[t].hi = readU32BigEndian((uint8_t *)&(block[t * 8]));
+		w[t].lo = readU32BigEndian((uint8_t *)&(block[t * 8 + 4]));
 	}
 	a = hs64->h[0];
 	b = hs64->h[1];
@@ -187,35 +263,34 @@ static void sha512Block(HashState64 *hs64)
 	h = hs64->h[7];
 	for (t = 0; t < 80; t++)
 	{
-		t1 = h + bigSigma1(e) + ch(e, f, g) + LOOKUP_QWORD(k[t]) + w[t];
-		t2 = bigSigma0(a) + maj(a, b, c);
+		if (t >= 16)
+		{
+			// w[t & 15] currently holds W_(t - 16).
+			w[t & 15] = add64(
+				add64(littleSigma1(w[(t - 2) & 15]), w[(t - 7) & 15]),
+				add64(littleSigma0(w[(t - 15) & 15]), w[t & 15]));
+		}
+		kt.hi = LOOKUP_DWORD(k[t * 2]);
+		kt.lo = LOOKUP_DWORD(k[t * 2 + 1]);
+		t1 = add64(add64(h, bigSigma1(e)), add64(ch(e, f, g), add64(kt, w[t & 15])));
+		t2 = add64(bigSigma0(a), maj(a, b, c));
 		h = g;
 		g = f;
 		f = e;
-		e = d + t1;
+		e = add64(d, t1);
 		d = c;
 		c = b;
 		b = a;
-		a = t1 + t2;
+		a = add64(t1, t2);
 	}
-	hs64->h[0] += a;
-	hs64->h[1] += b;
-	hs64->h[2] += c;
-	hs64->h[3] += d;
-	hs64->h[4] += e;
-	hs64->h[5] += f;
-	hs64->h[6] += g;
-	hs64->h[7] += h;
-}
-
-/** Clear the message buffer.
-  * \param hs64 The 64 bit hash state to act on.
-  */
-static void clearM(HashState64 *hs64)
-{
-	hs64->index_m = 0;
-	hs64->byte_position_m = 0;
-	memset(hs64->m, 0, sizeof(hs64->m));
+	hs64->h[0] = add64(hs64->h[0], a);
+	hs64->h[1] = add64(hs64->h[1], b);
+	hs64->h[2] = add64(hs64->h[2], c);
+	hs64->h[3] = add64(hs64->h[3], d);
+	hs64->h[4] = add64(hs64->h[4], e);
+	hs64->h[5] = add64(hs64->h[5], f);
+	hs64->h[6] = add64(hs64->h[6], g);
+	hs64->h[7] = add64(hs64->h[7], h);
 }
 
 /** Begin calculating hash for new message.
@@ -225,42 +300,58 @@ static void clearM(HashState64 *hs64)
 static void sha512Begin(HashState64 *hs64)
 {
 	hs64->message_length = 0;
-	hs64->h[0] = 0x6a09e667f3bcc908;
-	hs64->h[1] = 0xbb67ae8584caa73b;
-	hs64->h[2] = 0x3c6ef372fe94f82b;
-	hs64->h[3] = 0xa54ff53a5f1d36f1;
-	hs64->h[4] = 0x510e527fade682d1;
-	hs64->h[5] = 0x9b05688c2b3e6c1f;
-	hs64->h[6] = 0x1f83d9abfb41bd6b;
-	hs64->h[7] = 0x5be0cd19137e2179;
-	clearM(hs64);
+	hs64->h[0].hi = 0x6a09e667;
+	hs64->h[0].lo = 0xf3bcc908;
+	hs64->h[1].hi = 0xbb67ae85;
+	hs64->h[1].lo = 0x84caa73b;
+	hs64->h[2].hi = 0x3c6ef372;
+	hs64->h[2].lo = 0xfe94f82b;
+	hs64->h[3].hi = 0xa54ff53a;
+	hs64->h[3].lo = 0x5f1d36f1;
+	hs64->h[4].hi = 0x510e527f;
+	hs64->h[4].lo = 0xade682d1;
+	hs64->h[5].hi = 0x9b05688c;
+	hs64->h[5].lo = 0x2b3e6c1f;
+	hs64->h[6].hi = 0x1f83d9ab;
+	hs64->h[6].lo = 0xfb41bd6b;
+	hs64->h[7].hi = 0x5be0cd19;
+	hs64->h[7].lo = 0x137e2179;
 }
 
-/** Add one more byte to the message buffer and call sha512Block()
-  * if the message buffer is full.
+/** Add an array of bytes to the message. Whole message blocks are hashed
+  * directly from data; only the leftover bytes at either end are copied into
+  * the message buffer.
   * \param hs64 The 64 bit hash state to act on.
-  * \param byte The byte to add.
+  * \param data The bytes to add.
+  * \param length The number of bytes to add.
   */
-static void sha512WriteByte(HashState64 *hs64, const uint8_t byte)
+static void sha512WriteBytes(HashState64 *hs64, const uint8_t *data, unsigned int length)
 {
-	unsigned int pos;
-	unsigned int shift_amount;
+	unsigned int position;
+	unsigned int count;
 
-	hs64->message_length++;
-	pos = (unsigned int)(7 - hs64->byte_position_m);
-	shift_amount = pos << 3;
-	hs64->m[hs64->index_m] |= ((uint64_t)byte << shift_amount);
-
-	if (hs64->byte_position_m == 7)
+	position = hs64->message_length & 127;
+	hs64->message_length += length;
+	if (position != 0)
 	{
-		hs64->index_m++;
+		// Top up partially filled message buffer.
+		count = MIN(128 - position, length);
+		memcpy(&(hs64->m[position]), data, count);
+		data += count;
+		length -= count;
+		if ((position + count) < 128)
+		{
+			return;
+		}
+		sha512Block(hs64, hs64->m);
 	}
-	hs64->byte_position_m = (uint8_t)((hs64->byte_position_m + 1) & 7);
-	if (hs64->index_m == 16)
+	while (length >= 128)
 	{
-		sha512Block(hs64);
-		clearM(hs64);
+		sha512Block(hs64, data);
+		data += 128;
+		length -= 128;
 	}
+	memcpy(hs64->m, data, length);
 }
 
 /** Finalise the hashing of a message by writing appropriate padding and
@@ -271,53 +362,95 @@ static void sha512WriteByte(HashState64 *hs64, const uint8_t byte)
   */
 static void sha512Finish(uint8_t *out, HashState64 *hs64)
 {
-	uint32_t length_bits;
+	unsigned int position;
 	uint8_t i;
-	uint8_t buffer[16];
-
-	// Subsequent calls to sha512WriteByte() will keep incrementing
-	// message_length, so the calculation of length (in bits) must be
-	// done before padding.
-	length_bits = hs64->message_length << 3;
 
 	// Pad using a 1 bit followed by enough 0 bits to get the message buffer
 	// to exactly 896 bits full.
-	sha512WriteByte(hs64, (uint8_t)0x80);
-	while ((hs64->index_m != 14) || (hs64->byte_position_m != 0))
+	position = hs64->message_length & 127;
+	hs64->m[position++] = 0x80;
+	if (position > 112)
 	{
-		sha512WriteByte(hs64, 0);
+		memset(&(hs64->m[position]), 0, 128 - position);
+		sha512Block(hs64, hs64->m);
+		position = 0;
 	}
-	// Write 128 bit length (in bits).
-	memset(buffer, 0, 16);
-	writeU32BigEndian(&(buffer[12]), length_bits);
-	for (i = 0; i < 16; i++)
+	memset(&(hs64->m[position]), 0, 120 - position);
+	// Write 128 bit length (in bits). The upper 64 bits were zeroed above.
+	writeU32BigEndian(&(hs64->m[120]), hs64->message_length >> 29);
+	writeU32BigEndian(&(hs64->m[124]), hs64->message_length << 3);
+	sha512Block(hs64, hs64->m);
+	for (i = 0; i < 8; i++)
 	{
-		sha512WriteByte(hs64, buffer[i]);
+		writeU32BigEndian(&(out[i * 8]), hs64->h[i].hi);
+		writeU32BigEndian(&(out[i * 8 + 4]), hs64->h[i].lo);
 	}
+}
+
+/** Begin calculating a hash, starting from a saved intermediate hash value
+  * instead of the initial hash value. The saved hash value must be for
+  * exactly one (128 byte) message block.
+  * \param hs64 The 64 bit hash state to initialise.
+  * \param midstate The saved intermediate hash value, as 8 pairs of 32 bit
+  *                 words (most significant word first).
+  */
+static void sha512BeginFromMidstate(HashState64 *hs64, const uint32_t *midstate)
+{
+	uint8_t i;
+
 	for (i = 0; i < 8; i++)
 	{
-		writeU32BigEndian(&(out[i * 8]), (uint32_t)(hs64->h[i] >> 32));
-		writeU32BigEndian(&(out[i * 8 + 4]), (uint32_t)hs64->h[i]);
+		hs64->h[i].hi = midstate[i * 2];
+		hs64->h[i].lo = midstate[i * 2 + 1];
 	}
+	hs64->message_length = 128;
 }
 
-/** Calculate a 64 byte HMAC of an arbitrary message and key using SHA-512 as
-  * the hash function.
+/** Compute the hash value after processing (K_0 XOR pad), where K_0 is
+  * a padded key.
+  * \param midstate The resulting intermediate hash value will be written
+  *                 here (8 pairs of 32 bit words, most significant word
+  *                 first).
+  * \param padded_key The 128 byte padded key K_0.
+  * \param pad The byte to XOR every byte of the padded key with (0x36 for
+  *            ipad, 0x5c for opad).
+  */
+static void computePadMidstate(uint32_t *midstate, const uint8_t *padded_key, const uint8_t pad)
+{
+	HashState64 hs64;
+	uint8_t block[128];
+	uint8_t i;
+
+	for (i = 0; i < 128; i++)
+	{
+		block[i] = (uint8_t)(padded_key[i] ^ pad);
+	}
+	sha512Begin(&hs64);
+	sha512Block(&hs64, block);
+	for (i = 0; i < 8; i++)
+	{
+		midstate[i * 2] = hs64.h[i].hi;
+		midstate[i * 2 + 1] = hs64.h[i].lo;
+	}
+	memset(&hs64, 0, sizeof(hs64));
+	memset(block, 0, sizeof(block));
+}
+
+/** Prepare a HMAC-SHA512 context for a key. This hashes the
+  * (K_0 XOR ipad) and (K_0 XOR opad) blocks once, so that
+  * hmacSha512WithContext() only needs to hash the message and the inner
+  * hash. That saves two SHA-512 compressions per HMAC, which makes a big
+  * difference when the same key is used many times (for example, in
+  * PBKDF2).
   * The code in here is based on the description in section 5
   * ("HMAC SPECIFICATION") of FIPS PUB 198.
-  * \param out A byte array where the HMAC-SHA512 hash value will be written.
-  *            This must have space for #SHA512_HASH_LENGTH bytes.
+  * \param ctx The HMAC-SHA512 context to initialise.
   * \param key A byte array containing the key to use in the HMAC-SHA512
   *            calculation. The key can be of any length.
   * \param key_length The length, in bytes, of the key.
-  * \param text A byte array containing the message to use in the HMAC-SHA512
-  *             calculation. The message can be of any length.
-  * \param text_length The length, in bytes, of the message.
   */
-void hmacSha512(uint8_t *out, const uint8_t *key, const unsigned int key_length, const uint8_t *text, const unsigned int text_length)
+void hmacSha512Init(HmacSha512Context *ctx, const uint8_t *key, const unsigned int key_length)
 {
-	unsigned int i;
-	uint8_t hash[SHA512_HASH_LENGTH];
 	uint8_t padded_key[128];
 	HashState64 hs64;
 
@@ -330,34 +463,70 @@ void hmacSha512(uint8_t *out, const uint8_t *key, const unsigned int key_length,
 	else
 	{
 		sha512Begin(&hs64);
-		for (i = 0; i < key_length; i++)
-		{
-			sha512WriteByte(&hs64, key[i]);
-		}
+		sha512WriteBytes(&hs64, key, key_length);
 		sha512Finish(padded_key, &hs64);
+		memset(&hs64, 0, sizeof(hs64));
 	}
+	computePadMidstate(ctx->inner_h, padded_key, 0x36);
+	computePadMidstate(ctx->outer_h, padded_key, 0x5c);
+	memset(padded_key, 0, sizeof(padded_key));
+}
+
+/** Calculate a 64 byte HMAC of an arbitrary message, using a key which was
+  * set up by hmacSha512Init().
+  * \param out A byte array where the HMAC-SHA512 hash value will be written.
+  *            This must have space for #SHA512_HASH_LENGTH bytes. This may
+  *            overlap text.
+  * \param ctx The HMAC-SHA512 context, initialised by hmacSha512Init().
+  * \param text A byte array containing the message to use in the HMAC-SHA512
+  *             calculation. The message can be of any length.
+  * \param text_length The length, in bytes, of the message.
+  */
+void hmacSha512WithContext(uint8_t *out, const HmacSha512Context *ctx, const uint8_t *text, const unsigned int text_length)
+{
+	uint8_t hash[SHA512_HASH_LENGTH];
+	HashState64 hs64;
+
 	// Calculate hash = H((K_0 XOR ipad) || text).
-	sha512Begin(&hs64);
-	for (i = 0; i < 128; i++)
-	{
-		sha512WriteByte(&hs64, (uint8_t)(padded_key[i] ^ 0x36));
-	}
-	for (i = 0; i < text_length; i++)
-	{
-		sha512WriteByte(&hs64, text[i]);
-	}
+	sha512BeginFromMidstate(&hs64, ctx->inner_h);
+	sha512WriteBytes(&hs64, text, text_length);
 	sha512Finish(hash, &hs64);
 	// Calculate H((K_0 XOR opad) || hash).
-	sha512Begin(&hs64);
-	for (i = 0; i < 128; i++)
-	{
-		sha512WriteByte(&hs64, (uint8_t)(padded_key[i] ^ 0x5c));
-	}
-	for (i = 0; i < sizeof(hash); i++)
-	{
-		sha512WriteByte(&hs64, hash[i]);
-	}
+	sha512BeginFromMidstate(&hs64, ctx->outer_h);
+	sha512WriteBytes(&hs64, hash, sizeof(hash));
 	sha512Finish(out, &hs64);
+	memset(&hs64, 0, sizeof(hs64));
+	memset(hash, 0, sizeof(hash));
+}
+
+/** Clear out a HMAC-SHA512 context, since the intermediate hash values
+  * in it are as good as the key.
+  * \param ctx The HMAC-SHA512 context to clear.
+  */
+void hmacSha512ClearContext(HmacSha512Context *ctx)
+{
+	memset(ctx, 0, sizeof(HmacSha512Context));
+}
+
+/** Calculate a 64 byte HMAC of an arbitrary message and key using SHA-512 as
+  * the hash function. To calculate many HMACs with the same key, it's faster
+  * to use hmacSha512Init() once, followed by hmacSha512WithContext().
+  * \param out A byte array where the HMAC-SHA512 hash value will be written.
+  *            This must have space for #SHA512_HASH_LENGTH bytes.
+  * \param key A byte array containing the key to use in the HMAC-SHA512
+  *            calculation. The key can be of any length.
+  * \param key_length The length, in bytes, of the key.
+  * \param text A byte array containing the message to use in the HMAC-SHA512
+  *             calculation. The message can be of any length.
+  * \param text_length The length, in bytes, of the message.
+  */
+void hmacSha512(uint8_t *out, const uint8_t *key, const unsigned int key_length, const uint8_t *text, const unsigned int text_length)
+{
+	HmacSha512Context ctx;
+
+	hmacSha512Init(&ctx, key, key_length);
+	hmacSha512WithContext(out, &ctx, text, text_length);
+	hmacSha512ClearContext(&ctx);
 }
 
 #ifdef TEST_HMAC_SHA512
@@ -483,10 +652,257 @@ http://csrc.nist.gov/groups/STM/cavp/index.html#07", filename);
 	fclose(f);
 }
 
+/** Straightforward SHA-512 compression function using native 64 bit
+  * arithmetic, written directly from section 6.4.2 of FIPS PUB 180-4. This
+  * is used as a reference for sha512Block() and as the baseline in
+  * benchmarkCompression().
+  * \param h The 8 word hash value to update.
+  * \param block The 128 byte message block.
+  */
+static void referenceSha512Block(uint64_t *h, const uint8_t *block)
+{
+	uint64_t v[8];
+	uint64_t w[80];
+	uint64_t kt;
+	uint64_t t1;
+	uint64_t t2;
+	uint8_t t;
+	uint8_t i;
+
+#define REF_ROTR(x, n)	(((x) >> (n)) | ((x) << (64 - (n))))
+	for (t = 0; t < 16; t++)
+	{
+		w[t] = 0;
+		for (i = 0; i < 8; i++)
+		{
+			w[t] = (w[t] << 8) | block[t * 8 + i];
+		}
+	}
+	for (t = 16; t < 80; t++)
+	{
+		w[t] = (REF_ROTR(w[t - 2], 19) ^ REF_ROTR(w[t - 2], 61) ^ (w[t - 2] >> 6))
+			+ w[t - 7]
+			+ (REF_ROTR(w[t - 15], 1) ^ REF_ROTR(w[t - 15], 8) ^ (w[t - 15] >> 7))
+			+ w[t - 16];
+	}
+	memcpy(v, h, sizeof(v));
+	for (t = 0; t < 80; t++)
+	{
+		kt = ((uint64_t)k[t * 2] << 32) | k[t * 2 + 1];
+		t1 = v[7] + (REF_ROTR(v[4], 14) ^ REF_ROTR(v[4], 18) ^ REF_ROTR(v[4], 41))
+			+ ((v[4] & v[5]) ^ ((~v[4]) & v[6])) + kt + w[t];
+		t2 = (REF_ROTR(v[0], 28) ^ REF_ROTR(v[0], 34) ^ REF_ROTR(v[0], 39))
+			+ ((v[0] & v[1]) ^ (v[0] & v[2]) ^ (v[1] & v[2]));
+		memmove(&(v[1]), &(v[0]), 7 * sizeof(uint64_t));
+		v[4] += t1;
+		v[0] = t1 + t2;
+	}
+	for (i = 0; i < 8; i++)
+	{
+		h[i] += v[i];
+	}
+#undef REF_ROTR
+}
+
+/** Check sha512Block() against referenceSha512Block() using random hash
+  * values and message blocks. */
+static void testBlock(void)
+{
+	HashState64 hs64;
+	uint64_t reference_h[8];
+	uint8_t block[128];
+	unsigned int test;
+	unsigned int i;
+	int mismatch;
+
+	for (test = 0; test < 1000; test++)
+	{
+		for (i = 0; i < 8; i++)
+		{
+			hs64.h[i].hi = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+			hs64.h[i].lo = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+			reference_h[i] = ((uint64_t)hs64.h[i].hi << 32) | hs64.h[i].lo;
+		}
+		for (i = 0; i < sizeof(block); i++)
+		{
+			block[i] = (uint8_t)rand();
+		}
+		sha512Block(&hs64, block);
+		referenceSha512Block(reference_h, block);
+		mismatch = 0;
+		for (i = 0; i < 8; i++)
+		{
+			if ((hs64.h[i].hi != (uint32_t)(reference_h[i] >> 32))
+				|| (hs64.h[i].lo != (uint32_t)reference_h[i]))
+			{
+				mismatch = 1;
+			}
+		}
+		if (mismatch)
+		{
+			printf("sha512Block() mismatch on test %u\n", test);
+			reportFailure();
+		}
+		else
+		{
+			reportSuccess();
+		}
+	}
+}
+
+/** Stores one plain SHA-512 test vector. */
+struct Sha512TestVector
+{
+	const char *message;
+	const uint8_t expected_result[SHA512_HASH_LENGTH];
+};
+
+/** The one and two block SHA-512 examples from
+  * http://csrc.nist.gov/groups/ST/toolkit/examples.html. The HMAC test
+  * vectors never place the end of a message where the padding spills into
+  * an extra block, but the second example does.
+  * \showinitializer
+  */
+static const struct Sha512TestVector sha512_test_vectors[] =
+{
+
+{"abc",
+{0xdd, 0xaf, 0x35, 0xa1, 0x93, 0x61, 0x7a, 0xba,
+0xcc, 0x41, 0x73, 0x49, 0xae, 0x20, 0x41, 0x31,
+0x12, 0xe6, 0xfa, 0x4e, 0x89, 0xa9, 0x7e, 0xa2,
+0x0a, 0x9e, 0xee, 0xe6, 0x4b, 0x55, 0xd3, 0x9a,
+0x21, 0x92, 0x99, 0x2a, 0x27, 0x4f, 0xc1, 0xa8,
+0x36, 0xba, 0x3c, 0x23, 0xa3, 0xfe, 0xeb, 0xbd,
+0x45, 0x4d, 0x44, 0x23, 0x64, 0x3c, 0xe8, 0x0e,
+0x2a, 0x9a, 0xc9, 0x4f, 0xa5, 0x4c, 0xa4, 0x9f}},
+
+{"abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu",
+{0x8e, 0x95, 0x9b, 0x75, 0xda, 0xe3, 0x13, 0xda,
+0x8c, 0xf4, 0xf7, 0x28, 0x14, 0xfc, 0x14, 0x3f,
+0x8f, 0x77, 0x79, 0xc6, 0xeb, 0x9f, 0x7f, 0xa1,
+0x72, 0x99, 0xae, 0xad, 0xb6, 0x88, 0x90, 0x18,
+0x50, 0x1d, 0x28, 0x9e, 0x49, 0x00, 0xf7, 0xe4,
+0x33, 0x1b, 0x99, 0xde, 0xc4, 0xb5, 0x43, 0x3a,
+0xc7, 0xd3, 0x29, 0xee, 0xb6, 0xdd, 0x26, 0x54,
+0x5e, 0x96, 0xe5, 0x5b, 0x87, 0x4b, 0xe9, 0x09}}
+};
+
+/** Check plain SHA-512 against #sha512_test_vectors, and check that
+  * splitting a message across several sha512WriteBytes() calls (at various
+  * unaligned places) doesn't change its hash. */
+static void testWriteBytes(void)
+{
+	uint8_t message[1000];
+	uint8_t compare_out[SHA512_HASH_LENGTH];
+	uint8_t out[SHA512_HASH_LENGTH];
+	HashState64 hs64;
+	unsigned int num_test_vectors;
+	unsigned int length;
+	unsigned int split;
+	unsigned int i;
+
+	num_test_vectors = sizeof(sha512_test_vectors) / sizeof(struct Sha512TestVector);
+	for (i = 0; i < num_test_vectors; i++)
+	{
+		sha512Begin(&hs64);
+		sha512WriteBytes(&hs64, (const uint8_t *)sha512_test_vectors[i].message, (unsigned int)strlen(sha512_test_vectors[i].message));
+		sha512Finish(out, &hs64);
+		if (memcmp(out, sha512_test_vectors[i].expected_result, SHA512_HASH_LENGTH))
+		{
+			printf("SHA-512 test vector %u mismatch\n", i);
+			reportFailure();
+		}
+		else
+		{
+			reportSuccess();
+		}
+	}
+
+	for (i = 0; i < sizeof(message); i++)
+	{
+		message[i] = (uint8_t)rand();
+	}
+	for (length = 0; length < sizeof(message); length++)
+	{
+		sha512Begin(&hs64);
+		sha512WriteBytes(&hs64, message, length);
+		sha512Finish(compare_out, &hs64);
+		for (split = 0; split <= length; split += 1 + (split / 8))
+		{
+			sha512Begin(&hs64);
+			sha512WriteBytes(&hs64, message, split);
+			sha512WriteBytes(&hs64, &(message[split]), (length - split) / 2);
+			sha512WriteBytes(&hs64, &(message[split + (length - split) / 2]), length - split - (length - split) / 2);
+			sha512Finish(out, &hs64);
+			if (memcmp(out, compare_out, SHA512_HASH_LENGTH))
+			{
+				printf("sha512WriteBytes() mismatch, length = %u, split = %u\n", length, split);
+				reportFailure();
+			}
+			else
+			{
+				reportSuccess();
+			}
+		}
+	}
+}
+
+/** Compare the speed of sha512Block() against referenceSha512Block(), in
+  * compressions per second, and report how many HMAC-SHA512 evaluations per
+  * second the precomputed context allows. This doesn't test anything; it
+  * just prints the results. */
+static void benchmarkCompression(void)
+{
+	HashState64 hs64;
+	HmacSha512Context ctx;
+	uint64_t reference_h[8];
+	uint8_t block[128];
+	uint8_t out[SHA512_HASH_LENGTH];
+	clock_t start;
+	double seconds;
+	uint32_t iterations;
+	uint32_t i;
+
+	iterations = 200000;
+	memset(block, 0x5a, sizeof(block));
+	memset(reference_h, 0, sizeof(reference_h));
+	start = clock();
+	for (i = 0; i < iterations; i++)
+	{
+		referenceSha512Block(reference_h, block);
+	}
+	seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+	printf("uint64_t reference: %.0f compressions/s\n", (double)iterations / seconds);
+	sha512Begin(&hs64);
+	start = clock();
+	for (i = 0; i < iterations; i++)
+	{
+		sha512Block(&hs64, block);
+	}
+	seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+	printf("sha512Block():      %.0f compressions/s\n", (double)iterations / seconds);
+	// Stop the compiler from discarding the loops above.
+	block[0] = (uint8_t)(reference_h[0] ^ hs64.h[0].lo);
+
+	hmacSha512Init(&ctx, block, sizeof(block));
+	memset(out, 0, sizeof(out));
+	iterations /= 2;
+	start = clock();
+	for (i = 0; i < iterations; i++)
+	{
+		hmacSha512WithContext(out, &ctx, out, sizeof(out));
+	}
+	seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+	printf("hmacSha512WithContext(): %.0f HMACs/s\n", (double)iterations / seconds);
+}
+
 int main(void)
 {
 	initTests(__FILE__);
+	testBlock();
+	testWriteBytes();
 	scanTestVectors("HMAC.rsp");
+	benchmarkCompression();
 	finishTests();
 	exit(0);
 }
@@ -13,6 +13,21 @@
 /** Number of bytes a SHA-512 hash requires. */
 #define SHA512_HASH_LENGTH		64
 
+/** Precomputed state for calculating many HMAC-SHA512 values with the same
+  * key. Use hmacSha512Init() to set one of these up. */
+typedef struct HmacSha512ContextStruct
+{
+	/** SHA-512 intermediate hash value after processing (K_0 XOR ipad), as
+	  * 8 pairs of 32 bit words (most significant word first). */
+	uint32_t inner_h[16];
+	/** SHA-512 intermediate hash value after processing (K_0 XOR opad), as
+	  * 8 pairs of 32 bit words (most significant word first). */
+	uint32_t outer_h[16];
+} HmacSha512Context;
+
+extern void hmacSha512Init(HmacSha512Context *ctx, const uint8_t *key, const unsigned int key_length);
+extern void hmacSha512WithContext(uint8_t *out, const HmacSha512Context *ctx, const uint8_t *text, const unsigned int text_length);
+extern void hmacSha512ClearContext(HmacSha512Context *ctx);
 extern void hmacSha512(uint8_t *out, const uint8_t *key, const unsigned int key_length, const uint8_t *text, const unsigned int text_length);
 
 #endif // #ifndef HMAC_SHA512_H_INCLUDED
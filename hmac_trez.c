@@ -55,11 +55,10 @@ void hmac_sha256(const uint8_t *key, const uint32_t keylen, const uint8_t *msg,
 	sha256_Final(hmac, &ctx);
 }
 
-void hmac_sha512(const uint8_t *key, const uint32_t keylen, const uint8_t *msg, const uint32_t msglen, uint8_t *hmac)
+void hmac_sha512_prepare(const uint8_t *key, const uint32_t keylen, HMAC_SHA512_CTX *hctx)
 {
 	int i;
 	uint8_t buf[SHA512_BLOCK_LENGTH], o_key_pad[SHA512_BLOCK_LENGTH], i_key_pad[SHA512_BLOCK_LENGTH];
-	SHA512_CTX ctx;
 
 	memset(buf, 0, SHA512_BLOCK_LENGTH);
 	if (keylen > SHA512_BLOCK_LENGTH) {
@@ -73,13 +72,37 @@ void hmac_sha512(const uint8_t *key, const uint32_t keylen, const uint8_t *msg,
 		i_key_pad[i] = buf[i] ^ 0x36;
 	}
 
-	sha512_Init(&ctx);
-	sha512_Update(&ctx, i_key_pad, SHA512_BLOCK_LENGTH);
+	sha512_Init(&hctx->inner);
+	sha512_Update(&hctx->inner, i_key_pad, SHA512_BLOCK_LENGTH);
+	sha512_Init(&hctx->outer);
+	sha512_Update(&hctx->outer, o_key_pad, SHA512_BLOCK_LENGTH);
+
+	memset(buf, 0, sizeof(buf));
+	memset(o_key_pad, 0, sizeof(o_key_pad));
+	memset(i_key_pad, 0, sizeof(i_key_pad));
+}
+
+void hmac_sha512_prepared(const HMAC_SHA512_CTX *hctx, const uint8_t *msg, const uint32_t msglen, uint8_t *hmac)
+{
+	uint8_t buf[SHA512_DIGEST_LENGTH];
+	SHA512_CTX ctx;
+
+	memcpy(&ctx, &hctx->inner, sizeof(SHA512_CTX));
 	sha512_Update(&ctx, msg, msglen);
 	sha512_Final(buf, &ctx);
 
-	sha512_Init(&ctx);
-	sha512_Update(&ctx, o_key_pad, SHA512_BLOCK_LENGTH);
+	memcpy(&ctx, &hctx->outer, sizeof(SHA512_CTX));
 	sha512_Update(&ctx, buf, SHA512_DIGEST_LENGTH);
 	sha512_Final(hmac, &ctx);
+
+	memset(buf, 0, sizeof(buf));
+}
+
+void hmac_sha512(const uint8_t *key, const uint32_t keylen, const uint8_t *msg, const uint32_t msglen, uint8_t *hmac)
+{
+	HMAC_SHA512_CTX hctx;
+
+	hmac_sha512_prepare(key, keylen, &hctx);
+	hmac_sha512_prepared(&hctx, msg, msglen, hmac);
+	memset(&hctx, 0, sizeof(hctx));
 }
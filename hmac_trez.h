@@ -25,13 +25,23 @@
 #define __HMAC_H__
 
 #include <stdint.h>
+#include "sha2_trez.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// SHA-512 states after absorbing the inner and outer key pads, so that
+// repeated HMACs with the same key skip two compressions each.
+typedef struct _HMAC_SHA512_CTX {
+	SHA512_CTX	inner;
+	SHA512_CTX	outer;
+} HMAC_SHA512_CTX;
+
 void hmac_sha256(const uint8_t *key, const uint32_t keylen, const uint8_t *msg, const uint32_t msglen, uint8_t *hmac);
 void hmac_sha512(const uint8_t *key, const uint32_t keylen, const uint8_t *msg, const uint32_t msglen, uint8_t *hmac);
+void hmac_sha512_prepare(const uint8_t *key, const uint32_t keylen, HMAC_SHA512_CTX *hctx);
+void hmac_sha512_prepared(const HMAC_SHA512_CTX *hctx, const uint8_t *msg, const uint32_t msglen, uint8_t *hmac);
 
 #ifdef __cplusplus
 } // extern "C"
@@ -20,7 +20,14 @@
      extern "C" {
 #endif
 
-#define MAX_INPUTS				128
+/** The maximum number of inputs a spending transaction may have. This only
+  * limits the transaction parser; it does not affect memory use. */
+#define MAX_INPUTS				2000
+/** The maximum number of inputs which can be signed by one sign request.
+  * Per-input signing state is sized by this, so transactions with more
+  * inputs must be signed with the streaming sign mode, one window of
+  * inputs at a time. */
+#define MAX_SIGNED_INPUTS		128
 
 //     must be multiple of 256
 //#define EEPROM_SIZE		 1024
@@ -224,6 +231,16 @@ extern uint16_t getStringLength(StringSet set, uint8_t spec);
   * \return The received byte.
   */
 extern uint8_t streamGetOneByte(void);
+/** Grab a number of bytes from the communication stream. This behaves
+  * exactly like calling streamGetOneByte() length times, but it lets the
+  * stream implementation move data in blocks instead of one byte at a time.
+  * Like streamGetOneByte(), this only returns if all the bytes were received
+  * free of read errors.
+  * \param buffer The byte array where the received bytes will be written.
+  *               This must have space for length bytes.
+  * \param length The number of bytes to receive.
+  */
+extern void streamGetBytes(uint8_t *buffer, uint32_t length);
 /** Send one byte to the communication stream. There is no way for this
   * function to indicate a write error. This is intentional; it
   * makes program flow simpler (no need to put checks everywhere). As a
@@ -326,6 +343,29 @@ extern NonVolatileReturn nonVolatileRead(uint8_t *data, uint32_t address, uint32
   */
 extern NonVolatileReturn nonVolatileFlush(void);
 
+/** Supplies the data for nonVolatileFill(). This is called repeatedly, in
+  * address order.
+  * \param buffer The data should be written here.
+  * \param length The number of bytes to write into buffer.
+  * \param arg The arg parameter passed to nonVolatileFill().
+  */
+typedef void (*NonVolatileFillSource)(uint8_t *buffer, uint32_t length, void *arg);
+
+/** Fill an area of non-volatile storage, a whole page at a time where
+  * possible. This is for overwriting large areas (eg. when formatting), and
+  * is much faster than an equivalent sequence of nonVolatileWrite() calls.
+  * Unlike nonVolatileWrite(), the area is committed to non-volatile storage
+  * before this returns.
+  * \param address Byte offset specifying where in non-volatile storage to
+  *                start filling.
+  * \param length The number of bytes to fill.
+  * \param value If source is NULL, every byte is set to this value.
+  * \param source If not NULL, this is called to supply the data to fill with.
+  * \param arg Passed to source.
+  * \return See #NonVolatileReturnEnum for return values.
+  */
+extern NonVolatileReturn nonVolatileFill(uint32_t address, uint32_t length, uint8_t value, NonVolatileFillSource source, void *arg);
+
 /** Overwrite anything in RAM which could contain sensitive data. "Sensitive
   * data" includes secret things like encryption keys and wallet private keys.
   * It also includes derived things like expanded keys and intermediate
@@ -374,7 +414,6 @@ extern void Software_Reset(void);
 
 extern uint8_t bluetooth_on;
 extern uint8_t is_formatted;
-extern uint8_t message_slice_counter;
 extern bool moofOn;
 
 extern bool buttonInterjectionNoAck(AskUserCommand command);
@@ -15,12 +15,14 @@ const bool BackupWallet_is_encrypted_default = false;
 const uint32_t BackupWallet_device_default = 0u;
 
 
-const pb_field_t Initialize_fields[2] = {
+const pb_field_t Initialize_fields[4] = {
     PB_FIELD(  1, BYTES   , REQUIRED, STATIC  , FIRST, Initialize, session_id, session_id, 0),
+    PB_FIELD(  2, BOOL    , OPTIONAL, STATIC  , OTHER, Initialize, chunked_framing, session_id, 0),
+    PB_FIELD(  3, UINT32  , OPTIONAL, STATIC  , OTHER, Initialize, transmit_window, chunked_framing, 0),
     PB_LAST_FIELD
 };
 
-const pb_field_t Features_fields[13] = {
+const pb_field_t Features_fields[15] = {
     PB_FIELD(  1, BYTES   , REQUIRED, STATIC  , FIRST, Features, echoed_session_id, echoed_session_id, 0),
     PB_FIELD(  2, STRING  , OPTIONAL, CALLBACK, OTHER, Features, vendor, echoed_session_id, 0),
     PB_FIELD(  3, UINT32  , OPTIONAL, STATIC  , OTHER, Features, major_version, vendor, 0),
@@ -33,6 +35,8 @@ const pb_field_t Features_fields[13] = {
     PB_FIELD( 10, BOOL    , OPTIONAL, STATIC  , OTHER, Features, debug_link, algo, 0),
     PB_FIELD( 11, BOOL    , OPTIONAL, STATIC  , OTHER, Features, is_formatted, debug_link, 0),
     PB_FIELD( 12, BYTES   , OPTIONAL, STATIC  , OTHER, Features, device_name, is_formatted, 0),
+    PB_FIELD( 13, BOOL    , OPTIONAL, STATIC  , OTHER, Features, chunked_framing, device_name, 0),
+    PB_FIELD( 14, UINT32  , OPTIONAL, STATIC  , OTHER, Features, transmit_window, chunked_framing, 0),
     PB_LAST_FIELD
 };
 
@@ -148,6 +152,19 @@ const pb_field_t SignatureComplete_fields[2] = {
     PB_LAST_FIELD
 };
 
+const pb_field_t SignTransactionStreaming_fields[4] = {
+    PB_FIELD(  1, MESSAGE , REPEATED, CALLBACK, FIRST, SignTransactionStreaming, address_handle_extended, address_handle_extended, &AddressHandleExtended_fields),
+    PB_FIELD(  2, UINT32  , REQUIRED, STATIC  , OTHER, SignTransactionStreaming, first_input, address_handle_extended, 0),
+    PB_FIELD(  3, BYTES   , REQUIRED, CALLBACK, OTHER, SignTransactionStreaming, transaction_data, first_input, 0),
+    PB_LAST_FIELD
+};
+
+const pb_field_t SignatureStreamData_fields[3] = {
+    PB_FIELD(  1, UINT32  , REQUIRED, STATIC  , FIRST, SignatureStreamData, input_index, input_index, 0),
+    PB_FIELD(  2, BYTES   , REQUIRED, STATIC  , OTHER, SignatureStreamData, signature_data_complete, input_index, 0),
+    PB_LAST_FIELD
+};
+
 const pb_field_t LoadWallet_fields[2] = {
     PB_FIELD(  1, UINT32  , OPTIONAL, STATIC  , FIRST, LoadWallet, wallet_number, wallet_number, &LoadWallet_wallet_number_default),
     PB_LAST_FIELD
@@ -231,7 +248,7 @@ const pb_field_t Bulk_fields[2] = {
 };
 
 const pb_field_t SetBulk_fields[2] = {
-    PB_FIELD(  1, BYTES   , REQUIRED, STATIC  , FIRST, SetBulk, bulk, bulk, 0),
+    PB_FIELD(  1, BYTES   , REQUIRED, CALLBACK, FIRST, SetBulk, bulk, bulk, 0),
     PB_LAST_FIELD
 };
 
@@ -293,11 +310,11 @@ const pb_field_t SetChangeAddressIndex_fields[2] = {
  * numbers or field sizes that are larger than what can fit in 8 or 16 bit
  * field descriptors.
  */
-PB_STATIC_ASSERT((pb_membersize(SignTransactionExtended, address_handle_extended) < 65536 && pb_membersize(SignatureComplete, signature_complete_data) < 65536 && pb_membersize(Wallets, wallet_info) < 65536 && pb_membersize(RestoreWallet, new_wallet) < 65536 && pb_membersize(SignMessage, address_handle_extended) < 65536), YOU_MUST_DEFINE_PB_FIELD_32BIT_FOR_MESSAGES_Initialize_Features_Ping_PingResponse_Success_Failure_ButtonRequest_ButtonAck_ButtonCancel_PinRequest_PinAck_PinCancel_OtpRequest_OtpAck_OtpCancel_DeleteWallet_NewWallet_Address_AddressPubKey_GetAddressAndPublicKey_AddressHandleExtended_SignTransactionExtended_SignatureCompleteData_SignatureComplete_LoadWallet_FormatWalletArea_ChangeEncryptionKey_ChangeWalletName_ChangeDeviceName_ListWallets_WalletInfo_Wallets_BackupWallet_RestoreWallet_GetDeviceUUID_DeviceUUID_GetEntropy_Entropy_GetBulk_Bulk_SetBulk_GetMasterPublicKey_MasterPublicKey_ResetLang_ResetPIN_ScanWallet_CurrentWalletXPUB_SignMessage_SignatureMessage_DisplayAddressAsQR_SetChangeAddressIndex)
+PB_STATIC_ASSERT((pb_membersize(SignTransactionExtended, address_handle_extended) < 65536 && pb_membersize(SignatureComplete, signature_complete_data) < 65536 && pb_membersize(SignTransactionStreaming, address_handle_extended) < 65536 && pb_membersize(Wallets, wallet_info) < 65536 && pb_membersize(RestoreWallet, new_wallet) < 65536 && pb_membersize(SignMessage, address_handle_extended) < 65536), YOU_MUST_DEFINE_PB_FIELD_32BIT_FOR_MESSAGES_Initialize_Features_Ping_PingResponse_Success_Failure_ButtonRequest_ButtonAck_ButtonCancel_PinRequest_PinAck_PinCancel_OtpRequest_OtpAck_OtpCancel_DeleteWallet_NewWallet_Address_AddressPubKey_GetAddressAndPublicKey_AddressHandleExtended_SignTransactionExtended_SignatureCompleteData_SignatureComplete_SignTransactionStreaming_SignatureStreamData_LoadWallet_FormatWalletArea_ChangeEncryptionKey_ChangeWalletName_ChangeDeviceName_ListWallets_WalletInfo_Wallets_BackupWallet_RestoreWallet_GetDeviceUUID_DeviceUUID_GetEntropy_Entropy_GetBulk_Bulk_SetBulk_GetMasterPublicKey_MasterPublicKey_ResetLang_ResetPIN_ScanWallet_CurrentWalletXPUB_SignMessage_SignatureMessage_DisplayAddressAsQR_SetChangeAddressIndex)
 #endif
 
 #if !defined(PB_FIELD_16BIT) && !defined(PB_FIELD_32BIT)
-#error Field descriptor for SetBulk.bulk is too large. Define PB_FIELD_16BIT to fix this.
+#error Field descriptor for SignatureMessage.signature_data_complete_message is too large. Define PB_FIELD_16BIT to fix this.
 #endif
 
 
@@ -92,6 +92,10 @@ typedef struct _ScanWallet {
     uint8_t dummy_field;
 } ScanWallet;
 
+typedef struct _SetBulk {
+    pb_callback_t bulk;
+} SetBulk;
+
 typedef struct _SignTransactionExtended {
     pb_callback_t address_handle_extended;
     pb_callback_t transaction_data;
@@ -201,6 +205,10 @@ typedef struct _Features {
     bool is_formatted;
     bool has_device_name;
     Features_device_name_t device_name;
+    bool has_chunked_framing;
+    bool chunked_framing;
+    bool has_transmit_window;
+    uint32_t transmit_window;
 } Features;
 
 typedef PB_BYTES_ARRAY_T(32) FormatWalletArea_initial_entropy_pool_t;
@@ -221,6 +229,10 @@ typedef PB_BYTES_ARRAY_T(64) Initialize_session_id_t;
 
 typedef struct _Initialize {
     Initialize_session_id_t session_id;
+    bool has_chunked_framing;
+    bool chunked_framing;
+    bool has_transmit_window;
+    uint32_t transmit_window;
 } Initialize;
 
 typedef struct _LoadWallet {
@@ -266,17 +278,18 @@ typedef struct _PingResponse {
     PingResponse_echoed_session_id_t echoed_session_id;
 } PingResponse;
 
-typedef PB_BYTES_ARRAY_T(21232) SetBulk_bulk_t;
-
-typedef struct _SetBulk {
-    SetBulk_bulk_t bulk;
-} SetBulk;
 
 typedef struct _SetChangeAddressIndex {
     bool has_address_handle_index;
     uint32_t address_handle_index;
 } SetChangeAddressIndex;
 
+typedef struct _SignTransactionStreaming {
+    pb_callback_t address_handle_extended;
+    uint32_t first_input;
+    pb_callback_t transaction_data;
+} SignTransactionStreaming;
+
 typedef PB_BYTES_ARRAY_T(109) SignatureCompleteData_signature_data_complete_t;
 
 typedef struct _SignatureCompleteData {
@@ -289,6 +302,13 @@ typedef struct _SignatureMessage {
     SignatureMessage_signature_data_complete_message_t signature_data_complete_message;
 } SignatureMessage;
 
+typedef PB_BYTES_ARRAY_T(109) SignatureStreamData_signature_data_complete_t;
+
+typedef struct _SignatureStreamData {
+    uint32_t input_index;
+    SignatureStreamData_signature_data_complete_t signature_data_complete;
+} SignatureStreamData;
+
 typedef PB_BYTES_ARRAY_T(40) WalletInfo_wallet_name_t;
 
 typedef PB_BYTES_ARRAY_T(16) WalletInfo_wallet_uuid_t;
@@ -322,8 +342,8 @@ extern const bool BackupWallet_is_encrypted_default;
 extern const uint32_t BackupWallet_device_default;
 
 /* Initializer values for message structs */
-#define Initialize_init_default                  {{0, {0}}}
-#define Features_init_default                    {{0, {0}}, {{NULL}, NULL}, false, 0, false, 0, {{NULL}, NULL}, false, 0, false, 0, false, 0, 0, {(Algorithm)0, (Algorithm)0}, false, 0, false, 0, false, {0, {0}}}
+#define Initialize_init_default                  {{0, {0}}, false, 0, false, 0}
+#define Features_init_default                    {{0, {0}}, {{NULL}, NULL}, false, 0, false, 0, {{NULL}, NULL}, false, 0, false, 0, false, 0, 0, {(Algorithm)0, (Algorithm)0}, false, 0, false, 0, false, {0, {0}}, false, 0, false, 0}
 #define Ping_init_default                        {false, ""}
 #define PingResponse_init_default                {false, "", {0, {0}}}
 #define Success_init_default                     {0}
@@ -346,6 +366,8 @@ extern const uint32_t BackupWallet_device_default;
 #define SignTransactionExtended_init_default     {{{NULL}, NULL}, {{NULL}, NULL}}
 #define SignatureCompleteData_init_default       {{0, {0}}}
 #define SignatureComplete_init_default           {{{NULL}, NULL}}
+#define SignTransactionStreaming_init_default    {{{NULL}, NULL}, 0, {{NULL}, NULL}}
+#define SignatureStreamData_init_default         {0, {0, {0}}}
 #define LoadWallet_init_default                  {false, 0u}
 #define FormatWalletArea_init_default            {{0, {0}}}
 #define ChangeEncryptionKey_init_default         {{{NULL}, NULL}}
@@ -362,7 +384,7 @@ extern const uint32_t BackupWallet_device_default;
 #define Entropy_init_default                     {{{NULL}, NULL}}
 #define GetBulk_init_default                     {0}
 #define Bulk_init_default                        {{{NULL}, NULL}}
-#define SetBulk_init_default                     {{0, {0}}}
+#define SetBulk_init_default                     {{{NULL}, NULL}}
 #define GetMasterPublicKey_init_default          {0}
 #define MasterPublicKey_init_default             {{0, {0}}, {0, {0}}}
 #define ResetLang_init_default                   {0}
@@ -373,8 +395,8 @@ extern const uint32_t BackupWallet_device_default;
 #define SignatureMessage_init_default            {{0, {0}}}
 #define DisplayAddressAsQR_init_default          {false, 0}
 #define SetChangeAddressIndex_init_default       {false, 0}
-#define Initialize_init_zero                     {{0, {0}}}
-#define Features_init_zero                       {{0, {0}}, {{NULL}, NULL}, false, 0, false, 0, {{NULL}, NULL}, false, 0, false, 0, false, 0, 0, {(Algorithm)0, (Algorithm)0}, false, 0, false, 0, false, {0, {0}}}
+#define Initialize_init_zero                     {{0, {0}}, false, 0, false, 0}
+#define Features_init_zero                       {{0, {0}}, {{NULL}, NULL}, false, 0, false, 0, {{NULL}, NULL}, false, 0, false, 0, false, 0, 0, {(Algorithm)0, (Algorithm)0}, false, 0, false, 0, false, {0, {0}}, false, 0, false, 0}
 #define Ping_init_zero                           {false, ""}
 #define PingResponse_init_zero                   {false, "", {0, {0}}}
 #define Success_init_zero                        {0}
@@ -397,6 +419,8 @@ extern const uint32_t BackupWallet_device_default;
 #define SignTransactionExtended_init_zero        {{{NULL}, NULL}, {{NULL}, NULL}}
 #define SignatureCompleteData_init_zero          {{0, {0}}}
 #define SignatureComplete_init_zero              {{{NULL}, NULL}}
+#define SignTransactionStreaming_init_zero       {{{NULL}, NULL}, 0, {{NULL}, NULL}}
+#define SignatureStreamData_init_zero            {0, {0, {0}}}
 #define LoadWallet_init_zero                     {false, 0}
 #define FormatWalletArea_init_zero               {{0, {0}}}
 #define ChangeEncryptionKey_init_zero            {{{NULL}, NULL}}
@@ -413,7 +437,7 @@ extern const uint32_t BackupWallet_device_default;
 #define Entropy_init_zero                        {{{NULL}, NULL}}
 #define GetBulk_init_zero                        {0}
 #define Bulk_init_zero                           {{{NULL}, NULL}}
-#define SetBulk_init_zero                        {{0, {0}}}
+#define SetBulk_init_zero                        {{{NULL}, NULL}}
 #define GetMasterPublicKey_init_zero             {0}
 #define MasterPublicKey_init_zero                {{0, {0}}, {0, {0}}}
 #define ResetLang_init_zero                      {0}
@@ -463,10 +487,14 @@ extern const uint32_t BackupWallet_device_default;
 #define Features_debug_link_tag                  10
 #define Features_is_formatted_tag                11
 #define Features_device_name_tag                 12
+#define Features_chunked_framing_tag             13
+#define Features_transmit_window_tag             14
 #define FormatWalletArea_initial_entropy_pool_tag 1
 #define GetAddressAndPublicKey_address_handle_tag 1
 #define GetEntropy_number_of_bytes_tag           1
 #define Initialize_session_id_tag                1
+#define Initialize_chunked_framing_tag           2
+#define Initialize_transmit_window_tag           3
 #define LoadWallet_wallet_number_tag             1
 #define MasterPublicKey_public_key_tag           1
 #define MasterPublicKey_chain_code_tag           2
@@ -480,8 +508,13 @@ extern const uint32_t BackupWallet_device_default;
 #define PingResponse_echoed_session_id_tag       2
 #define SetBulk_bulk_tag                         1
 #define SetChangeAddressIndex_address_handle_index_tag 1
+#define SignTransactionStreaming_address_handle_extended_tag 1
+#define SignTransactionStreaming_first_input_tag 2
+#define SignTransactionStreaming_transaction_data_tag 3
 #define SignatureCompleteData_signature_data_complete_tag 1
 #define SignatureMessage_signature_data_complete_message_tag 1
+#define SignatureStreamData_input_index_tag      1
+#define SignatureStreamData_signature_data_complete_tag 2
 #define WalletInfo_wallet_number_tag             1
 #define WalletInfo_wallet_name_tag               2
 #define WalletInfo_wallet_uuid_tag               3
@@ -492,8 +525,8 @@ extern const uint32_t BackupWallet_device_default;
 #define SignMessage_message_data_tag             2
 
 /* Struct field encoding specification for nanopb */
-extern const pb_field_t Initialize_fields[2];
-extern const pb_field_t Features_fields[13];
+extern const pb_field_t Initialize_fields[4];
+extern const pb_field_t Features_fields[15];
 extern const pb_field_t Ping_fields[2];
 extern const pb_field_t PingResponse_fields[3];
 extern const pb_field_t Success_fields[1];
@@ -516,6 +549,8 @@ extern const pb_field_t AddressHandleExtended_fields[4];
 extern const pb_field_t SignTransactionExtended_fields[3];
 extern const pb_field_t SignatureCompleteData_fields[2];
 extern const pb_field_t SignatureComplete_fields[2];
+extern const pb_field_t SignTransactionStreaming_fields[4];
+extern const pb_field_t SignatureStreamData_fields[3];
 extern const pb_field_t LoadWallet_fields[2];
 extern const pb_field_t FormatWalletArea_fields[2];
 extern const pb_field_t ChangeEncryptionKey_fields[2];
@@ -545,7 +580,7 @@ extern const pb_field_t DisplayAddressAsQR_fields[2];
 extern const pb_field_t SetChangeAddressIndex_fields[2];
 
 /* Maximum encoded size of messages (where known) */
-#define Initialize_size                          66
+#define Initialize_size                          74
 #define Ping_size                                515
 #define PingResponse_size                        581
 #define Success_size                             0
@@ -563,6 +598,7 @@ extern const pb_field_t SetChangeAddressIndex_fields[2];
 #define GetAddressAndPublicKey_size              6
 #define AddressHandleExtended_size               18
 #define SignatureCompleteData_size               111
+#define SignatureStreamData_size                 117
 #define LoadWallet_size                          6
 #define FormatWalletArea_size                    34
 #define ChangeWalletName_size                    42
@@ -574,7 +610,6 @@ extern const pb_field_t SetChangeAddressIndex_fields[2];
 #define DeviceUUID_size                          18
 #define GetEntropy_size                          6
 #define GetBulk_size                             0
-#define SetBulk_size                             21236
 #define GetMasterPublicKey_size                  0
 #define MasterPublicKey_size                     101
 #define ResetLang_size                           0
@@ -99,6 +99,7 @@ static P2SHGeneratorErrors generateMultiSigAddressInternal(uint8_t num_sigs, uin
 	unsigned int j;
 	unsigned int pubkey_length;
 	uint8_t buffer[32];
+	uint8_t uncompressed_public_key[66];
 	uint8_t one_byte;
 	HashState hs;
 	char address[TEXT_ADDRESS_LENGTH];
@@ -124,19 +125,17 @@ static P2SHGeneratorErrors generateMultiSigAddressInternal(uint8_t num_sigs, uin
 	{
 		if (i == supplied_pubkey_num)
 		{
-			sha256WriteByte(&hs, 0x41); // 41 bytes of data follows
-			sha256WriteByte(&hs, 0x04);
+			uncompressed_public_key[0] = 0x41; // 41 bytes of data follows
+			uncompressed_public_key[1] = 0x04;
 			// The counters run backwards because Bitcoin expects public
 			// keys to be in big-endian format, but they're in little-endian
 			// format here.
 			for (j = 32; j--; )
 			{
-				sha256WriteByte(&hs, public_key->x[j]);
-			}
-			for (j = 32; j--; )
-			{
-				sha256WriteByte(&hs, public_key->y[j]);
+				uncompressed_public_key[33 - j] = public_key->x[j];
+				uncompressed_public_key[65 - j] = public_key->y[j];
 			}
+			sha256WriteBytes(&hs, uncompressed_public_key, sizeof(uncompressed_public_key));
 		}
 		else
 		{
@@ -186,10 +185,7 @@ static P2SHGeneratorErrors generateMultiSigAddressInternal(uint8_t num_sigs, uin
 	sha256Finish(&hs);
 	writeHashToByteArray(buffer, &hs, true);
 	ripemd160Begin(&hs);
-	for (i = 0; i < 32; i++)
-	{
-		ripemd160WriteByte(&hs, buffer[i]);
-	}
+	ripemd160WriteBytes(&hs, buffer, 32);
 	ripemd160Finish(&hs);
 	writeHashToByteArray(buffer, &hs, true);
 	hashToAddr(address, buffer, ADDRESS_VERSION_P2SH);
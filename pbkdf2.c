@@ -49,8 +49,8 @@
 void pbkdf2(uint8_t *out, const uint8_t *password, const unsigned int password_length, const uint8_t *salt, const unsigned int salt_length)
 {
 	uint8_t u[SHA512_HASH_LENGTH];
-	uint8_t hmac_result[SHA512_HASH_LENGTH];
 	unsigned int u_length;
+	HmacSha512Context ctx;
 	uint32_t num_iterations;
 	uint32_t i;
 	unsigned int j;
@@ -71,17 +71,21 @@ void pbkdf2(uint8_t *out, const uint8_t *password, const unsigned int password_l
 	writeU32BigEndian(&(u[u_length]), 1);
 	u_length += 4;
 
+	// The password is the HMAC key for every iteration, so the key pads
+	// only need to be hashed once.
+	hmacSha512Init(&ctx, password, password_length);
 	num_iterations = getPBKDF2Iterations();
 	for (i = 0; i < num_iterations; i++)
 	{
-		hmacSha512(hmac_result, password, password_length, u, u_length);
-		memcpy(u, hmac_result, sizeof(u));
+		hmacSha512WithContext(u, &ctx, u, u_length);
 		u_length = SHA512_HASH_LENGTH;
 		for (j = 0; j < SHA512_HASH_LENGTH; j++)
 		{
 			out[j] ^= u[j];
 		}
 	}
+	hmacSha512ClearContext(&ctx);
+	memset(u, 0, sizeof(u));
 }
 
 #ifdef TEST
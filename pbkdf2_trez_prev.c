@@ -25,7 +25,6 @@
 #include "hmac_trez.h"
 #include "pbkdf2_trez_prev.h"
 
-#define HMACFUNC hmac_sha512
 #define HMACLEN  (512/8)
 
 //void pbkdf2(const uint8_t *pass, int passlen, uint8_t *salt, int saltlen, uint32_t iterations, uint8_t *key, int keylen, void (*progress_callback)(uint32_t current, uint32_t total))
@@ -34,18 +33,21 @@ void pbkdf2_trez(const uint8_t *pass, int passlen, uint8_t *salt, int saltlen, u
 	uint32_t i, j, k;
 	uint8_t f[HMACLEN], g[HMACLEN];
 	uint32_t blocks = keylen / HMACLEN;
+	HMAC_SHA512_CTX hctx;
 	if (keylen & (HMACLEN - 1)) {
 		blocks++;
 	}
+	// The password is the HMAC key throughout, so hash its pads only once.
+	hmac_sha512_prepare(pass, passlen, &hctx);
 	for (i = 1; i <= blocks; i++) {
 		salt[saltlen    ] = (i >> 24) & 0xFF;
 		salt[saltlen + 1] = (i >> 16) & 0xFF;
 		salt[saltlen + 2] = (i >> 8) & 0xFF;
 		salt[saltlen + 3] = i & 0xFF;
-		HMACFUNC(pass, passlen, salt, saltlen + 4, g);
+		hmac_sha512_prepared(&hctx, salt, saltlen + 4, g);
 		memcpy(f, g, HMACLEN);
 		for (j = 1; j < iterations; j++) {
-			HMACFUNC(pass, passlen, g, HMACLEN, g);
+			hmac_sha512_prepared(&hctx, g, HMACLEN, g);
 			for (k = 0; k < HMACLEN; k++) {
 				f[k] ^= g[k];
 			}
@@ -59,4 +61,7 @@ void pbkdf2_trez(const uint8_t *pass, int passlen, uint8_t *salt, int saltlen, u
 			memcpy(key + HMACLEN * (i - 1), f, HMACLEN);
 		}
 	}
+	memset(&hctx, 0, sizeof(hctx));
+	memset(f, 0, sizeof(f));
+	memset(g, 0, sizeof(g));
 }
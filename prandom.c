@@ -18,9 +18,13 @@
 
 #ifdef TEST_PRANDOM
 #include <stdio.h>
+#include <time.h>
 #include "test_helpers.h"
 #include "wallet.h"
 
+/** Chain code generated by the most recent call to
+  * generateDeterministic256_original(). */
+static uint8_t test_chain_code[32];
 #endif // #ifdef TEST_PRANDOM
 
 #include "common.h"
@@ -32,6 +36,7 @@
 #include "ecdsa.h"
 #include "bignum256.h"
 #include "transaction.h" // for swapEndian256()
+#include "hmac_drbg.h"
 #include "prandom.h"
 #include "hwinterface.h"
 #include "storage_common.h"
@@ -41,9 +46,7 @@
 #include <string.h>
 
 #include "base58_trez.h"
-#include "bignum_trez.h"
 #include "bip32_trez.h"
-#include "ecdsa_trez.h"
 #include "hmac_trez.h"
 #include "ripemd160_trez.h"
 #include "sha2_trez.h"
@@ -71,6 +74,44 @@ static PointAffine cached_parent_public_key;
 /** Specifies whether the contents of #parent_public_key are valid. */
 static bool cached_parent_public_key_valid;
 
+/** Number of entries in #derived_node_cache. A transaction typically spends
+  * from the external chain and sends change to the internal chain of the same
+  * account, so this allows for a couple of accounts to be in use at once. */
+#define DERIVED_NODE_CACHE_SIZE		4
+
+/** One entry of #derived_node_cache. */
+typedef struct DerivedNodeCacheEntryStruct
+{
+	/** Whether this entry contains a valid node. */
+	bool valid;
+	/** The (hardened) account index the node was derived with. */
+	uint32_t chain_lvl_1;
+	/** The chain index the node was derived with. */
+	uint32_t chain_lvl_2;
+	/** The BIP 0032 node m/chain_lvl_1'/chain_lvl_2, including its private
+	  * key. */
+	HDNode node;
+} DerivedNodeCacheEntry;
+
+/** Cache of BIP 0032 account/chain nodes for generateDeterministic256().
+  *
+  * Deriving m/chain_lvl_1'/chain_lvl_2 from the seed requires an HMAC-SHA512
+  * for the master node, plus an HMAC-SHA512 and a point multiply for each
+  * level. Without this cache, that work would be repeated for every input
+  * of a transaction, even though all the inputs usually share the same
+  * account and chain. The contents of this cache are only valid while a
+  * wallet is loaded; see clearParentPublicKeyCache().
+  * \warning This contains private keys. It must be cleared whenever a wallet
+  *          is unloaded.
+  */
+static DerivedNodeCacheEntry derived_node_cache[DERIVED_NODE_CACHE_SIZE];
+/** SHA-256 hash of the seed which the entries of #derived_node_cache were
+  * derived from. */
+static uint8_t derived_node_cache_seed_hash[32];
+/** Index into #derived_node_cache of the entry which will be replaced on the
+  * next cache miss. */
+static uint8_t derived_node_cache_next;
+
 
 
 //For outputting the xpubs. We need to collect all the utilities in one file.
@@ -131,8 +172,7 @@ static void setParentPublicKeyFromPrivateKey(BigNum256 parent_private_key)
 	HashState hs;
 
 
-	setToG(&cached_parent_public_key);
-	pointMultiply(&cached_parent_public_key, parent_private_key);
+	pointMultiplyG(&cached_parent_public_key, parent_private_key);
 	cached_parent_public_key_valid = true;
 
 
@@ -179,7 +219,17 @@ static void setParentPublicKeyFromPrivateKey(BigNum256 parent_private_key)
 ///////////////////////
 }
 
-/** Clear the parent public key cache (see #parent_private_key). This should
+/** Clear the derived node cache (see #derived_node_cache). */
+static void clearDerivedNodeCache(void)
+{
+	memset(derived_node_cache, 0xff, sizeof(derived_node_cache)); // just to be sure
+	memset(derived_node_cache, 0, sizeof(derived_node_cache));
+	memset(derived_node_cache_seed_hash, 0, sizeof(derived_node_cache_seed_hash));
+	derived_node_cache_next = 0;
+}
+
+/** Clear the parent public key cache (see #parent_private_key) and the
+  * derived node cache (see #derived_node_cache). This should
   * be called whenever a wallet is unloaded, so that subsequent calls to
   * generateDeterministic256() don't result in addresses from the old wallet.
   */
@@ -188,6 +238,7 @@ void clearParentPublicKeyCache(void)
 	memset(&cached_parent_public_key, 0xff, sizeof(cached_parent_public_key)); // just to be sure
 	memset(&cached_parent_public_key, 0, sizeof(cached_parent_public_key));
 	cached_parent_public_key_valid = false;
+	clearDerivedNodeCache();
 }
 
 /** Calculate the entropy pool checksum of an entropy pool state.
@@ -502,6 +553,85 @@ bool getRandom256TemporaryPool(BigNum256 n, uint8_t *pool_state)
 	return getRandom256Internal(n, pool_state, true);
 }
 
+/** Begin a random number generation session. This calls
+  * getRandom256Internal() once to obtain a seed, then uses the seed to
+  * instantiate a HMAC_DRBG (see hmac_drbg.c). randomSessionGetBytes() can
+  * then generate any number of random bytes without accessing the HWRNG or
+  * the persistent entropy pool again.
+  *
+  * This means that a request which needs lots of random bytes (eg. GetEntropy,
+  * or wallet creation) only does one HWRNG collection and one persistent
+  * entropy pool read/verify/write, instead of one for every 32 bytes. The
+  * persistent entropy pool is updated here, before any output is generated,
+  * for the same reason that getRandom256Internal() updates it immediately: so
+  * that a reset part-way through a session can't cause a pool state to be
+  * reused.
+  * \param session The session to begin.
+  * \param pool_state See getRandom256Internal().
+  * \param use_pool_state See getRandom256Internal().
+  * \return false on success, true if an error (couldn't access
+  *         non-volatile memory, invalid entropy pool checksum or HWRNG
+  *         failure) occurred. On error, the session must not be used.
+  */
+static bool randomSessionBeginInternal(RandomSession *session, uint8_t *pool_state, bool use_pool_state)
+{
+	uint8_t seed[32];
+
+	memset(session, 0, sizeof(*session));
+	if (getRandom256Internal(seed, pool_state, use_pool_state))
+	{
+		return true;
+	}
+	hmacDrbgInstantiate(&(session->drbg), seed, sizeof(seed));
+	memset(seed, 0, sizeof(seed));
+	return false; // success
+}
+
+/** Version of randomSessionBeginInternal() which uses non-volatile memory to
+  * store the persistent entropy pool. See randomSessionBeginInternal() for
+  * more details.
+  * \param session See randomSessionBeginInternal().
+  * \return See randomSessionBeginInternal().
+  */
+bool randomSessionBegin(RandomSession *session)
+{
+	return randomSessionBeginInternal(session, NULL, false);
+}
+
+/** Version of randomSessionBeginInternal() which uses RAM to store the
+  * persistent entropy pool. See randomSessionBeginInternal() for more
+  * details.
+  * \param session See randomSessionBeginInternal().
+  * \param pool_state A byte array of length #ENTROPY_POOL_LENGTH which
+  *                   contains the persistent entropy pool state. This will
+  *                   be both read from and written to.
+  * \return See randomSessionBeginInternal().
+  */
+bool randomSessionBeginTemporaryPool(RandomSession *session, uint8_t *pool_state)
+{
+	return randomSessionBeginInternal(session, pool_state, true);
+}
+
+/** Obtain random bytes from a random number generation session. This never
+  * fails, since all possible failures happen in randomSessionBegin().
+  * \param session A session which was successfully begun using
+  *                randomSessionBegin() or randomSessionBeginTemporaryPool().
+  * \param out The random bytes will be written here.
+  * \param length The number of random bytes to write.
+  */
+void randomSessionGetBytes(RandomSession *session, uint8_t *out, uint32_t length)
+{
+	hmacDrbgGenerate(&(session->drbg), out, length);
+}
+
+/** End a random number generation session, clearing its state from RAM.
+  * \param session The session to end.
+  */
+void randomSessionEnd(RandomSession *session)
+{
+	hmacDrbgClear(&(session->drbg));
+}
+
 /** Generate an insecure one-time password.
   * \param otp The generated one-time password will be written here. This must
   *            be a character array with enough space to store #OTP_LENGTH
@@ -616,370 +746,202 @@ void generateInsecurePIN(char *otp, int length)
 //*****************************************************************
 //*****************************************************************
 
+/** Maximum depth of a path passed to deriveNodePath(). */
+#define MAX_DERIVATION_DEPTH	5
+
+/** Derive a BIP 0032 node from scratch, starting at the master node
+  * generated from the seed and walking down the specified path. Everything
+  * is done directly on #HDNode structures; nothing is serialised.
+  * \param out The derived node will be written here.
+  * \param seed See generateDeterministic256().
+  * \param path The child indices to derive, from the master node downwards.
+  *             Set the most significant bit of an index for hardened
+  *             derivation.
+  * \param depth The number of entries in path. This must not be more
+  *              than #MAX_DERIVATION_DEPTH.
+  */
+static void deriveNodePath(HDNode *out, const uint8_t *seed, const uint32_t *path, const uint8_t depth)
+{
+	uint8_t i;
+
+	// hdnode_from_seed() only reads from seed.
+	hdnode_from_seed((uint8_t *)seed, SEED_LENGTH, out);
+	for (i = 0; i < depth; i++)
+	{
+		hdnode_private_ckd(out, path[i]);
+	}
+}
+
+/** Derive the BIP 0032 node m/chain_lvl_1'/chain_lvl_2 from scratch, starting
+  * at the master node generated from the seed. This is the slow path which
+  * getChainNode() avoids whenever it can.
+  * \param out The derived node will be written here.
+  * \param seed See generateDeterministic256().
+  * \param chain_lvl_1 The (hardened) account index.
+  * \param chain_lvl_2 The chain index (0 external, 1 internal).
+  */
+static void deriveChainNode(HDNode *out, const uint8_t *seed, const uint32_t chain_lvl_1, const uint32_t chain_lvl_2)
+{
+	uint32_t path[2];
+
+	path[0] = chain_lvl_1 | 0x80000000;
+	path[1] = chain_lvl_2; // 0 external, 1 internal
+	deriveNodePath(out, seed, path, 2);
+}
+
+/** Obtain the BIP 0032 node m/chain_lvl_1'/chain_lvl_2, using
+  * #derived_node_cache if possible. On a cache miss, the node is derived
+  * using deriveChainNode() and placed in the cache, replacing the oldest
+  * entry.
+  * \param out The node will be written here.
+  * \param seed See generateDeterministic256().
+  * \param chain_lvl_1 The (hardened) account index.
+  * \param chain_lvl_2 The chain index (0 external, 1 internal).
+  */
+static void getChainNode(HDNode *out, const uint8_t *seed, const uint32_t chain_lvl_1, const uint32_t chain_lvl_2)
+{
+	uint8_t seed_hash[32];
+	uint8_t i;
+	HashState hs;
+	DerivedNodeCacheEntry *entry;
+
+	// The cache is keyed by the seed as well, so that a caller which
+	// switches seeds without unloading the wallet can never be handed a
+	// node from the old seed.
+	sha256Begin(&hs);
+	for (i = 0; i < SEED_LENGTH; i++)
+	{
+		sha256WriteByte(&hs, seed[i]);
+	}
+	sha256Finish(&hs);
+	writeHashToByteArray(seed_hash, &hs, true);
+	if (memcmp(seed_hash, derived_node_cache_seed_hash, sizeof(seed_hash)))
+	{
+		clearDerivedNodeCache();
+		memcpy(derived_node_cache_seed_hash, seed_hash, sizeof(seed_hash));
+	}
+
+	for (i = 0; i < DERIVED_NODE_CACHE_SIZE; i++)
+	{
+		entry = &(derived_node_cache[i]);
+		if (entry->valid && (entry->chain_lvl_1 == chain_lvl_1) && (entry->chain_lvl_2 == chain_lvl_2))
+		{
+			memcpy(out, &(entry->node), sizeof(HDNode));
+			return;
+		}
+	}
+
+	deriveChainNode(out, seed, chain_lvl_1, chain_lvl_2);
+	entry = &(derived_node_cache[derived_node_cache_next]);
+	entry->valid = true;
+	entry->chain_lvl_1 = chain_lvl_1;
+	entry->chain_lvl_2 = chain_lvl_2;
+	memcpy(&(entry->node), out, sizeof(HDNode));
+	derived_node_cache_next = (uint8_t)((derived_node_cache_next + 1) % DERIVED_NODE_CACHE_SIZE);
+}
+
 /** Use a combination of cryptographic primitives to deterministically
   * generate a new 256 bit number.
   *
   * The generator uses the algorithm described in
   * https://en.bitcoin.it/wiki/BIP_0032, accessed 12-November-2012 under the
-  * "Specification" header. The generator generates uncompressed keys.
+  * "Specification" header. The private key returned is the one at
+  * m/chain_lvl_1'/chain_lvl_2/chain_lvl_3.
+  *
+  * The node m/chain_lvl_1'/chain_lvl_2 is cached (see getChainNode()), so
+  * repeated calls for the same account and chain, such as one call per input
+  * when signing a transaction, only pay for the final child derivation.
   *
   * \param out The generated 256 bit number will be written here.
   * \param seed Should point to a byte array of length #SEED_LENGTH containing
-  *             the seed for the pseudo-random number generator. While the
-  *             seed can be considered as an arbitrary array of bytes, the
-  *             bytes of the array also admit the following interpretation:
-  *             the first 32 bytes are the parent private key in big-endian
-  *             format, and the next 32 bytes are the chain code (endian
-  *             independent).
-  * \param num A counter which determines which number the pseudo-random
-  *            number generator will output.
+  *             the BIP 0032 seed of the wallet.
+  * \param chain_lvl_1 The (hardened) account index.
+  * \param chain_lvl_2 The chain index (0 external, 1 internal).
+  * \param chain_lvl_3 The address index within the chain.
   * \return false upon success, true if the specified seed is not valid (will
   *         produce degenerate private keys).
-  *
-  * INSERT BIP32 ROUTINES FROM BIP39_arduinoDUE HERE - pass parameters for seed depth etc. such as m/0'/0/0
-  * do we need to alter the signing routines to take compressed ECDSA keys?
-  *
-  * OK, according to https://github.com/bitcoin/bips/commit/6a418689f3ff25730c39c19655b922ea4b7bd64d
-  * this routine is completely outmoded. Will have to gut it.
-  *
   */
 bool generateDeterministic256(BigNum256 out, const uint8_t *seed, const uint32_t chain_lvl_1, const uint32_t chain_lvl_2, const uint32_t chain_lvl_3)
 {
-	uint8_t i;
-	uint8_t one_byte; // current byte of seed
-
-	uint8_t buffer[32];
-	PointAffine *out_public_key;
-	HashState hs;
-
-
-
-	char strBits[3];
-	char hexSeed[64] = { };
-
-	strcpy(hexSeed, "");
-	for (i = 0; i < 64; i++) {
-		one_byte = seed[i];
-		strBits[0] = nibbleToHex((uint8_t) (one_byte >> 4));
-		strBits[1] = nibbleToHex(one_byte);
-		strBits[2] = '\0';
-		strcat(hexSeed, strBits);
-	}
-
-	HDNode node, node2, node3;
-	char str[112];
-	int r;
-
-
-	// [seed]
-	hdnode_from_seed(fromhex(hexSeed), 64, &node);
-
-
-	// [Chain m]
-	hdnode_serialize_private(&node, str);
-	r = hdnode_deserialize(str, &node2);
-
-	hdnode_serialize_public(&node, str);
-	r = hdnode_deserialize(str, &node2);
-
-	memcpy(&node3, &node, sizeof(HDNode));
-	memset(&node3.private_key, 0, 32);
-
-
-	// [Chain m/0']
-	r = hdnode_private_ckd_prime(&node, chain_lvl_1);
-
-	hdnode_serialize_private(&node, str);
-	r = hdnode_deserialize(str, &node2);
-
-	hdnode_serialize_public(&node, str);	// THIS is the xpub that we have to output for the new schema
-	r = hdnode_deserialize(str, &node2);
-
-	memcpy(&node3, &node, sizeof(HDNode));
-	memset(&node3.private_key, 0, 32);
-
-
-
-	// [Chain m/0'/0]
-	r = hdnode_private_ckd(&node, chain_lvl_2); // 0 external, 1 internal
-
-	hdnode_serialize_private(&node, str);
-	r = hdnode_deserialize(str, &node2);
-
-	hdnode_serialize_public(&node, str);
-	r = hdnode_deserialize(str, &node2);
-
-	memcpy(&node3, &node, sizeof(HDNode));
-	memset(&node3.private_key, 0, 32);
+	HDNode node;
 
+	getChainNode(&node, seed, chain_lvl_1, chain_lvl_2);
 
 	// [Chain m/0'/0/num]
-	r = hdnode_private_ckd(&node, chain_lvl_3);
-
-	uint8_t staticPrivate[32] = {};
-	memcpy(staticPrivate, &node.private_key, 32);
-	swapEndian256(staticPrivate);
-	memcpy(out, staticPrivate, 32);
+	hdnode_private_ckd(&node, chain_lvl_3);
 
-//	setParentPublicKeyFromPrivateKey(out);
+	memcpy(out, node.private_key, 32);
+	swapEndian256(out);
+	memset(&node, 0, sizeof(node));
 
 	return false; // success
 }
 
 
 
+/** Like generateDeterministic256(), except the private key returned is the
+  * one at the BIP 0044 path m/44'/0'/0'/chain_lvl_2/chain_lvl_3.
+  * chain_lvl_1 is ignored.
+  */
 bool generateDeterministic256Trezor(BigNum256 out, const uint8_t *seed, const uint32_t chain_lvl_1, const uint32_t chain_lvl_2, const uint32_t chain_lvl_3)
 {
-	uint8_t i;
-	uint8_t one_byte; // current byte of seed
-
-	uint8_t buffer[32];
-	PointAffine *out_public_key;
-	HashState hs;
-
-	char derivationPath[] = {'0p','0','0'};
-
-	char strBits[3];
-	char hexSeed[64] = { };
-
-	strcpy(hexSeed, "");
-	for (i = 0; i < 64; i++) {
-		one_byte = seed[i];
-		strBits[0] = nibbleToHex((uint8_t) (one_byte >> 4));
-		strBits[1] = nibbleToHex(one_byte);
-		strBits[2] = '\0';
-		strcat(hexSeed, strBits);
-	}
-
-	HDNode node, node2, node3;
-	char str[112];
-	int r;
-
-
-	// [seed]
-	hdnode_from_seed(fromhex(hexSeed), 64, &node);
-
-
-	// [Chain m]
-	hdnode_serialize_private(&node, str);
-	r = hdnode_deserialize(str, &node2);
-
-	hdnode_serialize_public(&node, str);
-	r = hdnode_deserialize(str, &node2);
-
-	memcpy(&node3, &node, sizeof(HDNode));
-	memset(&node3.private_key, 0, 32);
-
-
-	// [Chain m/44']
-	r = hdnode_private_ckd_prime(&node, 44);
-
-	hdnode_serialize_private(&node, str);
-	r = hdnode_deserialize(str, &node2);
-
-	hdnode_serialize_public(&node, str);
-	r = hdnode_deserialize(str, &node2);
-
-	memcpy(&node3, &node, sizeof(HDNode));
-	memset(&node3.private_key, 0, 32);
+	HDNode node;
+	uint32_t path[5];
 
-	// [Chain m/44'/0']
-	r = hdnode_private_ckd_prime(&node, 0);
+	path[0] = 44 | 0x80000000;
+	path[1] = 0 | 0x80000000;
+	path[2] = 0 | 0x80000000;
+	path[3] = chain_lvl_2; // 0 external, 1 internal
+	path[4] = chain_lvl_3;
+	deriveNodePath(&node, seed, path, 5);
 
-	hdnode_serialize_private(&node, str);
-	r = hdnode_deserialize(str, &node2);
-
-	hdnode_serialize_public(&node, str);
-	r = hdnode_deserialize(str, &node2);
-
-	memcpy(&node3, &node, sizeof(HDNode));
-	memset(&node3.private_key, 0, 32);
-
-	// [Chain m/44'/0'/0']
-	r = hdnode_private_ckd_prime(&node, 0);
-
-	hdnode_serialize_private(&node, str);
-	r = hdnode_deserialize(str, &node2);
-
-	hdnode_serialize_public(&node, str);	// THIS is the xpub that we have to output for the new schema
-	r = hdnode_deserialize(str, &node2);
-
-	memcpy(&node3, &node, sizeof(HDNode));
-	memset(&node3.private_key, 0, 32);
-
-
-
-	// [Chain m/44'/0'/0'/0]
-	r = hdnode_private_ckd(&node, chain_lvl_2); // 0 external, 1 internal
-
-	hdnode_serialize_private(&node, str);
-	r = hdnode_deserialize(str, &node2);
-
-	hdnode_serialize_public(&node, str);
-	r = hdnode_deserialize(str, &node2);
-
-	memcpy(&node3, &node, sizeof(HDNode));
-	memset(&node3.private_key, 0, 32);
-
-
-	// [Chain m/44'/0'/0'/0/num]
-	r = hdnode_private_ckd(&node, chain_lvl_3);
-
-	uint8_t staticPrivate[32] = {};
-	memcpy(staticPrivate, &node.private_key, 32);
-	swapEndian256(staticPrivate);
-	memcpy(out, staticPrivate, 32);
-
-//	setParentPublicKeyFromPrivateKey(out);
+	memcpy(out, node.private_key, 32);
+	swapEndian256(out);
+	memset(&node, 0, sizeof(node));
 
 	return false; // success
 }
 
-
+/** Get the serialised extended public key (xpub) of the account node m/0'.
+  * \param out The null-terminated, base58-encoded xpub will be written here.
+  *            This must have space for 112 bytes.
+  * \param seed See generateDeterministic256().
+  * \param num Currently unused.
+  * \return false on success.
+  */
 bool getXPUBfromNode(BigNum256 out, const uint8_t *seed, const uint32_t num)
 {
-	uint8_t i;
-	uint8_t one_byte; // current byte of seed
-
-	char strBits[3];
-	char hexSeed[64] = { };
-
-	strcpy(hexSeed, "");
-	for (i = 0; i < 64; i++) {
-		one_byte = seed[i];
-		strBits[0] = nibbleToHex((uint8_t) (one_byte >> 4));
-		strBits[1] = nibbleToHex(one_byte);
-		strBits[2] = '\0';
-		strcat(hexSeed, strBits);
-	}
-
-	HDNode node, node2, node3;
+	HDNode node;
 	char str[112];
-	int r;
-
-
-	// [seed]
-	hdnode_from_seed(fromhex(hexSeed), 64, &node);
-
-
-	// [Chain m]
-	hdnode_serialize_private(&node, str);
-	r = hdnode_deserialize(str, &node2);
-
-	hdnode_serialize_public(&node, str);
-	r = hdnode_deserialize(str, &node2);
-
-	memcpy(&node3, &node, sizeof(HDNode));
-	memset(&node3.private_key, 0, 32);
+	uint32_t path[1];
 
-
-	// [Chain m/0']
-	r = hdnode_private_ckd_prime(&node, 0);
-
-	hdnode_serialize_private(&node, str);
-	r = hdnode_deserialize(str, &node2);
+	path[0] = 0 | 0x80000000;
+	deriveNodePath(&node, seed, path, 1);
 
 	hdnode_serialize_public(&node, str);	// THIS is the xpub that we have to output for the new schema
 	memcpy(out, str, 112);
-
-//
-//
-//	r = hdnode_deserialize(str, &node2);
-//
-//	memcpy(&node3, &node, sizeof(HDNode));
-//	memset(&node3.private_key, 0, 32);
-//
-//
-//
-//	// [Chain m/0'/0]
-//	r = hdnode_private_ckd(&node, 0);
-//
-//	hdnode_serialize_private(&node, str);
-//	r = hdnode_deserialize(str, &node2);
-//
-//	hdnode_serialize_public(&node, str);
-//
-//	r = hdnode_deserialize(str, &node2);
-//
-//	memcpy(&node3, &node, sizeof(HDNode));
-//	memset(&node3.private_key, 0, 32);
-//
-//
-//	// [Chain m/0'/1/1]
-//	r = hdnode_private_ckd(&node, 1);
-//
-//	uint8_t staticPrivate[32] = {};
-//	memcpy(staticPrivate, &node.private_key, 32);
-//	swapEndian256(staticPrivate);
-//	memcpy(out, staticPrivate, 32);
-
+	memset(&node, 0, sizeof(node));
 
 	return false; // success
 }
 
-
+/** Like getXPUBfromNode(), except the xpub is that of the BIP 0044 account
+  * node m/44'/0'/0'.
+  */
 bool getXPUBfromNodeTrezor(BigNum256 out, const uint8_t *seed, const uint32_t num)
 {
-	uint8_t i;
-	uint8_t one_byte; // current byte of seed
-
-	char strBits[3];
-	char hexSeed[64] = { };
-
-	strcpy(hexSeed, "");
-	for (i = 0; i < 64; i++) {
-		one_byte = seed[i];
-		strBits[0] = nibbleToHex((uint8_t) (one_byte >> 4));
-		strBits[1] = nibbleToHex(one_byte);
-		strBits[2] = '\0';
-		strcat(hexSeed, strBits);
-	}
-
-	HDNode node, node2, node3;
+	HDNode node;
 	char str[112];
-	int r;
-
+	uint32_t path[3];
 
+	path[0] = 44 | 0x80000000;
+	path[1] = 0 | 0x80000000;
+	path[2] = 0 | 0x80000000;
+	deriveNodePath(&node, seed, path, 3);
 
-	hdnode_from_seed(fromhex(hexSeed), 64, &node);
-
-	// [Chain m]
-	hdnode_serialize_private(&node, str);
-	r = hdnode_deserialize(str, &node2);
 	hdnode_serialize_public(&node, str);
-	r = hdnode_deserialize(str, &node2);
-
-	memcpy(&node3, &node, sizeof(HDNode));
-	memset(&node3.private_key, 0, 32);
-
-//	Serial.println("m/44'");
-	r = hdnode_private_ckd_prime(&node, 44);
-	hdnode_serialize_private(&node, str);
-	r = hdnode_deserialize(str, &node2);
-	hdnode_serialize_public(&node, str);
-	r = hdnode_deserialize(str, &node2);
-	memcpy(&node3, &node, sizeof(HDNode));
-	memset(&node3.private_key, 0, 32);
-
-//	Serial.println("m/44'/0'");
-	r = hdnode_private_ckd_prime(&node, 0);
-	hdnode_serialize_private(&node, str);
-	r = hdnode_deserialize(str, &node2);
-	hdnode_serialize_public(&node, str);
-	r = hdnode_deserialize(str, &node2);
-	memcpy(&node3, &node, sizeof(HDNode));
-	memset(&node3.private_key, 0, 32);
-
-//	Serial.println("m/44'/0'/0'");
-	r = hdnode_private_ckd_prime(&node, 0);
-	hdnode_serialize_private(&node, str);
-	r = hdnode_deserialize(str, &node2);
-	hdnode_serialize_public(&node, str);
-	r = hdnode_deserialize(str, &node2);
-	memcpy(&node3, &node, sizeof(HDNode));
-	memset(&node3.private_key, 0, 32);
-
 	memcpy(out, str, 112);
+	memset(&node, 0, sizeof(node));
 
 	return false; // success
 }
@@ -1035,4 +997,411 @@ bool generateDeterministic256_original(BigNum256 out, const uint8_t *seed, const
 	return false; // success
 }
 
+#ifdef TEST_PRANDOM
+
+/** Number of (account, chain, index) paths to check per seed in the derived
+  * node cache tests. */
+#define NUM_CACHE_TEST_PATHS	200
+/** Number of different seeds to run the derived node cache tests with. */
+#define NUM_CACHE_TEST_SEEDS	4
+
+/** Calculate the private key at m/chain_lvl_1'/chain_lvl_2/chain_lvl_3
+  * without going through #derived_node_cache. The result is in the same
+  * format as the output of generateDeterministic256().
+  */
+static void uncachedDeterministic256(BigNum256 out, const uint8_t *seed, const uint32_t chain_lvl_1, const uint32_t chain_lvl_2, const uint32_t chain_lvl_3)
+{
+	HDNode node;
+
+	deriveChainNode(&node, seed, chain_lvl_1, chain_lvl_2);
+	hdnode_private_ckd(&node, chain_lvl_3);
+	memcpy(out, node.private_key, 32);
+	swapEndian256(out);
+}
+
+/** Check that generateDeterministic256() returns the same private keys as
+  * uncachedDeterministic256() for many paths, including when the cache is
+  * thrashed, cleared or when the seed changes underneath it.
+  */
+static void testDerivedNodeCache(void)
+{
+	uint8_t seed[NUM_CACHE_TEST_SEEDS][SEED_LENGTH];
+	uint8_t cached[32];
+	uint8_t uncached[32];
+	uint32_t chain_lvl_1;
+	uint32_t chain_lvl_2;
+	uint32_t chain_lvl_3;
+	unsigned int i;
+	unsigned int j;
+	unsigned int s;
+
+	for (s = 0; s < NUM_CACHE_TEST_SEEDS; s++)
+	{
+		for (j = 0; j < SEED_LENGTH; j++)
+		{
+			seed[s][j] = (uint8_t)rand();
+		}
+	}
+
+	clearParentPublicKeyCache();
+	for (i = 0; i < (NUM_CACHE_TEST_SEEDS * NUM_CACHE_TEST_PATHS); i++)
+	{
+		// Mostly stay on one seed, but sometimes switch to another one
+		// without clearing the cache, to check that stale nodes are never
+		// returned.
+		s = (i / 16) % NUM_CACHE_TEST_SEEDS;
+		if ((rand() & 7) == 0)
+		{
+			s = (unsigned int)rand() % NUM_CACHE_TEST_SEEDS;
+		}
+		// Use more (account, chain) pairs than there are cache entries, so
+		// that entries get evicted.
+		chain_lvl_1 = (uint32_t)(rand() % 4);
+		chain_lvl_2 = (uint32_t)(rand() % 2);
+		chain_lvl_3 = (uint32_t)rand();
+		if ((rand() & 3) == 0)
+		{
+			chain_lvl_3 |= 0x80000000; // hardened index
+		}
+		if ((rand() % 50) == 0)
+		{
+			clearParentPublicKeyCache();
+		}
+		generateDeterministic256(cached, seed[s], chain_lvl_1, chain_lvl_2, chain_lvl_3);
+		uncachedDeterministic256(uncached, seed[s], chain_lvl_1, chain_lvl_2, chain_lvl_3);
+		if (memcmp(cached, uncached, 32))
+		{
+			printf("Cached key mismatch, seed %u, path m/%u'/%u/%u\n", s, chain_lvl_1, chain_lvl_2, chain_lvl_3);
+			reportFailure();
+		}
+		else
+		{
+			reportSuccess();
+		}
+	}
+
+	// The cache must not hold on to private keys after being cleared.
+	clearParentPublicKeyCache();
+	for (i = 0; i < sizeof(derived_node_cache); i++)
+	{
+		if (((uint8_t *)derived_node_cache)[i] != 0)
+		{
+			break;
+		}
+	}
+	if (i != sizeof(derived_node_cache))
+	{
+		printf("Derived node cache not cleared by clearParentPublicKeyCache()\n");
+		reportFailure();
+	}
+	else
+	{
+		reportSuccess();
+	}
+}
+
+/** Number of random seeds/paths to compare deriveNodePath() against
+  * legacyDeriveNodePath() with. */
+#define NUM_LEAN_TEST_PATHS		50
+/** Number of derivations to time in benchmarkDerivation(). */
+#define NUM_BENCHMARK_DERIVATIONS	20
+
+/** The BIP 0032 derivation as it was done before deriveNodePath(): the seed
+  * goes through a hex string and every level of the path is serialised to
+  * base58 and deserialised again. This is kept as a reference, to check that
+  * deriveNodePath() produces identical nodes and to measure the speedup.
+  * Parameters are the same as deriveNodePath().
+  */
+static void legacyDeriveNodePath(HDNode *out, const uint8_t *seed, const uint32_t *path, const uint8_t depth)
+{
+	uint8_t i;
+	char hex_seed[SEED_LENGTH * 2 + 1];
+	char str[112];
+	HDNode node2;
 
+	for (i = 0; i < SEED_LENGTH; i++)
+	{
+		hex_seed[i * 2] = nibbleToHex((uint8_t)(seed[i] >> 4));
+		hex_seed[i * 2 + 1] = nibbleToHex(seed[i]);
+	}
+	hex_seed[SEED_LENGTH * 2] = '\0';
+	hdnode_from_seed(fromhex(hex_seed), SEED_LENGTH, out);
+	for (i = 0; i <= depth; i++)
+	{
+		if (i > 0)
+		{
+			hdnode_private_ckd(out, path[i - 1]);
+		}
+		hdnode_serialize_private(out, str);
+		hdnode_deserialize(str, &node2);
+		hdnode_serialize_public(out, str);
+		hdnode_deserialize(str, &node2);
+	}
+}
+
+/** Fill a byte array with (non-cryptographic) random bytes. */
+static void fillRandom(uint8_t *out, unsigned int length)
+{
+	unsigned int i;
+
+	for (i = 0; i < length; i++)
+	{
+		out[i] = (uint8_t)rand();
+	}
+}
+
+/** Check that deriveNodePath(), and the public functions built on it,
+  * produce the same keys and xpubs as legacyDeriveNodePath().
+  */
+static void testLeanDerivation(void)
+{
+	uint8_t seed[SEED_LENGTH];
+	uint8_t key[32];
+	char xpub[112];
+	char compare_xpub[112];
+	uint32_t path[MAX_DERIVATION_DEPTH];
+	HDNode node;
+	HDNode compare_node;
+	unsigned int i;
+	uint8_t depth;
+	uint8_t j;
+
+	for (i = 0; i < NUM_LEAN_TEST_PATHS; i++)
+	{
+		fillRandom(seed, SEED_LENGTH);
+		depth = (uint8_t)(rand() % (MAX_DERIVATION_DEPTH + 1));
+		for (j = 0; j < depth; j++)
+		{
+			path[j] = (uint32_t)rand();
+			if (rand() & 1)
+			{
+				path[j] |= 0x80000000;
+			}
+		}
+		deriveNodePath(&node, seed, path, depth);
+		legacyDeriveNodePath(&compare_node, seed, path, depth);
+		if (memcmp(&node, &compare_node, sizeof(HDNode)))
+		{
+			printf("deriveNodePath() mismatch, test %u, depth %u\n", i, depth);
+			reportFailure();
+		}
+		else
+		{
+			reportSuccess();
+		}
+
+		// Private keys, as returned by generateDeterministic256().
+		path[0] = (uint32_t)(rand() % 4) | 0x80000000;
+		path[1] = (uint32_t)(rand() % 2);
+		path[2] = (uint32_t)rand();
+		clearParentPublicKeyCache();
+		generateDeterministic256(key, seed, path[0] & 0x7fffffff, path[1], path[2]);
+		swapEndian256(key);
+		legacyDeriveNodePath(&compare_node, seed, path, 3);
+		if (memcmp(key, compare_node.private_key, 32))
+		{
+			printf("generateDeterministic256() mismatch, test %u\n", i);
+			reportFailure();
+		}
+		else
+		{
+			reportSuccess();
+		}
+
+		// xpub of m/0'.
+		path[0] = 0x80000000;
+		getXPUBfromNode((BigNum256)xpub, seed, 0);
+		legacyDeriveNodePath(&compare_node, seed, path, 1);
+		hdnode_serialize_public(&compare_node, compare_xpub);
+		if (strcmp(xpub, compare_xpub))
+		{
+			printf("getXPUBfromNode() mismatch, test %u\n", i);
+			reportFailure();
+		}
+		else
+		{
+			reportSuccess();
+		}
+	}
+}
+
+/** Measure how long one BIP 0032 derivation of m/0'/0/i takes, with
+  * legacyDeriveNodePath(), with deriveNodePath() and with a warm
+  * #derived_node_cache.
+  */
+static void benchmarkDerivation(void)
+{
+	uint8_t seed[SEED_LENGTH];
+	uint8_t key[32];
+	uint32_t path[3];
+	HDNode node;
+	clock_t start;
+	double legacy_time;
+	double lean_time;
+	double cached_time;
+	unsigned int i;
+
+	fillRandom(seed, SEED_LENGTH);
+	path[0] = 0x80000000;
+	path[1] = 0;
+
+	start = clock();
+	for (i = 0; i < NUM_BENCHMARK_DERIVATIONS; i++)
+	{
+		path[2] = i;
+		legacyDeriveNodePath(&node, seed, path, 3);
+	}
+	legacy_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	start = clock();
+	for (i = 0; i < NUM_BENCHMARK_DERIVATIONS; i++)
+	{
+		path[2] = i;
+		deriveNodePath(&node, seed, path, 3);
+	}
+	lean_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	clearParentPublicKeyCache();
+	start = clock();
+	for (i = 0; i < NUM_BENCHMARK_DERIVATIONS; i++)
+	{
+		generateDeterministic256(key, seed, 0, 0, i);
+	}
+	cached_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	printf("BIP 0032 derivation of m/0'/0/i, per derivation:\n");
+	printf("  with base58 round trips: %.3f ms\n", legacy_time * 1000.0 / NUM_BENCHMARK_DERIVATIONS);
+	printf("  direct on HDNode:        %.3f ms\n", lean_time * 1000.0 / NUM_BENCHMARK_DERIVATIONS);
+	printf("  with derived node cache: %.3f ms\n", cached_time * 1000.0 / NUM_BENCHMARK_DERIVATIONS);
+}
+
+/** Size, in bytes, of the request used to test random number generation
+  * sessions. This is the size of the largest GetEntropy request. */
+#define SESSION_TEST_BYTES		20480
+
+/** Test randomSessionBeginTemporaryPool() and randomSessionGetBytes(), and
+  * compare the speed of a session with calling getRandom256TemporaryPool()
+  * for every 32 bytes.
+  */
+static void testRandomSession(void)
+{
+	RandomSession session;
+	uint8_t pool_state[ENTROPY_POOL_LENGTH];
+	uint8_t pool_before[ENTROPY_POOL_LENGTH];
+	uint8_t *out1;
+	uint8_t *out2;
+	clock_t start;
+	double per_call_time;
+	double session_time;
+	unsigned int i;
+
+	out1 = malloc(SESSION_TEST_BYTES);
+	out2 = malloc(SESSION_TEST_BYTES);
+	fillRandom(pool_state, sizeof(pool_state));
+
+	// Beginning a session must update the pool state exactly once; getting
+	// bytes must not touch it.
+	memcpy(pool_before, pool_state, sizeof(pool_state));
+	if (randomSessionBeginTemporaryPool(&session, pool_state))
+	{
+		printf("randomSessionBeginTemporaryPool() failed\n");
+		reportFailure();
+	}
+	else
+	{
+		reportSuccess();
+	}
+	if (!memcmp(pool_before, pool_state, sizeof(pool_state)))
+	{
+		printf("Session didn't update pool state\n");
+		reportFailure();
+	}
+	else
+	{
+		reportSuccess();
+	}
+	memcpy(pool_before, pool_state, sizeof(pool_state));
+	randomSessionGetBytes(&session, out1, SESSION_TEST_BYTES);
+	if (memcmp(pool_before, pool_state, sizeof(pool_state)))
+	{
+		printf("Getting bytes from session updated pool state\n");
+		reportFailure();
+	}
+	else
+	{
+		reportSuccess();
+	}
+
+	// Consecutive blocks of output, and separate sessions, must differ.
+	for (i = 32; i < SESSION_TEST_BYTES; i += 32)
+	{
+		if (!memcmp(&(out1[i - 32]), &(out1[i]), 32))
+		{
+			break;
+		}
+	}
+	if (i < SESSION_TEST_BYTES)
+	{
+		printf("Session output repeats at offset %u\n", i);
+		reportFailure();
+	}
+	else
+	{
+		reportSuccess();
+	}
+	randomSessionGetBytes(&session, out2, 32);
+	if (!memcmp(out1, out2, 32))
+	{
+		printf("Session output restarted\n");
+		reportFailure();
+	}
+	else
+	{
+		reportSuccess();
+	}
+	randomSessionEnd(&session);
+	randomSessionBeginTemporaryPool(&session, pool_state);
+	randomSessionGetBytes(&session, out2, SESSION_TEST_BYTES);
+	randomSessionEnd(&session);
+	if (!memcmp(out1, out2, SESSION_TEST_BYTES))
+	{
+		printf("Two sessions produced the same output\n");
+		reportFailure();
+	}
+	else
+	{
+		reportSuccess();
+	}
+
+	start = clock();
+	for (i = 0; i < SESSION_TEST_BYTES; i += 32)
+	{
+		getRandom256TemporaryPool(&(out1[i]), pool_state);
+	}
+	per_call_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+	start = clock();
+	randomSessionBeginTemporaryPool(&session, pool_state);
+	randomSessionGetBytes(&session, out1, SESSION_TEST_BYTES);
+	randomSessionEnd(&session);
+	session_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+	printf("Generating %u random bytes:\n", SESSION_TEST_BYTES);
+	printf("  getRandom256() per 32 bytes: %.3f ms\n", per_call_time * 1000.0);
+	printf("  one random session:          %.3f ms\n", session_time * 1000.0);
+
+	free(out1);
+	free(out2);
+}
+
+int main(void)
+{
+	initTests(__FILE__);
+	srand(42);
+	testDerivedNodeCache();
+	testLeanDerivation();
+	benchmarkDerivation();
+	testRandomSession();
+	finishTests();
+	exit(0);
+}
+
+#endif // #ifdef TEST_PRANDOM
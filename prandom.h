@@ -11,6 +11,7 @@
 #include "common.h"
 #include "bignum256.h"
 #include "storage_common.h"
+#include "hmac_drbg.h"
 
 #ifdef TEST
 #include "ecdsa.h"
@@ -41,6 +42,16 @@ extern "C" {
   */
 #define OTP_LENGTH				5
 
+/** State of a random number generation session. A session is seeded once
+  * from the HWRNG and the persistent entropy pool, and can then generate
+  * any number of random bytes in RAM. See randomSessionBegin().
+  */
+typedef struct RandomSessionStruct
+{
+	/** Generator which expands the seed into random bytes. */
+	HmacDrbgState drbg;
+} RandomSession;
+
 // Some sanity checks.
 #if ENTROPY_POOL_LENGTH > (POOL_CHECKSUM_ADDRESS - ADDRESS_ENTROPY_POOL)
 #error ENTROPY_POOL_LENGTH is too big
@@ -55,6 +66,10 @@ extern bool getEntropyPool(uint8_t *out_pool_state);
 extern bool initialiseEntropyPool(uint8_t *initial_pool_state);
 extern bool getRandom256(BigNum256 n);
 extern bool getRandom256TemporaryPool(BigNum256 n, uint8_t *pool_state);
+extern bool randomSessionBegin(RandomSession *session);
+extern bool randomSessionBeginTemporaryPool(RandomSession *session, uint8_t *pool_state);
+extern void randomSessionGetBytes(RandomSession *session, uint8_t *out, uint32_t length);
+extern void randomSessionEnd(RandomSession *session);
 extern void generateInsecureOTP(char *otp);
 extern void generateInsecurePIN(char *otp, int length);
 extern bool generateDeterministic256(BigNum256 out, const uint8_t *seed, const uint32_t chain_lvl_1, const uint32_t chain_lvl_2, const uint32_t chain_lvl_3);
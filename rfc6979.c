@@ -0,0 +1,396 @@
+/** \file rfc6979.c
+  *
+  * \brief Deterministically generates ECDSA nonces, as described by RFC 6979.
+  *
+  * ECDSA requires a secret, unique nonce ("k") for every signature. Choosing
+  * it with the hardware random number generator means every signature waits
+  * on the HWRNG and on the entropy pool (which is persisted to non-volatile
+  * memory), and a faulty or predictable RNG leaks the private key. RFC 6979
+  * instead derives k from the private key and the message hash using
+  * HMAC_DRBG (with HMAC-SHA256 here; see hmac_drbg.c), so signing needs no entropy at all and
+  * the same (private key, hash) pair always produces the same signature.
+  *
+  * Optionally, extra entropy can be mixed in as described in section 3.6 of
+  * the RFC. This keeps the nonce secret even if the RNG is bad, while
+  * ensuring that a good RNG still makes signatures non-repeatable.
+  *
+  * This code is based on RFC 6979, "Deterministic Usage of the Digital
+  * Signature Algorithm (DSA) and Elliptic Curve Digital Signature Algorithm
+  * (ECDSA)", obtained from http://tools.ietf.org/html/rfc6979.
+  *
+  * This file is licensed as described by the file LICENCE.
+  */
+
+#ifdef TEST_RFC6979
+#include <stdlib.h>
+#include <stdio.h>
+#include "test_helpers.h"
+#include "sha256.h"
+#include "hash.h"
+#endif // #ifdef TEST_RFC6979
+
+#include <string.h>
+#include "common.h"
+#include "bignum256.h"
+#include "ecdsa.h"
+#include "hmac_drbg.h"
+#include "rfc6979.h"
+
+/** Reverse the byte order of a 32 byte array.
+  * \param out The reversed array will be written here. This must not alias
+  *            in.
+  * \param in The array to reverse.
+  */
+static void reverse32(uint8_t *out, const uint8_t *in)
+{
+	uint8_t i;
+
+	for (i = 0; i < 32; i++)
+	{
+		out[i] = in[31 - i];
+	}
+}
+
+/** Initialise a nonce generator for one signature. This is steps a to g of
+  * section 3.2 of RFC 6979, which amount to instantiating HMAC_DRBG with
+  * the private key and hash as seed material.
+  * \param state The generator state to initialise.
+  * \param hash The message hash which will be signed, as a 32 byte
+  *             little-endian multi-precision integer (the same format
+  *             ecdsaSign() accepts).
+  * \param private_key The private key which will sign the hash, as a 32 byte
+  *                    little-endian multi-precision integer.
+  * \param extra_entropy Optional 32 bytes of additional data ("k'" of
+  *                      section 3.6), or NULL to use no additional data.
+  *                      Passing fresh random bytes here gives non-repeatable
+  *                      signatures without making nonce secrecy depend on
+  *                      the quality of the RNG.
+  */
+void rfc6979Begin(Rfc6979State *state, BigNum256 hash, BigNum256 private_key, const uint8_t *extra_entropy)
+{
+	uint8_t seed[96];
+	uint8_t seed_length;
+	uint8_t reduced_hash[32];
+
+	// seed = int2octets(x) || bits2octets(h1) [|| k']. Since the order of
+	// secp256k1 is 256 bits long, bits2octets(h1) is just h1 modulo n.
+	setFieldToN();
+	bigModulo(reduced_hash, hash);
+	reverse32(&(seed[0]), private_key);
+	reverse32(&(seed[32]), reduced_hash);
+	seed_length = 64;
+	if (extra_entropy != NULL)
+	{
+		memcpy(&(seed[64]), extra_entropy, 32);
+		seed_length = 96;
+	}
+	hmacDrbgInstantiate(&(state->drbg), seed, seed_length);
+	memset(seed, 0, sizeof(seed));
+	memset(reduced_hash, 0, sizeof(reduced_hash));
+}
+
+/** Generate the next nonce candidate. The first call after rfc6979Begin()
+  * returns the RFC 6979 nonce; subsequent calls return the further
+  * candidates which the RFC specifies should be used if a signature turns
+  * out to be invalid (i.e. r or s is 0).
+  *
+  * Since the order of secp256k1 is 256 bits long, step h is exactly one
+  * 32 byte HMAC_DRBG generate request, and the K/V update of step h.3 is
+  * the update which follows every generate request.
+  * \param state The generator state, which must have been initialised
+  *              using rfc6979Begin().
+  * \param out_k The nonce will be written here, as a 32 byte little-endian
+  *              multi-precision integer. It is guaranteed to be in the
+  *              range [1, n - 1], where n is the order of secp256k1.
+  */
+void rfc6979Next(Rfc6979State *state, BigNum256 out_k)
+{
+	uint8_t t[32];
+	uint8_t reduced_k[32];
+
+	setFieldToN();
+	do
+	{
+		hmacDrbgGenerate(&(state->drbg), t, sizeof(t));
+		reverse32(out_k, t);
+		bigModulo(reduced_k, out_k);
+	} while (bigIsZero(out_k) || (bigCompare(reduced_k, out_k) != BIGCMP_EQUAL));
+	memset(t, 0, sizeof(t));
+	memset(reduced_k, 0, sizeof(reduced_k));
+}
+
+/** Clear a nonce generator, so that no secrets are left in memory.
+  * \param state The generator state to clear.
+  */
+void rfc6979Clear(Rfc6979State *state)
+{
+	hmacDrbgClear(&(state->drbg));
+}
+
+#ifdef TEST_RFC6979
+
+/** Stores one RFC 6979 test vector for secp256k1 with SHA-256. */
+struct RFC6979TestVector
+{
+	/** Private key, big-endian. */
+	const uint8_t private_key[32];
+	/** Message; the hash which is signed is the SHA-256 hash of this. */
+	const char *message;
+	/** Expected first nonce, big-endian. */
+	const uint8_t expected_k[32];
+	/** Expected nonce which is used if the first one doesn't work,
+	  * big-endian. */
+	const uint8_t expected_k2[32];
+	/** Expected r component of the signature, big-endian. */
+	const uint8_t expected_r[32];
+	/** Expected s component of the signature (with s <= n / 2),
+	  * big-endian. */
+	const uint8_t expected_s[32];
+};
+
+/** Test vectors for rfc6979Begin() and rfc6979Next(). The first nonces and
+  * the signatures are the widely-used secp256k1 vectors (as used by
+  * python-ecdsa and bitcoinjs-lib, for example). The second nonces were
+  * generated by continuing step h of section 3.2 in a straightforward Python
+  * implementation using the hmac and hashlib modules.
+  */
+static const struct RFC6979TestVector test_vectors[] =
+{
+
+{{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01},
+"Satoshi Nakamoto",
+{0x8f, 0x8a, 0x27, 0x6c, 0x19, 0xf4, 0x14, 0x96,
+0x56, 0xb2, 0x80, 0x62, 0x1e, 0x35, 0x8c, 0xce,
+0x24, 0xf5, 0xf5, 0x25, 0x42, 0x77, 0x26, 0x91,
+0xee, 0x69, 0x06, 0x3b, 0x74, 0xf1, 0x5d, 0x15},
+{0xf1, 0x5f, 0xb7, 0x63, 0xa6, 0xbc, 0xbb, 0xac,
+0xbd, 0xe0, 0xa6, 0xa9, 0xae, 0x2a, 0x02, 0x48,
+0x2b, 0xd9, 0x2f, 0x3e, 0x75, 0xa5, 0x0b, 0x35,
+0x7b, 0xd5, 0x51, 0xdd, 0xd7, 0x71, 0x04, 0x5e},
+{0x93, 0x4b, 0x1e, 0xa1, 0x0a, 0x4b, 0x3c, 0x17,
+0x57, 0xe2, 0xb0, 0xc0, 0x17, 0xd0, 0xb6, 0x14,
+0x3c, 0xe3, 0xc9, 0xa7, 0xe6, 0xa4, 0xa4, 0x98,
+0x60, 0xd7, 0xa6, 0xab, 0x21, 0x0e, 0xe3, 0xd8},
+{0x24, 0x42, 0xce, 0x9d, 0x2b, 0x91, 0x60, 0x64,
+0x10, 0x80, 0x14, 0x78, 0x3e, 0x92, 0x3e, 0xc3,
+0x6b, 0x49, 0x74, 0x3e, 0x2f, 0xfa, 0x1c, 0x44,
+0x96, 0xf0, 0x1a, 0x51, 0x2a, 0xaf, 0xd9, 0xe5}},
+
+{{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01},
+"All those moments will be lost in time, like tears in rain. Time to die...",
+{0x38, 0xaa, 0x22, 0xd7, 0x23, 0x76, 0xb4, 0xdb,
+0xc4, 0x72, 0xe0, 0x6c, 0x3b, 0xa4, 0x03, 0xee,
+0x0a, 0x39, 0x4d, 0xa6, 0x3f, 0xc5, 0x8d, 0x88,
+0x68, 0x6c, 0x61, 0x1a, 0xba, 0x98, 0xd6, 0xb3},
+{0xdc, 0x54, 0x17, 0xa2, 0xad, 0xa9, 0x88, 0x71,
+0xb9, 0xee, 0x7d, 0xb9, 0xe1, 0x2e, 0x62, 0xe7,
+0x28, 0x3f, 0x6f, 0xc0, 0xe1, 0x8a, 0x1c, 0x1b,
+0x16, 0x1e, 0x7e, 0x75, 0xa6, 0x40, 0x34, 0xba},
+{0x86, 0x00, 0xdb, 0xd4, 0x1e, 0x34, 0x8f, 0xe5,
+0xc9, 0x46, 0x5a, 0xb9, 0x2d, 0x23, 0xe3, 0xdb,
+0x8b, 0x98, 0xb8, 0x73, 0xbe, 0xec, 0xd9, 0x30,
+0x73, 0x64, 0x88, 0x69, 0x64, 0x38, 0xcb, 0x6b},
+{0x54, 0x7f, 0xe6, 0x44, 0x27, 0x49, 0x6d, 0xb3,
+0x3b, 0xf6, 0x60, 0x19, 0xda, 0xcb, 0xf0, 0x03,
+0x9c, 0x04, 0x19, 0x9a, 0xbb, 0x01, 0x22, 0x91,
+0x86, 0x01, 0xdb, 0x38, 0xa7, 0x2c, 0xfc, 0x21}},
+
+{{0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+0xba, 0xae, 0xdc, 0xe6, 0xaf, 0x48, 0xa0, 0x3b,
+0xbf, 0xd2, 0x5e, 0x8c, 0xd0, 0x36, 0x41, 0x40},
+"Satoshi Nakamoto",
+{0x33, 0xa1, 0x9b, 0x60, 0xe2, 0x5f, 0xb6, 0xf4,
+0x43, 0x5a, 0xf5, 0x3a, 0x3d, 0x42, 0xd4, 0x93,
+0x64, 0x48, 0x27, 0x36, 0x7e, 0x64, 0x53, 0x92,
+0x85, 0x54, 0xf4, 0x3e, 0x49, 0xaa, 0x6f, 0x90},
+{0x63, 0x56, 0x53, 0x80, 0x6d, 0x2b, 0x85, 0x1e,
+0xdb, 0x5e, 0xb4, 0xa3, 0xe0, 0x09, 0x8a, 0xd6,
+0xdf, 0x9c, 0xf1, 0x64, 0x47, 0xdc, 0x19, 0x53,
+0x0c, 0x33, 0x85, 0x4e, 0x78, 0xa5, 0xc9, 0x64},
+{0xfd, 0x56, 0x7d, 0x12, 0x1d, 0xb6, 0x6e, 0x38,
+0x29, 0x91, 0x53, 0x4a, 0xda, 0x77, 0xa6, 0xbd,
+0x31, 0x06, 0xf0, 0xa1, 0x09, 0x8c, 0x23, 0x1e,
+0x47, 0x99, 0x34, 0x47, 0xcd, 0x6a, 0xf2, 0xd0},
+{0x6b, 0x39, 0xcd, 0x0e, 0xb1, 0xbc, 0x86, 0x03,
+0xe1, 0x59, 0xef, 0x5c, 0x20, 0xa5, 0xc8, 0xad,
+0x68, 0x5a, 0x45, 0xb0, 0x6c, 0xe9, 0xbe, 0xbe,
+0xd3, 0xf1, 0x53, 0xd1, 0x0d, 0x93, 0xbe, 0xd5}},
+
+{{0xf8, 0xb8, 0xaf, 0x8c, 0xe3, 0xc7, 0xcc, 0xa5,
+0xe3, 0x00, 0xd3, 0x39, 0x39, 0x54, 0x0c, 0x10,
+0xd4, 0x5c, 0xe0, 0x01, 0xb8, 0xf2, 0x52, 0xbf,
+0xbc, 0x57, 0xba, 0x03, 0x42, 0x90, 0x41, 0x81},
+"Alan Turing",
+{0x52, 0x5a, 0x82, 0xb7, 0x0e, 0x67, 0x87, 0x43,
+0x98, 0x06, 0x75, 0x43, 0xfd, 0x84, 0xc8, 0x3d,
+0x30, 0xc1, 0x75, 0xfd, 0xc4, 0x5f, 0xde, 0xee,
+0x08, 0x2f, 0xe1, 0x3b, 0x1d, 0x7c, 0xfd, 0xf1},
+{0x7f, 0xd1, 0x1a, 0xa3, 0xdb, 0x66, 0xad, 0x20,
+0xc8, 0x32, 0xd3, 0xdf, 0x28, 0x8d, 0x33, 0x98,
+0x2a, 0xca, 0x50, 0xb1, 0xcd, 0x43, 0x68, 0x80,
+0xb4, 0x4d, 0x83, 0x98, 0x19, 0x08, 0x7a, 0x84},
+{0x70, 0x63, 0xae, 0x83, 0xe7, 0xf6, 0x2b, 0xbb,
+0x17, 0x17, 0x98, 0x13, 0x1b, 0x4a, 0x05, 0x64,
+0xb9, 0x56, 0x93, 0x00, 0x92, 0xb3, 0x3b, 0x07,
+0xb3, 0x95, 0x61, 0x5d, 0x9e, 0xc7, 0xe1, 0x5c},
+{0x58, 0xdf, 0xcc, 0x1e, 0x00, 0xa3, 0x5e, 0x15,
+0x72, 0xf3, 0x66, 0xff, 0xe3, 0x4b, 0xa0, 0xfc,
+0x47, 0xdb, 0x1e, 0x71, 0x89, 0x75, 0x9b, 0x9f,
+0xb2, 0x33, 0xc5, 0xb0, 0x5a, 0xb3, 0x88, 0xea}},
+
+{{0xe9, 0x16, 0x71, 0xc4, 0x62, 0x31, 0xf8, 0x33,
+0xa6, 0x40, 0x6c, 0xcb, 0xea, 0x0e, 0x3e, 0x39,
+0x2c, 0x76, 0xc1, 0x67, 0xba, 0xc1, 0xcb, 0x01,
+0x3f, 0x6f, 0x10, 0x13, 0x98, 0x04, 0x55, 0xc2},
+"There is a computer disease that anybody who works with computers knows about. It's a very serious disease and it interferes completely with the work. The trouble with computers is that you 'play' with them!",
+{0x1f, 0x4b, 0x84, 0xc2, 0x3a, 0x86, 0xa2, 0x21,
+0xd2, 0x33, 0xf2, 0x52, 0x1b, 0xe0, 0x18, 0xd9,
+0x31, 0x86, 0x39, 0xd5, 0xb8, 0xbb, 0xd6, 0x37,
+0x4a, 0x8a, 0x59, 0x23, 0x2d, 0x16, 0xad, 0x3d},
+{0x61, 0x2a, 0xed, 0xe6, 0x74, 0x5c, 0xf5, 0xdd,
+0x1c, 0xcb, 0x89, 0xda, 0x21, 0x66, 0x5a, 0x8a,
+0x7c, 0xfd, 0xf0, 0x86, 0xcf, 0x72, 0x46, 0x54,
+0xa0, 0x95, 0x70, 0x1e, 0xb5, 0xc6, 0xc4, 0xaf},
+{0xb5, 0x52, 0xed, 0xd2, 0x75, 0x80, 0x14, 0x1f,
+0x3b, 0x2a, 0x54, 0x63, 0x04, 0x8c, 0xb7, 0xcd,
+0x3e, 0x04, 0x7b, 0x97, 0xc9, 0xf9, 0x80, 0x76,
+0xc3, 0x2d, 0xbd, 0xf8, 0x5a, 0x68, 0x71, 0x8b},
+{0x27, 0x9f, 0xa7, 0x2d, 0xd1, 0x9b, 0xfa, 0xe0,
+0x55, 0x77, 0xe0, 0x6c, 0x7c, 0x0c, 0x19, 0x00,
+0xc3, 0x71, 0xfc, 0xd5, 0x89, 0x3f, 0x7e, 0x1d,
+0x56, 0xa3, 0x7d, 0x30, 0x17, 0x46, 0x71, 0xf6}}
+
+};
+
+/** Expected first nonce for the first test vector, with the bytes 0x00,
+  * 0x01, ..., 0x1f supplied as extra entropy. This was generated using the
+  * same Python implementation as the second nonces in #test_vectors. */
+static const uint8_t expected_k_extra[32] = {
+0x32, 0x62, 0xba, 0x5f, 0xea, 0xf7, 0xc9, 0x59,
+0xd7, 0x99, 0xf4, 0xcb, 0x84, 0xbd, 0x85, 0x93,
+0x5d, 0xe9, 0x7b, 0x31, 0xd7, 0x73, 0x09, 0x64,
+0x7a, 0x42, 0x32, 0xe0, 0x7e, 0x2b, 0xec, 0xdb};
+
+/** Check that a little-endian result matches a big-endian expected value.
+  * \param result The little-endian value to check.
+  * \param expected The big-endian value which result should be equal to.
+  * \param what Description of what is being checked, for failure messages.
+  * \param index Test vector number, for failure messages.
+  */
+static void checkResult(const uint8_t *result, const uint8_t *expected, const char *what, unsigned int index)
+{
+	uint8_t temp[32];
+
+	reverse32(temp, result);
+	if (memcmp(temp, expected, 32))
+	{
+		printf("Test vector %u: %s doesn't match\n", index, what);
+		reportFailure();
+	}
+	else
+	{
+		reportSuccess();
+	}
+}
+
+int main(void)
+{
+	unsigned int i;
+	uint8_t hash[32];
+	uint8_t private_key[32];
+	uint8_t k[32];
+	uint8_t k_again[32];
+	uint8_t r[32];
+	uint8_t s[32];
+	uint8_t extra_entropy[32];
+	HashState hs;
+	Rfc6979State state;
+
+	initTests(__FILE__);
+
+	for (i = 0; i < (sizeof(test_vectors) / sizeof(struct RFC6979TestVector)); i++)
+	{
+		sha256Begin(&hs);
+		sha256WriteBytes(&hs, (const uint8_t *)test_vectors[i].message, (uint32_t)strlen(test_vectors[i].message));
+		sha256Finish(&hs);
+		writeHashToByteArray(hash, &hs, false);
+		reverse32(private_key, test_vectors[i].private_key);
+
+		rfc6979Begin(&state, hash, private_key, NULL);
+		rfc6979Next(&state, k);
+		checkResult(k, test_vectors[i].expected_k, "first nonce", i);
+		rfc6979Next(&state, k_again);
+		checkResult(k_again, test_vectors[i].expected_k2, "second nonce", i);
+		rfc6979Clear(&state);
+
+		// Nonces must be deterministic.
+		rfc6979Begin(&state, hash, private_key, NULL);
+		rfc6979Next(&state, k_again);
+		rfc6979Clear(&state);
+		if (memcmp(k, k_again, 32))
+		{
+			printf("Test vector %u: nonce is not deterministic\n", i);
+			reportFailure();
+		}
+		else
+		{
+			reportSuccess();
+		}
+
+		if (ecdsaSign(r, s, hash, private_key, k))
+		{
+			printf("Test vector %u: ecdsaSign() failed\n", i);
+			reportFailure();
+		}
+		else
+		{
+			checkResult(r, test_vectors[i].expected_r, "r", i);
+			checkResult(s, test_vectors[i].expected_s, "s", i);
+		}
+	}
+
+	// Extra entropy must change the nonce, as specified in section 3.6.
+	for (i = 0; i < 32; i++)
+	{
+		extra_entropy[i] = (uint8_t)i;
+	}
+	sha256Begin(&hs);
+	sha256WriteBytes(&hs, (const uint8_t *)test_vectors[0].message, (uint32_t)strlen(test_vectors[0].message));
+	sha256Finish(&hs);
+	writeHashToByteArray(hash, &hs, false);
+	reverse32(private_key, test_vectors[0].private_key);
+	rfc6979Begin(&state, hash, private_key, extra_entropy);
+	rfc6979Next(&state, k);
+	rfc6979Clear(&state);
+	checkResult(k, expected_k_extra, "nonce with extra entropy", 0);
+
+	// rfc6979Clear() must not leave anything behind.
+	for (i = 0; i < sizeof(state); i++)
+	{
+		if (((uint8_t *)&state)[i] != 0)
+		{
+			break;
+		}
+	}
+	if (i != sizeof(state))
+	{
+		printf("rfc6979Clear() didn't clear state\n");
+		reportFailure();
+	}
+	else
+	{
+		reportSuccess();
+	}
+
+	finishTests();
+	exit(0);
+}
+
+#endif // #ifdef TEST_RFC6979
@@ -0,0 +1,28 @@
+/** \file rfc6979.h
+  *
+  * \brief Describes functions and types exported by rfc6979.c.
+  *
+  * This file is licensed as described by the file LICENCE.
+  */
+
+#ifndef RFC6979_H_INCLUDED
+#define RFC6979_H_INCLUDED
+
+#include "common.h"
+#include "bignum256.h"
+#include "hmac_drbg.h"
+
+/** Internal state of the RFC 6979 nonce generator. The contents of this
+  * should be treated as secret, since they are derived from the private
+  * key. */
+typedef struct Rfc6979StateStruct
+{
+	/** The HMAC_DRBG instance of section 3.2. */
+	HmacDrbgState drbg;
+} Rfc6979State;
+
+extern void rfc6979Begin(Rfc6979State *state, BigNum256 hash, BigNum256 private_key, const uint8_t *extra_entropy);
+extern void rfc6979Next(Rfc6979State *state, BigNum256 out_k);
+extern void rfc6979Clear(Rfc6979State *state);
+
+#endif // #ifndef RFC6979_H_INCLUDED
@@ -234,6 +234,19 @@ void ripemd160WriteByte(HashState *hs, uint8_t byte)
 	hashWriteByte(hs, byte);
 }
 
+/** Add a number of bytes to the message buffer. This is equivalent to, but
+  * much faster than, calling ripemd160WriteByte() for each byte.
+  * \param hs The hash state to act on. The hash state must be one that has
+  *           been initialised using ripemd160Begin() at some time in the
+  *           past.
+  * \param data The bytes to add.
+  * \param length The number of bytes to add.
+  */
+void ripemd160WriteBytes(HashState *hs, const uint8_t *data, uint32_t length)
+{
+	hashWriteBytes(hs, data, length);
+}
+
 /** Finalise the hashing of a message by writing appropriate padding and
   * length bytes.
   * \param hs The hash state to act on. The hash state must be one that has
@@ -18,6 +18,7 @@
 
 extern void ripemd160Begin(HashState *hs);
 extern void ripemd160WriteByte(HashState *hs, uint8_t byte);
+extern void ripemd160WriteBytes(HashState *hs, const uint8_t *data, uint32_t length);
 extern void ripemd160Finish(HashState *hs);
 
 #endif // #ifndef RIPEMD160_H_INCLUDED
@@ -11,6 +11,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
 #include "test_helpers.h"
 #endif // #ifdef TEST_SHA256
 
@@ -187,6 +188,19 @@ void sha256WriteByte(HashState *hs, uint8_t byte)
 	hashWriteByte(hs, byte);
 }
 
+/** Add a number of bytes to the message buffer, calling sha256Block()
+  * whenever the message buffer is full. This is equivalent to, but much
+  * faster than, calling sha256WriteByte() for each byte.
+  * \param hs The hash state to act on. The hash state must be one that has
+  *           been initialised using sha256Begin() at some time in the past.
+  * \param data The bytes to add.
+  * \param length The number of bytes to add.
+  */
+void sha256WriteBytes(HashState *hs, const uint8_t *data, uint32_t length)
+{
+	hashWriteBytes(hs, data, length);
+}
+
 /** Finalise the hashing of a message by writing appropriate padding and
   * length bytes.
   * \param hs The hash state to act on. The hash state must be one that has
@@ -205,15 +219,11 @@ void sha256Finish(HashState *hs)
 void sha256FinishDouble(HashState *hs)
 {
 	uint8_t temp[32];
-	uint8_t i;
 
 	sha256Finish(hs);
 	writeHashToByteArray(temp, hs, true);
 	sha256Begin(hs);
-	for (i = 0; i < 32; i++)
-	{
-		sha256WriteByte(hs, temp[i]);
-	}
+	sha256WriteBytes(hs, temp, 32);
 	sha256Finish(hs);
 }
 
@@ -334,9 +344,98 @@ http://csrc.nist.gov/groups/STM/cavp/index.html#03", filename);
 	fclose(f);
 }
 
+/** Number of bytes in the message used by testWriteBytes() and
+  * benchmarkWriteBytes(). */
+#define BULK_MESSAGE_LENGTH		1000
+
+/** Check that sha256WriteBytes() gives the same hash as
+  * sha256WriteByte(), for every message length up to #BULK_MESSAGE_LENGTH
+  * and with the message split into two sha256WriteBytes() calls at various
+  * (unaligned) places. */
+static void testWriteBytes(void)
+{
+	uint8_t message[BULK_MESSAGE_LENGTH];
+	HashState hs;
+	uint32_t compare_h[8];
+	uint32_t length;
+	uint32_t split;
+	uint32_t i;
+
+	for (i = 0; i < BULK_MESSAGE_LENGTH; i++)
+	{
+		message[i] = (uint8_t)rand();
+	}
+	for (length = 0; length < BULK_MESSAGE_LENGTH; length++)
+	{
+		sha256Begin(&hs);
+		for (i = 0; i < length; i++)
+		{
+			sha256WriteByte(&hs, message[i]);
+		}
+		sha256Finish(&hs);
+		memcpy(compare_h, hs.h, 32);
+		for (split = 0; split <= length; split += 1 + (split / 8))
+		{
+			sha256Begin(&hs);
+			sha256WriteBytes(&hs, message, split);
+			sha256WriteBytes(&hs, &(message[split]), length - split);
+			sha256Finish(&hs);
+			if (memcmp(hs.h, compare_h, 32))
+			{
+				printf("sha256WriteBytes() mismatch, length = %u, split = %u\n", length, split);
+				reportFailure();
+			}
+			else
+			{
+				reportSuccess();
+			}
+		}
+	}
+}
+
+/** Measure how fast sha256WriteByte() and sha256WriteBytes() are, printing
+  * the results in MB/s. */
+static void benchmarkWriteBytes(void)
+{
+	uint8_t message[BULK_MESSAGE_LENGTH];
+	HashState hs;
+	clock_t start;
+	double seconds;
+	uint32_t iterations;
+	uint32_t i;
+	uint32_t j;
+
+	iterations = 20000;
+	memset(message, 0x5a, sizeof(message));
+	start = clock();
+	sha256Begin(&hs);
+	for (i = 0; i < iterations; i++)
+	{
+		for (j = 0; j < BULK_MESSAGE_LENGTH; j++)
+		{
+			sha256WriteByte(&hs, message[j]);
+		}
+	}
+	sha256Finish(&hs);
+	seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+	printf("sha256WriteByte():  %.1f MB/s\n", (double)iterations * BULK_MESSAGE_LENGTH / seconds / 1e6);
+	start = clock();
+	sha256Begin(&hs);
+	for (i = 0; i < iterations; i++)
+	{
+		sha256WriteBytes(&hs, message, BULK_MESSAGE_LENGTH);
+	}
+	sha256Finish(&hs);
+	seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+	printf("sha256WriteBytes(): %.1f MB/s\n", (double)iterations * BULK_MESSAGE_LENGTH / seconds / 1e6);
+}
+
 int main(void)
 {
 	initTests(__FILE__);
+	srand(42);
+	testWriteBytes();
+	benchmarkWriteBytes();
 	scanTestVectors("SHA256ShortMsg.rsp");
 	scanTestVectors("SHA256LongMsg.rsp");
 	finishTests();
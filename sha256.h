@@ -3,7 +3,8 @@
   * \brief Describes functions exported by sha256.c.
   *
   * To calculate a SHA-256 hash, call sha256Begin(), then call
-  * sha256WriteByte() for each byte of the message, then call
+  * sha256WriteByte() for each byte of the message (or sha256WriteBytes() for
+  * a run of bytes), then call
   * sha256Finish() (or sha256FinishDouble(), if you want a double SHA-256
   * hash). The hash will be in HashState#h, but it can also be
   * extracted and placed into to a byte array using writeHashToByteArray().
@@ -24,6 +25,7 @@
 
 extern void sha256Begin(HashState *hs);
 extern void sha256WriteByte(HashState *hs, uint8_t byte);
+extern void sha256WriteBytes(HashState *hs, const uint8_t *data, uint32_t length);
 extern void sha256Finish(HashState *hs);
 extern void sha256FinishDouble(HashState *hs);
 
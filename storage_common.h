@@ -21,6 +21,15 @@
   */
 #define DEVICE_UUID_LENGTH				16
 
+/** Address where the wallet directory is located. The wallet directory is a
+  * small summary of which wallet slots are occupied, so that wallets can be
+  * counted and listed without reading every wallet record. It occupies space
+  * which was previously unused, so that nothing else (in particular, the
+  * wallet records) has to move. See wallet.c for its format. */
+#define WALLET_DIRECTORY_ADDRESS		0
+/** Length of the wallet directory, in bytes. */
+#define WALLET_DIRECTORY_LENGTH			64
+
 #define ENTROPY_POOL_LENGTH				32
 
 #define POOL_CHECKSUM_LENGTH			32
@@ -41,6 +41,7 @@
 #include "hexstring.h"
 #include "ssp.h"
 #include "arm/keypad_alpha.h"
+#include "arm/usart.h"
 //#include "arm/DueTimer/DueTimer.h"
 
 
@@ -105,6 +106,7 @@ static NOINLINE void getPublicKeyOnly(uint8_t *out_address, AddressHandle ah_roo
 bool writeSignaturesCallback(pb_ostream_t *stream, const pb_field_t *field, void * const *arg);
 static bool passwordInterjection(bool setup);
 bool getSignaturesCallback(void);
+static WalletErrors buildSignatureData(uint8_t *message_builder, uint32_t i, BigNum256 sig_hash);
 void showQRcode(AddressHandle ah_root4, AddressHandle ah_chain4, AddressHandle ah_index4);
 
 bool hashFieldCallbackGeneric(pb_istream_t *stream, uint8_t *theHash, uint8_t *theMessage, int *length, bool do_write_big_endian);
@@ -121,12 +123,31 @@ char *change_address_ptr_begin = &change_address;
 
 static int walletLoadAttemptsCounter;
 
-uint8_t message_slice_counter;
-
 /** Maximum size (in bytes) of any protocol buffer message sent by functions
   * in this file. */
 #define MAX_SEND_SIZE			40960
 
+/** Length (in bytes) of a packet header: magic, type and length. */
+#define PACKET_HEADER_LENGTH	8
+
+/** Size (in bytes) of the buffer which sendPacket() encodes messages into.
+  * Messages which fit are encoded only once. This is also the largest chunk
+  * sent with chunked framing, so it must be less than 65536. */
+#define PACKET_TX_BUFFER_SIZE	2048
+
+/** Value of the length field of a packet header which indicates that the
+  * payload is sent with chunked framing (see PROTOCOL.txt). */
+#define CHUNKED_FRAMING_LENGTH	0xffffffff
+
+/** Size (in bytes) of the chunks which getBulkCallback() and setBulkCallback()
+  * read, encrypt or decrypt and write at a time. This must be a multiple of
+  * 16 (the XEX block size). */
+#define BULK_CHUNK_SIZE			256
+
+/** Size (in bytes) of the signature record built by buildSignatureData().
+  * This is the max_size of signature_data_complete in messages.options. */
+#define SIGNATURE_DATA_LENGTH	109
+
 /** Because stdlib.h might not be included, NULL might be undefined. NULL
   * is only used as a placeholder pointer for translateWalletError() if
   * there is no appropriate pointer. */
@@ -214,12 +235,6 @@ static uint8_t *entropy_buffer;
 /** Number of bytes of entropy to send to the host; used for
   * the getEntropyCallback() callback function. */
 static size_t num_entropy_bytes;
-/** Pointer to bytes of bulk to send to the host; used for
-  * the getBulkCallback() callback function. */
-static uint8_t *bulk_buffer;
-/** Number of bytes of bulk to send to the host; used for
-  * the getBulkCallback() callback function. */
-static size_t num_bulk_bytes;
 
 //static uint8_t *bulk_data;
 
@@ -234,15 +249,24 @@ static SignMessage sign_message;
 
 #define INPUTS_LIMITS			128
 
-static AddressHandleExtended globalHandles[MAX_INPUTS] = {};
+static AddressHandleExtended globalHandles[MAX_SIGNED_INPUTS] = {};
 
 static uint32_t ahIndex;
 
 
 //static uint8_t sig_hash_global[32];  //###################################################
-static uint8_t sig_hash_global[MAX_INPUTS][32];
+static uint8_t sig_hash_global[MAX_SIGNED_INPUTS][32];
+
+static SignatureCompleteData message_buffer_for_sigs[MAX_SIGNED_INPUTS];
+
+/** Storage for fields of SignTransactionStreaming message. Needed for the
+  * signTransactionStreamingCallback() callback function. */
+static SignTransactionStreaming sign_transaction_streaming;
 
-static SignatureCompleteData message_buffer_for_sigs[MAX_INPUTS];
+/** Whether the user has approved the transaction whose hash is in
+  * #prev_transaction_hash for streaming signing. Once approved, later windows
+  * of the same transaction are signed without asking again. */
+static bool stream_sign_approved;
 
 
 /** Storage for fields of SignTransaction (HD) message. Needed for the
@@ -265,6 +289,24 @@ static size_t session_id_length;
 /** Arbitrary host-supplied bytes which are sent to the host to assure it that
   * a reset hasn't occurred. */
 static uint8_t session_id[64];
+/** Whether the host asked for chunked framing in its most recent Initialize
+  * message. If this is false, every packet is sent with its exact length in
+  * the header. */
+static bool chunked_framing_enabled;
+
+/** Packet header followed by the part of the payload which hasn't been sent
+  * yet. Used by sendPacket() and packetTxStreamCallback(). */
+static uint8_t packet_tx_buffer[PACKET_HEADER_LENGTH + PACKET_TX_BUFFER_SIZE];
+/** Number of payload bytes in #packet_tx_buffer. */
+static uint32_t packet_tx_used;
+/** Message ID of the packet being sent by sendPacket(). */
+static uint16_t packet_tx_message_id;
+/** Whether the payload of the packet being sent didn't fit in
+  * #packet_tx_buffer (and chunked framing is disabled). */
+static bool packet_tx_overflow;
+/** Whether the header of the packet being sent has already been sent. This
+  * only happens with chunked framing. */
+static bool packet_tx_header_sent;
 
 
 /** nanopb input stream which uses mainInputStreamCallback() as a stream
@@ -302,12 +344,7 @@ void ByteToChar(byte* bytes, char* chars, unsigned int count){
   */
 static void getBytesFromStream(uint8_t *buffer, uint8_t length)
 {
-	uint8_t i;
-
-	for (i = 0; i < length; i++)
-	{
-		buffer[i] = streamGetOneByte();
-	}
+	streamGetBytes(buffer, length);
 	payload_length -= length;
 }
 
@@ -325,7 +362,7 @@ static void writeBytesToStream(const uint8_t *buffer, size_t length)
 	}
 }
 
-/** nanopb input stream callback which uses streamGetOneByte() to get the
+/** nanopb input stream callback which uses streamGetBytes() to get the
   * requested bytes.
   * \param stream Input stream object that issued the callback.
   * \param buf Buffer to fill with requested bytes.
@@ -334,23 +371,21 @@ static void writeBytesToStream(const uint8_t *buffer, size_t length)
   */
 bool mainInputStreamCallback(pb_istream_t *stream, uint8_t *buf, size_t count)
 {
-	size_t i;
-
 	if (buf == NULL)
 	{
 		fatalError(); // this should never happen
 	}
-	for (i = 0; i < count; i++)
+	if (count > payload_length)
 	{
-		if (payload_length == 0)
-		{
-			// Attempting to read past end of payload.
-			stream->bytes_left = 0;
-			return false;
-		}
-		buf[i] = streamGetOneByte();
-		payload_length--;
+		// Attempting to read past end of payload. Consume what's left of
+		// the payload anyway, like a byte-by-byte read would.
+		streamGetBytes(buf, payload_length);
+		payload_length = 0;
+		stream->bytes_left = 0;
+		return false;
 	}
+	streamGetBytes(buf, (uint32_t)count);
+	payload_length -= count;
 	return true;
 }
 
@@ -374,12 +409,14 @@ bool mainOutputStreamCallback(pb_ostream_t *stream, const uint8_t *buf, size_t c
   */
 static void readAndIgnoreInput(void)
 {
-	if (payload_length > 0)
+	uint8_t buffer[32];
+	uint32_t chunk_length;
+
+	while (payload_length > 0)
 	{
-		for (; payload_length > 0; payload_length--)
-		{
-			streamGetOneByte();
-		}
+		chunk_length = MIN(payload_length, sizeof(buffer));
+		streamGetBytes(buffer, chunk_length);
+		payload_length -= chunk_length;
 	}
 }
 
@@ -410,61 +447,180 @@ static bool receiveMessage(const pb_field_t fields[], void *dest_struct)
 
 
 
-/** Send a packet.
+/** Write a packet header into the start of #packet_tx_buffer.
+  * \param length The value of the length field.
+  */
+static void writePacketHeader(uint32_t length)
+{
+	packet_tx_buffer[0] = '#';
+	packet_tx_buffer[1] = '#';
+	packet_tx_buffer[2] = (uint8_t)(packet_tx_message_id >> 8);
+	packet_tx_buffer[3] = (uint8_t)packet_tx_message_id;
+	writeU32BigEndian(&(packet_tx_buffer[4]), length);
+}
+
+/** Get the stream device ready to send a packet. This must be called before
+  * the first byte of a packet is sent. */
+static void beginTransmit(void)
+{
+	if(bluetooth_on==1)
+	{
+	    digitalWrite(BRTS2, LOW); //BRTS
+	    delay(50);
+	}
+}
+
+/** Finish sending a packet. */
+static void endTransmit(void)
+{
+	if(bluetooth_on==1)
+	{
+		usartFlushTransmit();
+		digitalWrite(BRTS2, HIGH); //BRTS
+	}
+}
+
+/** Send the payload bytes in #packet_tx_buffer as one chunk of a packet with
+  * chunked framing. The packet header is sent first if it hasn't been sent
+  * yet. If there are no payload bytes in the buffer, this sends the empty
+  * chunk which terminates the packet.
+  */
+static void sendPacketChunk(void)
+{
+	uint8_t buffer[2];
+
+	if (!packet_tx_header_sent)
+	{
+		beginTransmit();
+		writePacketHeader(CHUNKED_FRAMING_LENGTH);
+		writeBytesToStream(packet_tx_buffer, PACKET_HEADER_LENGTH);
+		packet_tx_header_sent = true;
+	}
+	buffer[0] = (uint8_t)(packet_tx_used >> 8);
+	buffer[1] = (uint8_t)packet_tx_used;
+	writeBytesToStream(buffer, 2);
+	writeBytesToStream(&(packet_tx_buffer[PACKET_HEADER_LENGTH]), packet_tx_used);
+	packet_tx_used = 0;
+}
+
+/** nanopb output stream callback which appends bytes to #packet_tx_buffer.
+  * When the buffer is full, it is sent as a chunk if chunked framing is
+  * enabled. Otherwise the rest of the message is discarded and
+  * #packet_tx_overflow is set; nanopb still counts the discarded bytes, so
+  * the length of the message is known afterwards.
+  *
+  * This can't use stream->bytes_written as an offset into the buffer,
+  * because nanopb uses a separate substream (starting from 0) for each
+  * submessage.
+  * \param stream Output stream object that issued the callback.
+  * \param buf Buffer with bytes to send.
+  * \param count Number of bytes to send.
+  * \return true on success, false on failure (nanopb convention).
+  */
+static bool packetTxStreamCallback(pb_ostream_t *stream, const uint8_t *buf, size_t count)
+{
+	size_t copy_length;
+
+	while (count > 0)
+	{
+		if (packet_tx_used == PACKET_TX_BUFFER_SIZE)
+		{
+			if (!chunked_framing_enabled)
+			{
+				packet_tx_overflow = true;
+				return true;
+			}
+			sendPacketChunk();
+		}
+		copy_length = MIN(count, PACKET_TX_BUFFER_SIZE - packet_tx_used);
+		memcpy(&(packet_tx_buffer[PACKET_HEADER_LENGTH + packet_tx_used]), buf, copy_length);
+		packet_tx_used += copy_length;
+		buf += copy_length;
+		count -= copy_length;
+	}
+	return true;
+}
+
+/** Check whether bytes written to an output stream will be thrown away.
+  * This is the case while sendPacket() is only counting the bytes of a
+  * message which is too big for #packet_tx_buffer. Field callbacks can use
+  * this to skip expensive work whose output won't be sent this time.
+  * \param stream The output stream to check.
+  * \return true if bytes written to stream will be discarded, false if they
+  *         may be sent.
+  */
+static bool packetTxDiscarding(const pb_ostream_t *stream)
+{
+	return (stream->callback == &packetTxStreamCallback)
+		&& !chunked_framing_enabled
+		&& (packet_tx_used == PACKET_TX_BUFFER_SIZE);
+}
+
+/** Send a packet. The message is encoded once, into #packet_tx_buffer, and
+  * the length field of the header is filled in afterwards. Field callbacks
+  * are therefore only run once for messages which fit in the buffer.
+  *
+  * Messages which don't fit are sent with chunked framing if the host asked
+  * for it. Otherwise, they have to be encoded a second time, now that their
+  * length is known.
   * \param message_id The message ID of the packet.
   * \param fields Field description array.
   * \param src_struct Field data which will be serialised and sent.
   */
 static void sendPacket(uint16_t message_id, const pb_field_t fields[], const void *src_struct)
 {
-	uint8_t buffer[4];
-	pb_ostream_t substream;
+	pb_ostream_t tx_stream;
 
 #ifdef TEST_STREAM_COMM
 	// From PROTOCOL, the current received packet must be fully consumed
 	// before any response can be sent.
 	assert(payload_length == 0);
 #endif
-	// Use a non-writing substream to get the length of the message without
-	// storing it anywhere.
-	substream.callback = NULL;
-	substream.state = NULL;
-	substream.max_size = MAX_SEND_SIZE;
-	substream.bytes_written = 0;
-	if (!pb_encode(&substream, fields, src_struct))
+	packet_tx_message_id = message_id;
+	packet_tx_used = 0;
+	packet_tx_overflow = false;
+	packet_tx_header_sent = false;
+	tx_stream.callback = &packetTxStreamCallback;
+	tx_stream.state = NULL;
+	tx_stream.max_size = MAX_SEND_SIZE;
+	tx_stream.bytes_written = 0;
+	if (!pb_encode(&tx_stream, fields, src_struct))
 	{
 		fatalError();
 	}
 
-	if(bluetooth_on==1)
+	if (packet_tx_header_sent)
 	{
-	    digitalWrite(BRTS2, LOW); //BRTS
-	    delay(50);
+		// Chunked framing: send the rest of the payload, then the empty
+		// chunk which terminates the packet.
+		if (packet_tx_used > 0)
+		{
+			sendPacketChunk();
+		}
+		sendPacketChunk();
 	}
-
-
-	// Send packet header.
-//	GOTTA SLICE THIS UP INTO <200 BYTE PACKETS
-	message_slice_counter = 0;
-	streamPutOneByte('#');
-	streamPutOneByte('#');
-	streamPutOneByte((uint8_t)(message_id >> 8));
-	streamPutOneByte((uint8_t)message_id);
-	writeU32BigEndian(buffer, substream.bytes_written);
-	writeBytesToStream(buffer, 4);
-	// Send actual message.
-	main_output_stream.bytes_written = 0;
-	main_output_stream.max_size = substream.bytes_written;
-	if (!pb_encode(&main_output_stream, fields, src_struct))
+	else if (!packet_tx_overflow)
 	{
-		fatalError();
+		// The entire payload is in the buffer, so the header and payload
+		// can be sent in one go.
+		beginTransmit();
+		writePacketHeader(tx_stream.bytes_written);
+		writeBytesToStream(packet_tx_buffer, PACKET_HEADER_LENGTH + packet_tx_used);
 	}
-	if(bluetooth_on==1)
+	else
 	{
-		delay(100);  // this should possibly be variable dependent on substream.bytes_written
-		digitalWrite(BRTS2, HIGH); //BRTS
+		// Too big for the buffer and the host can't handle chunked framing.
+		beginTransmit();
+		writePacketHeader(tx_stream.bytes_written);
+		writeBytesToStream(packet_tx_buffer, PACKET_HEADER_LENGTH);
+		main_output_stream.bytes_written = 0;
+		main_output_stream.max_size = tx_stream.bytes_written;
+		if (!pb_encode(&main_output_stream, fields, src_struct))
+		{
+			fatalError();
+		}
 	}
-
+	endTransmit();
 }
 
 /** nanopb field callback which will write the string specified by arg.
@@ -1239,6 +1395,10 @@ static bool otpInterjection(AskUserCommand command)
  */
 bool read_AHE_data(pb_istream_t *stream, const pb_field_t *field, void **arg)
 {
+	if (ahIndex >= MAX_SIGNED_INPUTS)
+	{
+		return false; // too many inputs for one sign request
+	}
 	while (stream->bytes_left)
     {
         if(!pb_decode(stream, AddressHandleExtended_fields, &globalHandles[ahIndex]))
@@ -1325,6 +1485,7 @@ bool checkTransactionPINexpertMode()
 				uint8_t temp1[1];
 				temp1[0] = 0;
 				nonVolatileWrite(temp1, WRONG_TRANSACTION_PIN_COUNT_ADDRESS, 1);
+				nonVolatileFlush();
 			}
 			return true;
 		}else
@@ -1336,6 +1497,7 @@ bool checkTransactionPINexpertMode()
 			uint8_t temp1[1];
 			temp1[0] = s;
 			nonVolatileWrite(temp1, WRONG_TRANSACTION_PIN_COUNT_ADDRESS, 1);
+			nonVolatileFlush();
 			writeX_Screen();
 			Software_Reset();
 		}
@@ -1353,7 +1515,6 @@ bool signTransactionCompleteCallback(pb_istream_t *stream, const pb_field_t *fie
 	uint8_t transaction_hash[32];
 	uint8_t sig_hash[ahIndex][32]; //index of ahIndex
 	uint8_t blank_hash[32] = {};
-	uint8_t message_builder[ahIndex][109];
 	uint32_t ahIndexIn = 0;
 
 
@@ -1438,15 +1599,16 @@ bool signTransactionCompleteCallback(pb_istream_t *stream, const pb_field_t *fie
 			memcpy(sig_hash_global[i], sig_hash[i], 32);
 		}
 
-		getSignaturesCallback();
-
-		userDenied(ASKUSER_SENDING_DATA);
+		if (getSignaturesCallback())
+		{
+			userDenied(ASKUSER_SENDING_DATA);
 
-		showReady();
+			showReady();
 
-		SignatureComplete message_buffer_local;
-		message_buffer_local.signature_complete_data.funcs.encode = &writeSignaturesCallback;
-		sendPacket(PACKET_TYPE_SIGNATURE_COMPLETE, SignatureComplete_fields, &message_buffer_local);
+			SignatureComplete message_buffer_local;
+			message_buffer_local.signature_complete_data.funcs.encode = &writeSignaturesCallback;
+			sendPacket(PACKET_TYPE_SIGNATURE_COMPLETE, SignatureComplete_fields, &message_buffer_local);
+		}
 	}
 
 	return true;
@@ -1454,19 +1616,124 @@ bool signTransactionCompleteCallback(pb_istream_t *stream, const pb_field_t *fie
 
 
 
-/** nanopb field callback for signature data of SignMessage message. This
-  * does (or more accurately, delegates) all the "work" of message
-  * signing: parsing the transaction, asking the user for approval, generating
-  * the signature and sending the signature.
+/** nanopb field callback for transaction data of SignTransactionStreaming
+  * message. This parses the transaction, computing signature hashes only
+  * for the window of inputs given by the message, then signs each input and
+  * sends its signature as soon as it is ready. Per-input memory use is
+  * bounded by the size of the window, so a transaction with any number of
+  * inputs (up to #MAX_INPUTS) can be signed by sending it once per window.
+  *
+  * The user is asked for approval when the first window (first_input = 0)
+  * is signed. Later windows are only signed if their transaction hash
+  * matches the approved one.
   * \param stream Input stream to read from.
-  * \param field Field which contains the signature data.
+  * \param field Field which contains the transaction data.
   * \param arg Unused.
   * \return true on success, false on failure (nanopb convention).
   */
+bool signTransactionStreamingCallback(pb_istream_t *stream, const pb_field_t *field, void **arg)
+{
+	bool approved;
+	bool permission_denied;
+	TransactionErrors r;
+	WalletErrors wallet_return;
+	uint8_t transaction_hash[32];
+	uint8_t sig_hash[MAX(ahIndex, 1)][32];
+	uint32_t first_input;
+	uint32_t i;
+	SignatureStreamData message_buffer;
+
+	first_input = sign_transaction_streaming.first_input;
+	clearOutputsSeen();
+	r = parseTransactionWindow(sig_hash, transaction_hash, stream->bytes_left, first_input, ahIndex, change_address_ptr_begin);
+	// See signTransactionCompleteCallback() for why this is needed.
+	payload_length -= stream->bytes_left;
+	stream->bytes_left = 0;
+	if (r != TRANSACTION_NO_ERROR)
+	{
+		writeFailureString(STRINGSET_TRANSACTION, (uint8_t)r);
+		return true;
+	}
+
+	approved = false;
+	if (first_input == 0)
+	{
+		stream_sign_approved = false;
+		prev_transaction_hash_valid = false;
+	}
+	else if (stream_sign_approved && prev_transaction_hash_valid)
+	{
+		if (bigCompare(transaction_hash, prev_transaction_hash) == BIGCMP_EQUAL)
+		{
+			approved = true;
+		}
+	}
+
+	if (!approved)
+	{
+		if (first_input != 0)
+		{
+			// Windows after the first must belong to the transaction the
+			// user approved.
+			stream_sign_approved = false;
+			writeFailureString(STRINGSET_MISC, MISCSTR_PERMISSION_DENIED_USER);
+			return true;
+		}
+		userDenied(ASKUSER_PREPARING_TRANSACTION);
+		permission_denied = buttonInterjection(ASKUSER_SIGN_TRANSACTION);
+		if (permission_denied)
+		{
+			writeX_Screen();
+			showReady();
+			return true;
+		}
+		if (hasTransactionPin())
+		{
+			checkTransactionPINexpertMode();
+		}
+		memcpy(prev_transaction_hash, transaction_hash, 32);
+		prev_transaction_hash_valid = true;
+		stream_sign_approved = true;
+	}
+
+	for (i = 0; i < ahIndex; i++)
+	{
+		wallet_return = buildSignatureData(message_buffer.signature_data_complete.bytes, i, sig_hash[i]);
+		if (wallet_return != WALLET_NO_ERROR)
+		{
+			// The host is waiting for a SignatureStreamData packet for
+			// every input in the window, or a Failure packet.
+			stream_sign_approved = false;
+			memset(sig_hash, 0, sizeof(sig_hash));
+			translateWalletError(wallet_return);
+			return true;
+		}
+		message_buffer.input_index = first_input + i;
+		message_buffer.signature_data_complete.size = SIGNATURE_DATA_LENGTH;
+		sendPacket(PACKET_TYPE_SIGNATURE_STREAM_DATA, SignatureStreamData_fields, &message_buffer);
+	}
+	memset(sig_hash, 0, sizeof(sig_hash));
+	showReady();
+	return true;
+}
+
+
+/** Sign every input of an approved (non-streamed) transaction, filling
+  * #message_buffer_for_sigs with one signature record per input.
+  * If an input can't be signed, a Failure packet is sent to the host and
+  * no signature records should be sent.
+  * \return true on success, false if an input couldn't be signed.
+  */
 bool getSignaturesCallback(void)
 {
 	uint32_t i;
-	const uint8_t ecdsa_length = 33;
+	WalletErrors r;
+
+	// Make sure signatures from a previous transaction are never resent.
+	for (i = 0; i < MAX_SIGNED_INPUTS; i++)
+	{
+		message_buffer_for_sigs[i].signature_data_complete.size = 0;
+	}
 
 	char ah_index_txt[16];
 	sprintf(ah_index_txt,"%lu", (unsigned long)ahIndex);
@@ -1476,74 +1743,85 @@ bool getSignaturesCallback(void)
 		char i_index_txt[16];
 		sprintf(i_index_txt,"%lu", (unsigned long)i+1);
 
-		initDisplay();
-		writeEinkNoDisplaySingleBig(i_index_txt,17,30);
-		writeEinkNoDisplaySingleBig("/",49,30);
-		writeEinkNoDisplaySingleBig(ah_index_txt,81,30);
-//		writeEinkDisplay("SIGNING INPUT", false, 5, 40, i_index_txt,false,117,40, "of",false,133,40, ah_index_txt,false,157,40, "",false,0,0);
-		display();
-
-		uint8_t private_key[32] = {};
-		uint8_t signature_temp_holding[MAX_SIGNATURE_LENGTH] = {};
-		uint8_t ecdsa_address[33] = {};
-//		uint8_t ecdsa_address[33] = {0x02,0x37,0x11,0x66,0x37,0x83,0xd0,0x8a,0x8e,0xdc,0x7d,0x80,0x41,0x99,0xe4,0xc8,0xda,0x5d,0xbe,0x91,0xda,0xbe,0x8b,0x75,0x6e,0x61,0x2d,0xb4,0xed,0x9c,0x4f,0x3b,0x50};
-		uint8_t message_builder[109] = {};
-		uint8_t signature_length = 0;
-		uint8_t total_length = 0;
-		uint8_t padding_size = 0;
-		uint8_t ecdsa_begin;
-		uint8_t j;
-		uint8_t k;
-		uint8_t m;
-		uint8_t ecdsa_end;
-
-
-		if (getPrivateKeyExtended(private_key, globalHandles[i].address_handle_root, globalHandles[i].address_handle_chain, globalHandles[i].address_handle_index) == WALLET_NO_ERROR)
-//		if (1)
+		// Screen refreshes are slow compared to signing, so only update the
+		// progress counter every so often.
+		if (displayProgressDue(i == 0, (i + 1) == ahIndex))
 		{
-			if (signTransaction(signature_temp_holding, &signature_length, sig_hash_global[i], private_key, true))
-//			if (signTransaction(signature_temp_holding, &signature_length, sig_hash_global[i], static_private_key, true))
-			{
-				translateWalletError(WALLET_RNG_FAILURE);
-			}
-			else
-			{
-//				set to static for testing purposes
-
-				getPublicKeyOnly(ecdsa_address, globalHandles[i].address_handle_root, globalHandles[i].address_handle_chain, globalHandles[i].address_handle_index);
+			initDisplay();
+			writeEinkNoDisplaySingleBig(i_index_txt,17,30);
+			writeEinkNoDisplaySingleBig("/",49,30);
+			writeEinkNoDisplaySingleBig(ah_index_txt,81,30);
+//			writeEinkDisplay("SIGNING INPUT", false, 5, 40, i_index_txt,false,117,40, "of",false,133,40, ah_index_txt,false,157,40, "",false,0,0);
+			display();
+		}
 
-				total_length = signature_length + ecdsa_length + 2;
-				padding_size = 109 - total_length;
+		r = buildSignatureData(message_buffer_for_sigs[i].signature_data_complete.bytes, i, sig_hash_global[i]);
+		if (r != WALLET_NO_ERROR)
+		{
+			translateWalletError(r);
+			prev_transaction_hash_valid = false;
+			return false;
+		}
+		message_buffer_for_sigs[i].signature_data_complete.size = SIGNATURE_DATA_LENGTH;
+	}
+	return true;
+}
 
-//				The following should ALWAYS be 109 bytes
-				message_builder[0] = total_length;
-				message_builder[1] = signature_length;
 
-				for (j=0; j < signature_length; j++)
-				{
-					message_builder[2+j] = signature_temp_holding[j];
-				}
-//				now at 1+j in the message
-				ecdsa_begin = 2 + signature_length;
-				message_builder[ecdsa_begin] = ecdsa_length;
-				for (k=0; k < ecdsa_length; k++)
-				{
-					message_builder[ecdsa_begin+1+k] = ecdsa_address[k];
-				}
-				ecdsa_end = ecdsa_begin+1+k;
-				for (m=0; m < padding_size; m++)
-				{
-					message_builder[ecdsa_end + 1 + m] = 0;
-				}
+/** Sign one input and build the fixed-size record which is sent back to
+  * the host: total length, signature length, DER signature (including
+  * hash type), public key length, compressed public key, then zero padding.
+  * \param message_builder The record will be written here. This must have
+  *                        space for #SIGNATURE_DATA_LENGTH bytes.
+  * \param i Index into #globalHandles of the address handle to sign with.
+  * \param sig_hash The signature hash of the input.
+  * \return #WALLET_NO_ERROR on success, or one of #WalletErrorsEnum if the
+  *         input could not be signed. Nothing is sent to the host either
+  *         way; that is up to the caller.
+  */
+static WalletErrors buildSignatureData(uint8_t *message_builder, uint32_t i, BigNum256 sig_hash)
+{
+	const uint8_t ecdsa_length = 33;
+	uint8_t private_key[32] = {};
+	uint8_t signature_temp_holding[MAX_SIGNATURE_LENGTH] = {};
+	uint8_t ecdsa_address[33] = {};
+	uint8_t signature_length = 0;
+	uint8_t total_length = 0;
+	uint8_t ecdsa_begin;
+	uint8_t j;
+	WalletErrors r;
 
-				message_buffer_for_sigs[i].signature_data_complete.size = sizeof(message_builder)*sizeof(uint8_t);
-				memcpy(message_buffer_for_sigs[i].signature_data_complete.bytes, message_builder, sizeof(message_builder)*sizeof(uint8_t));
+	memset(message_builder, 0, SIGNATURE_DATA_LENGTH);
+	r = getPrivateKeyExtended(private_key, globalHandles[i].address_handle_root, globalHandles[i].address_handle_chain, globalHandles[i].address_handle_index);
+	if (r != WALLET_NO_ERROR)
+	{
+		memset(private_key, 0, sizeof(private_key));
+		return r;
+	}
+	if (signTransaction(signature_temp_holding, &signature_length, sig_hash, private_key, true))
+	{
+		memset(private_key, 0, sizeof(private_key));
+		return WALLET_RNG_FAILURE;
+	}
+	memset(private_key, 0, sizeof(private_key));
 
-			}
-		}
+	getPublicKeyOnly(ecdsa_address, globalHandles[i].address_handle_root, globalHandles[i].address_handle_chain, globalHandles[i].address_handle_index);
 
+	total_length = signature_length + ecdsa_length + 2;
+	message_builder[0] = total_length;
+	message_builder[1] = signature_length;
+	for (j = 0; j < signature_length; j++)
+	{
+		message_builder[2 + j] = signature_temp_holding[j];
 	}
-	return true;
+	ecdsa_begin = 2 + signature_length;
+	message_builder[ecdsa_begin] = ecdsa_length;
+	for (j = 0; j < ecdsa_length; j++)
+	{
+		message_builder[ecdsa_begin + 1 + j] = ecdsa_address[j];
+	}
+	// The rest of message_builder is padding, which was zeroed above.
+	return WALLET_NO_ERROR;
 }
 
 
@@ -1891,26 +2169,31 @@ void getAddressOnly(uint8_t *out_address3, AddressHandle ah_root3, AddressHandle
   */
 bool listWalletsCallback(pb_ostream_t *stream, const pb_field_t *field, void * const *arg)
 {
-	uint32_t versionLWC = 0;
-	uint32_t i, k;
-	uint32_t j = 0;
+	uint32_t version;
+	uint32_t i;
 	WalletInfo message_buffer;
-	WalletInfo message_buffer_2[105] = {};
-
-//	writeEinkDisplayNumberSingleBig(number_of_wallets,5,40);
 
 	for (i = 0; i < number_of_wallets; i++)
 	{
+		// Use the wallet directory to skip empty slots, so that only the
+		// slots which actually contain a wallet need to be read.
+		if (getWalletSlotVersion(&version, i) != WALLET_NO_ERROR)
+		{
+			// It's too late to return an error message, so cut off the
+			// array now.
+			return true;
+		}
+		if ((version != VERSION_UNENCRYPTED) && (version != VERSION_IS_ENCRYPTED))
+		{
+			continue;
+		}
+
+		memset(&message_buffer, 0, sizeof(message_buffer));
 		message_buffer.wallet_number = i;
 		message_buffer.wallet_name.size = NAME_LENGTH;
 		message_buffer.wallet_uuid.size = DEVICE_UUID_LENGTH;
-		memcpy(message_buffer.wallet_uuid.bytes, 0, DEVICE_UUID_LENGTH);
-		memcpy(message_buffer.wallet_name.bytes, 0, NAME_LENGTH);
-		message_buffer.version = 0;
-		versionLWC = 0;
-
 		if (getWalletInfo(
-			&versionLWC,
+			&version,
 			message_buffer.wallet_name.bytes,
 			message_buffer.wallet_uuid.bytes,
 			i) != WALLET_NO_ERROR)
@@ -1919,32 +2202,19 @@ bool listWalletsCallback(pb_ostream_t *stream, const pb_field_t *field, void * c
 			// array now.
 			return true;
 		}
-		message_buffer.version = versionLWC;
-		message_buffer.has_version = true;
-
-		if (versionLWC != VERSION_NOTHING_THERE)
+		// The wallet directory can be out of date, so check again.
+		if ((version != VERSION_UNENCRYPTED) && (version != VERSION_IS_ENCRYPTED))
 		{
-			if (versionLWC == VERSION_UNENCRYPTED || versionLWC == VERSION_IS_ENCRYPTED)
-			{
-				message_buffer_2[j].wallet_number = message_buffer.wallet_number;
-				message_buffer_2[j].wallet_name.size = NAME_LENGTH;
-				message_buffer_2[j].wallet_uuid.size = DEVICE_UUID_LENGTH;
-				message_buffer_2[j].version = message_buffer.version;
-				message_buffer_2[j].has_version = message_buffer.has_version;
-				memcpy(message_buffer_2[j].wallet_name.bytes, message_buffer.wallet_name.bytes, NAME_LENGTH);
-				memcpy(message_buffer_2[j].wallet_uuid.bytes, message_buffer.wallet_uuid.bytes, DEVICE_UUID_LENGTH);
-				j++;
-			}
+			continue;
 		}
-	}
+		message_buffer.version = version;
+		message_buffer.has_version = true;
 
-	for(k = 0; k < j; k++)
-	{
 		if (!pb_encode_tag_for_field(stream, field))
 		{
 			return false;
 		}
-		if (!pb_encode_submessage(stream, WalletInfo_fields, &message_buffer_2[k]))
+		if (!pb_encode_submessage(stream, WalletInfo_fields, &message_buffer))
 		{
 			return false;
 		}
@@ -1963,29 +2233,14 @@ uint32_t countExistingWallets(void)
 {
 	uint32_t version;
 	uint32_t i;
-	WalletInfo message_buffer_temp;
-
 	uint32_t countedWallets = 0;
 
-	for (i = 0; i < number_of_wallets; i++)
+	for (i = 0; i < getNumberOfWallets(); i++)
 	{
-		message_buffer_temp.wallet_number = i;
-		message_buffer_temp.wallet_name.size = NAME_LENGTH;
-		message_buffer_temp.wallet_uuid.size = DEVICE_UUID_LENGTH;
-
-		if (getWalletInfo(
-			&version,
-			message_buffer_temp.wallet_name.bytes,
-			message_buffer_temp.wallet_uuid.bytes,
-			i) != WALLET_NO_ERROR)
+		if (getWalletSlotVersion(&version, i) != WALLET_NO_ERROR)
 		{
-			// It's too late to return an error message, so cut off the
-			// array now.
-//			return 0;
+			break;
 		}
-		message_buffer_temp.version = version;
-		message_buffer_temp.has_version = true;
-
 		if (version != VERSION_NOTHING_THERE)
 		{
 			countedWallets++;
@@ -2002,34 +2257,17 @@ uint32_t countExistingWallets(void)
 bool checkWalletSlotIsNotEmpty(uint32_t slotToCheck)
 {
 	uint32_t version;
-	WalletInfo message_buffer_temp;
-
-	message_buffer_temp.wallet_number = slotToCheck;
-	message_buffer_temp.wallet_name.size = NAME_LENGTH;
-	message_buffer_temp.wallet_uuid.size = DEVICE_UUID_LENGTH;
 
-	if (getWalletInfo(
-		&version,
-		message_buffer_temp.wallet_name.bytes,
-		message_buffer_temp.wallet_uuid.bytes,
-		slotToCheck) != WALLET_NO_ERROR)
+	if (getWalletSlotVersion(&version, slotToCheck) != WALLET_NO_ERROR)
 	{
-		// It's too late to return an error message, so cut off the
-		// array now.
+		// Just in case, as we never want to overwrite by mistake
 		return true;
 	}
-	message_buffer_temp.version = version;
-	message_buffer_temp.has_version = true;
-
 	if (version != VERSION_NOTHING_THERE)
 	{
 		return true;
-	}else if(version == VERSION_NOTHING_THERE)
-	{
-		return false;
 	}
-	// Just in case, as we never want to overwrite by mistake
-	return true;
+	return false;
 }
 
 /** nanopb field callback which will write out the contents
@@ -2062,8 +2300,8 @@ bool getEntropyCallback(pb_ostream_t *stream, const pb_field_t *field, void * co
 static NOINLINE void getBytesOfEntropy(uint32_t num_bytes)
 {
 	Entropy message_buffer;
-	unsigned int random_bytes_index;
-	uint8_t random_bytes[20480]; // must be multiple of 32 bytes large. Default:1024
+	RandomSession session;
+	uint8_t random_bytes[20480];
 
 	if (num_bytes > sizeof(random_bytes))
 	{
@@ -2071,25 +2309,19 @@ static NOINLINE void getBytesOfEntropy(uint32_t num_bytes)
 		return;
 	}
 
-	// All bytes of entropy must be collected before anything can be sent.
-	// This is because it is only safe to send those bytes if every call
-	// to getRandom256() succeeded.
-	random_bytes_index = 0;
+	// All bytes of entropy are collected before anything is sent, from a
+	// single session. Only beginning the session can fail, and it touches
+	// the HWRNG and the persistent entropy pool once, however many bytes
+	// were requested.
 	num_entropy_bytes = 0;
-	while (num_bytes--)
+	if (randomSessionBegin(&session))
 	{
-		if (random_bytes_index == 0)
-		{
-			if (getRandom256(&(random_bytes[num_entropy_bytes])))
-			{
-				translateWalletError(WALLET_RNG_FAILURE);
-				return;
-			}
-		}
-		num_entropy_bytes++;
-		random_bytes_index++;
-		random_bytes_index &= 31;
+		translateWalletError(WALLET_RNG_FAILURE);
+		return;
 	}
+	randomSessionGetBytes(&session, random_bytes, num_bytes);
+	randomSessionEnd(&session);
+	num_entropy_bytes = num_bytes;
 	message_buffer.entropy.funcs.encode = &getEntropyCallback;
 	entropy_buffer = random_bytes;
 	sendPacket(PACKET_TYPE_ENTROPY, Entropy_fields, &message_buffer);
@@ -2098,88 +2330,166 @@ static NOINLINE void getBytesOfEntropy(uint32_t num_bytes)
 	writeEinkDisplay(">entropy sent", false, 10, 10, "",false,0,0, "",false,0,0, "",false,0,0, "",false,0,0);
 }
 
-/** nanopb field callback which will write out the contents
-  * of #entropy_buffer.
+/** Key used for both the tweak and the encryption of wallet space backups
+  * (GetBulk and SetBulk). */
+static const uint8_t bulk_key[16] = {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1};
+
+/** Encrypt or decrypt a chunk of a wallet space backup in place. Every
+  * 16 byte block is encrypted with the same tweak, so chunks can be
+  * processed independently.
+  * \param ctx XEX context initialised with #bulk_key.
+  * \param buffer The chunk to encrypt or decrypt.
+  * \param length Length of the chunk, in bytes. This must be a multiple
+  *               of 16.
+  * \param is_decrypt To decrypt, use true. To encrypt, use false.
+  */
+static void bulkCryptChunk(XexContext *ctx, uint8_t *buffer, uint32_t length, bool is_decrypt)
+{
+	uint8_t block[16];
+	uint8_t n[16];
+	uint32_t i;
+
+	memset(n, 32, 16);
+	for (i = 0; i < length; i += 16)
+	{
+		if (is_decrypt)
+		{
+			xexDecryptWithContext(ctx, block, &(buffer[i]), n, 1);
+		}
+		else
+		{
+			xexEncryptWithContext(ctx, block, &(buffer[i]), n, 1);
+		}
+		memcpy(&(buffer[i]), block, 16);
+	}
+	memset(block, 0, sizeof(block));
+}
+
+/** nanopb field callback which streams out the encrypted wallet space. It
+  * is read from non-volatile storage, encrypted and written to the stream
+  * #BULK_CHUNK_SIZE bytes at a time, so RAM usage doesn't depend on the
+  * size of the wallet space.
   * \param stream Output stream to write to.
-  * \param field Field which contains the the entropy bytes.
+  * \param field Field which contains the the wallet space.
   * \param arg Unused.
   * \return true on success, false on failure (nanopb convention).
   */
 bool getBulkCallback(pb_ostream_t *stream, const pb_field_t *field, void * const *arg)
 {
-	if (bulk_buffer == NULL)
+	uint8_t chunk[BULK_CHUNK_SIZE];
+	XexContext ctx;
+	uint32_t size;
+	uint32_t offset;
+	uint32_t length;
+	bool r;
+
+	size = getWalletSpaceSize();
+	if (!pb_encode_tag_for_field(stream, field))
 	{
 		return false;
 	}
-	if (!pb_encode_tag_for_field(stream, field))
+	if (!pb_encode_varint(stream, size))
 	{
 		return false;
 	}
-	if (!pb_encode_string(stream, bulk_buffer, num_bulk_bytes))
+	xexInitContext(&ctx, bulk_key, bulk_key);
+	r = true;
+	for (offset = 0; offset < size; offset += length)
 	{
-		return false;
+		length = MIN(size - offset, sizeof(chunk));
+		if (!packetTxDiscarding(stream))
+		{
+			if (readWalletSpace(chunk, offset, length) != WALLET_NO_ERROR)
+			{
+				r = false;
+				break;
+			}
+			bulkCryptChunk(&ctx, chunk, length, false);
+		}
+		if (!pb_write(stream, chunk, length))
+		{
+			r = false;
+			break;
+		}
 	}
-	return true;
+	xexClearContext(&ctx);
+	memset(chunk, 0, sizeof(chunk));
+	return r;
 }
 
+/** nanopb field callback which restores the wallet space from an encrypted
+  * backup. The backup is read from the stream, decrypted and written to
+  * non-volatile storage #BULK_CHUNK_SIZE bytes at a time.
+  *
+  * Nothing is written unless the backup is exactly the size of the wallet
+  * space. If anything goes wrong after writing has started (including the
+  * rest of the message failing to decode), the caller must use
+  * abortWalletSpaceWrite() so that a partially restored wallet space is
+  * never committed.
+  * \param stream Input stream to read from.
+  * \param field Field which contains the the wallet space.
+  * \param arg Unused.
+  * \return true on success, false on failure (nanopb convention).
+  */
+bool setBulkCallback(pb_istream_t *stream, const pb_field_t *field, void **arg)
+{
+	uint8_t chunk[BULK_CHUNK_SIZE];
+	XexContext ctx;
+	uint32_t size;
+	uint32_t offset;
+	uint32_t length;
+	bool r;
 
+	size = getWalletSpaceSize();
+	if (stream->bytes_left != size)
+	{
+		return false;
+	}
+	if (beginWalletSpaceWrite() != WALLET_NO_ERROR)
+	{
+		return false;
+	}
+	xexInitContext(&ctx, bulk_key, bulk_key);
+	r = true;
+	for (offset = 0; offset < size; offset += length)
+	{
+		length = MIN(size - offset, sizeof(chunk));
+		if (!pb_read(stream, chunk, length))
+		{
+			r = false;
+			break;
+		}
+		bulkCryptChunk(&ctx, chunk, length, true);
+		if (writeWalletSpace(chunk, offset, length) != WALLET_NO_ERROR)
+		{
+			r = false;
+			break;
+		}
+	}
+	xexClearContext(&ctx);
+	memset(chunk, 0, sizeof(chunk));
+	return r;
+}
 
-/** Return bytes of entropy from the random number generation system.
-  * \param num_bytes Number of bytes of entropy to send to stream.
+/** Send the entire wallet space (see getWalletSpaceSize()), encrypted, to
+  * the host as a Bulk message.
   */
 void getBytesOfBulk(void) // was static NOINLINE
 {
 	Bulk message_buffer;
-	unsigned int bulk_bytes_index;
-	uint8_t bulk_bytes[EEPROM_SIZE]; // must be multiple of 32 bytes large. Default:1024
-
-	num_bulk_bytes = readEntireWalletSpace(bulk_bytes);
-
-	uint8_t encrypty[16]={1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1};
 
-	encryptStream(bulk_bytes, encrypty);
+	if (uninitWallet() != WALLET_NO_ERROR)
+	{
+		writeEinkDisplay(">unload error", false, 10, 10, "",false,0,0, "",false,0,0, "",false,0,0, "",false,0,0);
+	}
+	writeEinkDisplay(">wallet data sending", false, 10, 10, "",false,0,0, "",false,0,0, "",false,0,0, "",false,0,0);
 
 	message_buffer.bulk.funcs.encode = &getBulkCallback;
-	bulk_buffer = bulk_bytes;
+	message_buffer.bulk.arg = NULL;
 	sendPacket(PACKET_TYPE_BULK, Bulk_fields, &message_buffer);
-	num_bulk_bytes = 0;
-	bulk_buffer = NULL;
 	writeEinkDisplay(">data sent", false, 10, 10, "READY TO FLASH",false,10,40, "",false,0,0, "",false,0,0, "",false,0,0);
 }
 
-void encryptStream(uint8_t *plaintext, uint8_t *key)
-{
-	writeEinkDisplay(">encrypting", false, 10, 10, "",false,0,0, "",false,0,0, "",false,0,0, "",false,0,0);
-
-	uint8_t ciphertext_chunk[16] = {};
-	uint8_t plaintext_chunk[16] = {};
-
-	uint8_t tweaky[16]={1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1};
-//	uint8_t encrypty[16]={3,1,4,1,5,9,3,1,4,1,5,9,3,1,4,1};
-	uint8_t n[16];
-	memset(n, 32, 16);
-	uint8_t seq_param = 1;
-	uint32_t i, j;
-
-
-	for(i=0;i<num_bulk_bytes;i=i+16)
-	{
-//		writeEinkDisplayNumberSingleBig(i,5,5);
-		for(j=0;j<16; j++)
-		{
-			plaintext_chunk[j] = plaintext[i+j];
-//			writeEinkDisplayNumberSingleBig(j,5,5);
-		}
-		xexEncryptTweaked(ciphertext_chunk, plaintext_chunk, n, seq_param, tweaky, key);
-		for(j=0;j<16; j++)
-		{
-			plaintext[i+j] = ciphertext_chunk[j];
-//			writeEinkDisplayNumberSingleBig(j,5,25);
-		}
-	}
-//	displayHexStream(outie, 16);
-}
-
 void encryptStreamSized(uint8_t *plaintext, uint8_t *key, uint32_t size)
 {
 	writeEinkDisplay(">encrypting", false, 10, 10, "",false,0,0, "",false,0,0, "",false,0,0, "",false,0,0);
@@ -2193,6 +2503,9 @@ void encryptStreamSized(uint8_t *plaintext, uint8_t *key, uint32_t size)
 	memset(n, 32, 16);
 	uint8_t seq_param = 1;
 	uint32_t i, j;
+	XexContext ctx;
+
+	xexInitContext(&ctx, tweaky, key);
 
 
 	for(i=0;i<size;i=i+16)
@@ -2203,46 +2516,14 @@ void encryptStreamSized(uint8_t *plaintext, uint8_t *key, uint32_t size)
 			plaintext_chunk[j] = plaintext[i+j];
 //			writeEinkDisplayNumberSingleBig(j,5,5);
 		}
-		xexEncryptTweaked(ciphertext_chunk, plaintext_chunk, n, seq_param, tweaky, key);
+		xexEncryptWithContext(&ctx, ciphertext_chunk, plaintext_chunk, n, seq_param);
 		for(j=0;j<16; j++)
 		{
 			plaintext[i+j] = ciphertext_chunk[j];
 //			writeEinkDisplayNumberSingleBig(j,5,25);
 		}
 	}
-//	displayHexStream(outie, 16);
-}
-
-void decryptStream(uint8_t *ciphertext, uint8_t *key)
-{
-	writeEinkDisplay(">decrypting", false, 10, 10, "",false,0,0, "",false,0,0, "",false,0,0, "",false,0,0);
-
-	uint8_t ciphertext_chunk[16] = {};
-	uint8_t plaintext_chunk[16] = {};
-
-	uint8_t tweaky[16]={1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1};
-//	uint8_t encrypty[16]={1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1};
-	uint8_t n[16];
-	memset(n, 32, 16);
-	uint8_t seq_param = 1;
-	uint32_t i, j;
-
-	for(i=0;i<EEPROM_SIZE;i=i+16)
-	{
-//		writeEinkDisplayNumberSingleBig(i,5,5);
-		for(j=0;j<16; j++)
-		{
-			ciphertext_chunk[j] = ciphertext[i+j];
-//			writeEinkDisplayNumberSingleBig(j,5,5);
-		}
-		xexDecryptTweaked(plaintext_chunk, ciphertext_chunk, n, seq_param, tweaky, key);
-//		displayHexStream(plaintext_chunk, 16);
-		for(j=0;j<16; j++)
-		{
-			ciphertext[i+j] = plaintext_chunk[j];
-//			writeEinkDisplayNumberSingleBig(j,5,25);
-		}
-	}
+	xexClearContext(&ctx);
 //	displayHexStream(outie, 16);
 }
 
@@ -2259,6 +2540,9 @@ void decryptStreamSized(uint8_t *ciphertext, uint8_t *key, uint32_t size)
 	memset(n, 32, 16);
 	uint8_t seq_param = 1;
 	uint32_t i, j;
+	XexContext ctx;
+
+	xexInitContext(&ctx, tweaky, key);
 
 	for(i=0;i<size;i=i+16)
 	{
@@ -2268,7 +2552,7 @@ void decryptStreamSized(uint8_t *ciphertext, uint8_t *key, uint32_t size)
 			ciphertext_chunk[j] = ciphertext[i+j];
 //			writeEinkDisplayNumberSingleBig(j,5,5);
 		}
-		xexDecryptTweaked(plaintext_chunk, ciphertext_chunk, n, seq_param, tweaky, key);
+		xexDecryptWithContext(&ctx, plaintext_chunk, ciphertext_chunk, n, seq_param);
 //		displayHexStream(plaintext_chunk, 16);
 		for(j=0;j<16; j++)
 		{
@@ -2276,6 +2560,7 @@ void decryptStreamSized(uint8_t *ciphertext, uint8_t *key, uint32_t size)
 //			writeEinkDisplayNumberSingleBig(j,5,25);
 		}
 	}
+	xexClearContext(&ctx);
 //	displayHexStream(outie, 16);
 }
 
@@ -2409,6 +2694,27 @@ bool hashFieldCallbackGeneric(pb_istream_t *stream, uint8_t *theHash, uint8_t *t
 //}
 
 
+/** Language which showFormatProgress() displays its progress screen in. */
+static int format_progress_lang;
+
+/** Progress callback for sanitiseNonVolatileStorage() when formatting. The
+  * progress screen only differs in the percentage, so each update is a
+  * partial refresh of that line (see display()), and updates are rate-limited
+  * by displayProgressDue().
+  * \param percent See #SanitiseProgressFunction.
+  */
+static void showFormatProgress(uint8_t percent)
+{
+	char percent_text[4];
+
+	// 75% is reported at the start of the last pass.
+	if (displayProgressDue(percent == 0, percent >= 75))
+	{
+		sprintf(percent_text, "%u", (unsigned int)percent);
+		buttonInterjectionNoAckPlusData(ASKUSER_FORMAT_WITH_PROGRESS, percent_text, format_progress_lang);
+	}
+}
+
 //All timers must be stopped before formatting
 bool initialFormatAuto(void)
 {
@@ -2448,13 +2754,15 @@ bool initialFormatAuto(void)
 			}
 			else
 			{
-				wallet_return = sanitiseNonVolatileStorage(0, 0xffffffff, false, tempLang);
+				format_progress_lang = tempLang;
+				wallet_return = sanitiseNonVolatileStorage(0, 0xffffffff, showFormatProgress);
 				translateWalletError(wallet_return);
 				uninitWallet(); // force wallet to unload
 				int s = 123;
 				uint8_t temp1[1];
 				temp1[0] = s;
 				nonVolatileWrite(temp1, IS_FORMATTED_ADDRESS, 1);
+				nonVolatileFlush();
 				is_formatted = s;
 			}
 	}
@@ -2468,6 +2776,7 @@ bool initialFormatAuto(void)
 	nonVolatileWrite(countHold, WRONG_TRANSACTION_PIN_COUNT_ADDRESS, 1);
 	nonVolatileWrite(aem_use_Hold, AEM_USE_ADDRESS, 1);
 	nonVolatileWrite(aem_phrase_Hold, AEM_PHRASE_ADDRESS, 64);
+	nonVolatileFlush();
 
 
 	if (!permission_denied)
@@ -2485,7 +2794,7 @@ bool initialFormatAutoDuress(void)
 {
 //	uint8_t entropy_initialation[32] = {66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66};
 
-	sanitiseNonVolatileStorage(0, 0xffffffff, true, 0);
+	sanitiseNonVolatileStorage(0, 0xffffffff, NULL);
 
 	return true;
 }
@@ -2661,6 +2970,7 @@ void setChangeAddress(AddressHandle ah_root5, AddressHandle ah_chain5, AddressHa
 	WalletErrors wallet_return;
 	char ping_greeting[sizeof(message_buffer.ping.greeting)];
 	bool has_ping_greeting;
+	uint32_t transmit_window;
 	int lang;
 	bool use_seed;
 //	uint8_t testSeed[] = {};
@@ -2708,6 +3018,8 @@ void setChangeAddress(AddressHandle ah_root5, AddressHandle ah_chain5, AddressHa
 	case PACKET_TYPE_INITIALIZE:
 		// Reset state and report features.
 		session_id_length = 0; // just in case receiveMessage() fails
+		chunked_framing_enabled = false;
+		usartSetTransmitWindow(0);
 		receive_failure = receiveMessage(Initialize_fields, &(message_buffer.initialize));
 		if (!receive_failure)
 		{
@@ -2717,6 +3029,15 @@ void setChangeAddress(AddressHandle ah_root5, AddressHandle ah_chain5, AddressHa
 				fatalError(); // sanity check failed
 			}
 			memcpy(session_id, message_buffer.initialize.session_id.bytes, session_id_length);
+			if (message_buffer.initialize.has_chunked_framing)
+			{
+				chunked_framing_enabled = message_buffer.initialize.chunked_framing;
+			}
+			transmit_window = 0;
+			if (message_buffer.initialize.has_transmit_window)
+			{
+				transmit_window = message_buffer.initialize.transmit_window;
+			}
 			prev_transaction_hash_valid = false;
 //			sanitiseRam();   // this function is useless
 			wallet_return = uninitWallet();
@@ -2763,6 +3084,10 @@ void setChangeAddress(AddressHandle ah_root5, AddressHandle ah_chain5, AddressHa
 				message_buffer.features.has_device_name = true;
 				message_buffer.features.device_name.size = sizeof(name_temp);
 				memcpy(message_buffer.features.device_name.bytes, name_temp, sizeof(name_temp));
+				message_buffer.features.has_chunked_framing = true;
+				message_buffer.features.chunked_framing = chunked_framing_enabled;
+				message_buffer.features.has_transmit_window = true;
+				message_buffer.features.transmit_window = usartSetTransmitWindow(transmit_window);
 //				writeEinkDisplay("BITLOX READY", false, 5, 5, "Multi Input", false, 5, 20, "BL_24:SB UNI QR",false,5,35, "BIP39.32HD.BLE.protoBuf",false,5,50, "Eink-opt.8192.fmtTgl",false,5,65);
 
 				sendPacket(PACKET_TYPE_FEATURES, Features_fields, &(message_buffer.features));
@@ -2868,6 +3193,16 @@ void setChangeAddress(AddressHandle ah_root5, AddressHandle ah_chain5, AddressHa
 		break;
 
 
+	case PACKET_TYPE_SIGN_TRANSACTION_STREAMING:
+		// Sign one window of inputs of a transaction.
+		ahIndex = 0;
+		sign_transaction_streaming.address_handle_extended.funcs.decode = &read_AHE_data;
+		sign_transaction_streaming.transaction_data.funcs.decode = &signTransactionStreamingCallback;
+		// Everything else is handled in signTransactionStreamingCallback().
+		receiveMessage(SignTransactionStreaming_fields, &sign_transaction_streaming);
+		break;
+
+
 	case PACKET_TYPE_SIGN_MESSAGE:
 		// Sign a message.
 		sign_message.message_data.funcs.decode = &signMessageCallback;
@@ -2973,6 +3308,7 @@ void setChangeAddress(AddressHandle ah_root5, AddressHandle ah_chain5, AddressHa
 						if(walletLoadAttemptsCounter == delayThreshold)
 						{
 							nonVolatileWrite(delayJumpTemp, WRONG_DEVICE_PIN_COUNT_ADDRESS, 1);
+							nonVolatileFlush();
 							Software_Reset();
 						}
 					}
@@ -3032,13 +3368,15 @@ void setChangeAddress(AddressHandle ah_root5, AddressHandle ah_chain5, AddressHa
 					else
 					{
 //						writeEinkDisplay("pre sanitise", false, COL_1_X, LINE_1_Y, "",false,5,30, "",false,5,50, "",false,5,70, "",false,0,0);
-						wallet_return = sanitiseNonVolatileStorage(0, 0xffffffff, false, (int)langHold[0]);
+						format_progress_lang = (int)langHold[0];
+						wallet_return = sanitiseNonVolatileStorage(0, 0xffffffff, showFormatProgress);
 						translateWalletError(wallet_return);
 						uninitWallet(); // force wallet to unload
 						int s = 123;
 						uint8_t temp1[1];
 						temp1[0] = s;
 						nonVolatileWrite(temp1, IS_FORMATTED_ADDRESS, 1);
+						nonVolatileFlush();
 						is_formatted = s;
 						showReady();
 					}
@@ -3069,6 +3407,7 @@ void setChangeAddress(AddressHandle ah_root5, AddressHandle ah_chain5, AddressHa
 			nonVolatileWrite(countHold, WRONG_TRANSACTION_PIN_COUNT_ADDRESS, 1);
 			nonVolatileWrite(aem_use_Hold, AEM_USE_ADDRESS, 1);
 			nonVolatileWrite(aem_phrase_Hold, AEM_PHRASE_ADDRESS, 64);
+			nonVolatileFlush();
 
 		}
 
@@ -3238,12 +3577,17 @@ void setChangeAddress(AddressHandle ah_root5, AddressHandle ah_chain5, AddressHa
 	case PACKET_TYPE_SET_BULK:
 //		writeEinkDisplay("got restore packet", false, 5, 40, "",false,0,10, "",false,0,60, "",false,0,0, "",false,0,0);
 		// Write the entire wallet storage space with a byte array
+		message_buffer.set_bulk.bulk.funcs.decode = &setBulkCallback;
+		message_buffer.set_bulk.bulk.arg = NULL;
 		receive_failure = receiveMessage(SetBulk_fields, &(message_buffer.set_bulk));
 		if (!receive_failure)
 		{
-			writeEntireWalletSpace(message_buffer.set_bulk.bulk.bytes);
+			finishWalletSpaceWrite();
 		}else{
 			writeEinkDisplay("restore packet malformed", false, 5, 40, "",false,0,10, "",false,0,60, "",false,0,0, "",false,0,0);
+			// If setBulkCallback() got as far as writing anything, the
+			// wallet space must not be left half-restored.
+			abortWalletSpaceWrite();
 		}
 		break;
 
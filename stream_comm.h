@@ -198,6 +198,14 @@
 
 #define PACKET_TYPE_SIGN_TRANSACTION_CHANGE_ADDRESS 		0x66
 
+/** Sign a window of inputs of a transaction, streaming back one signature
+  * per input as soon as it is ready. */
+#define PACKET_TYPE_SIGN_TRANSACTION_STREAMING		0x67
+
+/** SignatureStreamData (response to #PACKET_TYPE_SIGN_TRANSACTION_STREAMING).
+  * One of these is sent for each input in the window. */
+#define PACKET_TYPE_SIGNATURE_STREAM_DATA			0x68
+
 
 #define PACKET_TYPE_SIGN_MESSAGE 					0x70
 
@@ -235,9 +243,7 @@ bool pseudoPacketNewWallet(int strength, int level);
 bool pseudoPacketRestoreWallet(int strength, int level);
 void CharToByte(char* chars, byte* bytes, unsigned int count);
 void ByteToChar(byte* bytes, char* chars, unsigned int count);
-void decryptStream(uint8_t *ciphertext, uint8_t *key);
 void decryptStreamSized(uint8_t *ciphertext, uint8_t *key, uint32_t size);
-void encryptStream(uint8_t *plaintext, uint8_t *key);
 void encryptStreamSized(uint8_t *plaintext, uint8_t *key, uint32_t size);
 void getAddressOnly(uint8_t *out_address3, AddressHandle ah_root3, AddressHandle ah_chain3, AddressHandle ah_index3);
 
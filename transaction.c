@@ -21,6 +21,8 @@
 #endif // #ifdef TEST
 
 #ifdef TEST_TRANSACTION
+#include <string.h>
+#include <time.h>
 #include "test_helpers.h"
 #include "stream_comm.h"
 #include "wallet.h"
@@ -36,6 +38,7 @@
 #include "sha256.h"
 #include "bignum256.h"
 #include "prandom.h"
+#include "rfc6979.h"
 #include "hwinterface.h"
 #include "transaction.h"
 //#include "stream_comm.h"
@@ -94,16 +97,70 @@ static bool suppress_transaction_hash;
   * and #transaction_hash_hs_ptr from being written to if they don't point
   * to a valid hash state. */
 static bool hs_ptr_valid;
+/** If this is true, transaction contents are fed to the per-input signature
+  * hash engine (see sigHashWriteByte()). This is only true while parsing the
+  * spending transaction. */
 static bool sig_ptr_valid;
 
-/** Pointer to hash state used to calculate the signature
-  * hash (see parseTransaction() for what this is all about).
+/** Pointer to hash state used to calculate the hash of the entire
+  * transaction, including input scripts. For input transactions, this is the
+  * transaction ID, which is compared against the references in the spending
+  * transaction.
   * \warning If this does not point to a valid hash state structure, ensure
   *          that #hs_ptr_valid is false to
   *          stop getTransactionBytes() from attempting to dereference this.
   */
 static HashState *sig_hash_hs_ptr;
-static HashState *sig_hash_hs_ptr_array[MAX_INPUTS];
+
+/**
+ * \defgroup SigHashEngine Signature hash engine.
+ *
+ * The signature hash of input i is the double SHA-256 of the spending
+ * transaction with every input script blanked out, except for the script of
+ * input i. So all the signature hashes are identical up to the point where
+ * the script of their input appears.
+ *
+ * Instead of feeding every byte to one hash state per input, everything up to
+ * the script of input i is hashed once, into #sig_hash_shared_hs_ptr. When
+ * the script of input i is reached, that shared state is forked (copied) into
+ * sig_hash_hs_ptr_array[i]; from then on the fork sees the real script while
+ * the shared state sees a blank one. Once every input has forked, the shared
+ * state is no longer needed and is retired.
+ *
+ * This only saves hashing the common prefix. Everything after the script of
+ * input i is still hashed separately by each fork, so legacy signing remains
+ * quadratic in the number of inputs. The benchmark in TEST_TRANSACTION
+ * measures it at about 1.5 times as fast as one hash per input, for 64
+ * inputs on an x86-64 host. Only BIP143 (see \ref Bip143Cache) is linear.
+ *
+ * @{
+ */
+/** Hash state which holds the signature hash of every input whose script
+  * has not been reached yet. */
+static HashState *sig_hash_shared_hs_ptr;
+/** Hash states of the inputs which have been forked off
+  * #sig_hash_shared_hs_ptr. Only the first #sig_hash_num_forks entries are
+  * live. */
+static HashState *sig_hash_hs_ptr_array[MAX_SIGNED_INPUTS];
+/** Number of live entries in #sig_hash_hs_ptr_array. */
+static uint32_t sig_hash_num_forks;
+/** Number of signature hashes the caller of parseTransaction() wants. */
+static uint32_t sig_hash_num_inputs;
+/** Index of the input whose signature hash goes into
+  * sig_hash_hs_ptr_array[0]. Inputs before this one, and inputs after the
+  * last one wanted, are not signed. */
+static uint32_t sig_hash_first_input;
+/** Whether an input script is currently being read. */
+static bool sig_hash_in_script;
+/** Index (into #sig_hash_hs_ptr_array) of the fork whose script is currently
+  * being read. While an input script is being read, only that input's fork
+  * sees the script bytes. If this is #NO_SCRIPT_INPUT, the script bytes are
+  * not hashed at all. */
+static uint32_t sig_hash_script_input;
+/** Value of #sig_hash_script_input which means that the script being read
+  * doesn't belong to any fork. */
+#define NO_SCRIPT_INPUT		0xFFFFFFFF
+/**@}*/
 
 /** Pointer to hash state used to calculate the transaction
   * hash (see parseTransaction() for what this is all about).
@@ -113,77 +170,331 @@ static HashState *sig_hash_hs_ptr_array[MAX_INPUTS];
   */
 static HashState *transaction_hash_hs_ptr;
 
-/** Get transaction data by reading from the stream device, checking that
-  * the read operation won't go beyond the end of the transaction data.
-  * 
-  * Since all transaction data is read using this function, the updating
-  * of #sig_hash_hs_ptr and #transaction_hash_hs_ptr is also done.
-  * \param buffer An array of bytes which will be filled with the transaction
-  *               data (if everything goes well). It must have space for
-  *               length bytes.
-  * \param length The number of bytes to read from the stream device.
-  * \return false on success, true if a stream read error occurred or if the
-  *         read would go beyond the end of the transaction data.
+/**
+ * \defgroup Bip143Cache BIP143 intermediate hashes.
+ *
+ * BIP143 defines a signature hash which doesn't involve hashing the whole
+ * transaction once per input. Instead, hashPrevouts (the hash of all the
+ * outpoints), hashSequence (the hash of all the sequence numbers) and
+ * hashOutputs (the hash of all the outputs) are computed once, while the
+ * spending transaction is being parsed. The signature hash of each input is
+ * then the double SHA-256 of a fixed-size preimage built from those cached
+ * hashes and a few per-input fields (see bip143SigHash()).
+ *
+ * The BIP143 preimage also contains the amount of the output being spent.
+ * That is taken from the input transactions, which are parsed before the
+ * spending transaction.
+ *
+ * @{
+ */
+/** Maximum length (in bytes, not including the length byte) of a script code
+  * which can be cached. This is enough for a pay to public key hash script. */
+#define BIP143_MAX_SCRIPT_CODE_LENGTH	25
+
+/** Per-input fields which go into the BIP143 signature hash preimage. */
+typedef struct Bip143InputStruct
+{
+	/** Transaction hash and output number of the output being spent. */
+	uint8_t outpoint[36];
+	/** Length of script_code, in bytes. */
+	uint8_t script_code_length;
+	/** The script code; this is what the host places in the input script
+	  * of the spending transaction. */
+	uint8_t script_code[BIP143_MAX_SCRIPT_CODE_LENGTH];
+	/** Amount of the output being spent, as a 64 bit little-endian
+	  * integer. */
+	uint8_t amount[8];
+	/** Sequence number of the input. */
+	uint8_t sequence[4];
+} Bip143Input;
+
+/** Whether parseTransaction() was asked for BIP143 signature hashes. */
+static bool bip143_enabled;
+/** Whether bytes read by getTransactionBytes() should go into
+  * #bip143_outputs_hs. This is only true while the outputs of the spending
+  * transaction are being read. */
+static bool bip143_hash_outputs;
+/** Hash state used to calculate hashPrevouts. */
+static HashState bip143_prevouts_hs;
+/** Hash state used to calculate hashSequence. */
+static HashState bip143_sequence_hs;
+/** Hash state used to calculate hashOutputs. */
+static HashState bip143_outputs_hs;
+/** Cached hashPrevouts, in the byte order it appears in the preimage. */
+static uint8_t bip143_hash_prevouts[32];
+/** Cached hashSequence, in the byte order it appears in the preimage. */
+static uint8_t bip143_hash_sequence[32];
+/** Cached hashOutputs, in the byte order it appears in the preimage. */
+static uint8_t bip143_hash_outputs_digest[32];
+/** Version of the spending transaction. */
+static uint8_t bip143_version[4];
+/** Locktime of the spending transaction. */
+static uint8_t bip143_locktime[4];
+/** Hash type of the spending transaction. */
+static uint8_t bip143_hash_type[4];
+/** Per-input fields of the spending transaction. This has space for
+  * #bip143_num_inputs entries. */
+static Bip143Input *bip143_inputs;
+/** Number of entries in #bip143_inputs. */
+static uint32_t bip143_num_inputs;
+/** Index of the input which goes into bip143_inputs[0]. */
+static uint32_t bip143_first_input;
+/** Number of input amounts which have been written to #bip143_inputs so
+  * far. */
+static uint32_t bip143_num_amounts;
+/**@}*/
+
+/** Reset the signature hash engine (see \ref SigHashEngine) for a new
+  * spending transaction.
+  * \param first_input The index of the first input whose signature hash is
+  *                    wanted.
+  * \param number_of_inputs The number of signature hashes wanted.
   */
-static bool getTransactionBytes(uint8_t *buffer, uint8_t length)
+static void sigHashBegin(uint32_t first_input, uint32_t number_of_inputs)
 {
-	uint8_t i;
-	uint8_t one_byte;
+	sig_hash_first_input = first_input;
+	sig_hash_num_inputs = number_of_inputs;
+	sig_hash_num_forks = 0;
+	sig_hash_in_script = false;
+	sig_hash_script_input = NO_SCRIPT_INPUT;
+	sha256Begin(sig_hash_shared_hs_ptr);
+}
 
-	if (transaction_data_index > (0xffffffff - (uint32_t)length))
+/** Write bytes of the spending transaction to the signature hash engine.
+  * Outside of input scripts, the bytes go to the shared state (if it's still
+  * needed) and every live fork. Inside the script of input i, the bytes only
+  * go to the fork of input i.
+  * \param data The bytes to write.
+  * \param length The number of bytes to write.
+  */
+static void sigHashWriteBytes(const uint8_t *data, uint32_t length)
+{
+	uint32_t j;
+
+	if (sig_hash_in_script)
 	{
-		// transaction_data_index + (uint32_t)length will overflow.
-		// Since transaction_length <= 0xffffffff, this implies that the read
-		// will go past the end of the transaction.
-		return true; // trying to read past end of transaction
+		if (sig_hash_script_input != NO_SCRIPT_INPUT)
+		{
+			sha256WriteBytes(sig_hash_hs_ptr_array[sig_hash_script_input], data, length);
+		}
+		return;
 	}
-	if (transaction_data_index + (uint32_t)length > transaction_length)
+	if (sig_hash_num_forks < sig_hash_num_inputs)
 	{
-		return true; // trying to read past end of transaction
+		sha256WriteBytes(sig_hash_shared_hs_ptr, data, length);
+	}
+	for (j = 0; j < sig_hash_num_forks; j++)
+	{
+		sha256WriteBytes(sig_hash_hs_ptr_array[j], data, length);
+	}
+}
+
+/** Write one byte of the spending transaction to the signature hash engine.
+  * See sigHashWriteBytes().
+  * \param one_byte The byte to write.
+  */
+static void sigHashWriteByte(uint8_t one_byte)
+{
+	sigHashWriteBytes(&one_byte, 1);
+}
+
+/** Mark the start of the script of an input of the spending transaction.
+  * The shared state is forked for that input, then everything else receives
+  * a blank (zero length) script. Until sigHashEndScript() is called, bytes
+  * written with sigHashWriteByte() will only go to the new fork.
+  * \param input The index of the input whose script is about to be read.
+  *              Inputs must be started in order.
+  */
+static void sigHashBeginScript(uint32_t input)
+{
+	if ((input < sig_hash_first_input)
+		|| ((input - sig_hash_first_input) != sig_hash_num_forks)
+		|| (sig_hash_num_forks >= sig_hash_num_inputs))
+	{
+		// The caller didn't ask for a signature hash for this input, so
+		// its script is blank for everyone.
+		sigHashWriteByte(0);
+		sig_hash_script_input = NO_SCRIPT_INPUT;
 	}
 	else
 	{
-		for (i = 0; i < length; i++)
-		{
-			one_byte = streamGetOneByte();
-			buffer[i] = one_byte;
-			if (hs_ptr_valid)
-			{
-				sha256WriteByte(sig_hash_hs_ptr, one_byte);
-				sha256WriteByte(sig_hash_hs_ptr_array[0], one_byte);
+		memcpy(sig_hash_hs_ptr_array[sig_hash_num_forks], sig_hash_shared_hs_ptr, sizeof(HashState));
+		sigHashWriteByte(0);
+		sig_hash_script_input = sig_hash_num_forks;
+		sig_hash_num_forks++;
+	}
+	sig_hash_in_script = true;
+}
 
-				if (!suppress_transaction_hash)
-				{
-					sha256WriteByte(transaction_hash_hs_ptr, one_byte);
-				}
-			}
-			transaction_data_index++;
-#ifdef DISPLAY_STREAM
-			bigBuffer[bigCounter] = one_byte;
-			bigCounter++;
-#endif
+/** Mark the end of the script of an input of the spending transaction.
+  * See sigHashBeginScript(). */
+static void sigHashEndScript(void)
+{
+	sig_hash_in_script = false;
+	sig_hash_script_input = NO_SCRIPT_INPUT;
+}
 
-		}
-		return false;
+/** Check whether every input of the window passed to sigHashBegin() was
+  * actually in the spending transaction.
+  * \return true if the whole window was seen, false if the window runs past
+  *         the last input of the transaction.
+  */
+static bool sigHashComplete(void)
+{
+	return sig_hash_num_forks == sig_hash_num_inputs;
+}
+
+/** Finish all the signature hashes. Every input of the window must have
+  * been forked; see sigHashComplete().
+  * \param sig_hash The signature hashes will be written here, as 32 byte
+  *                 little-endian multi-precision numbers.
+  */
+static void sigHashFinish(uint8_t sig_hash[][32])
+{
+	uint32_t m;
+
+	for (m = 0; m < sig_hash_num_inputs; m++)
+	{
+		sha256FinishDouble(sig_hash_hs_ptr_array[m]);
+		writeHashToByteArray(sig_hash[m], sig_hash_hs_ptr_array[m], false);
 	}
 }
-/** Get transaction data by reading from the stream device, checking that
-  * the read operation won't go beyond the end of the transaction data.
-  *
-  * Since all transaction data is read using this function, the updating
-  * of #sig_hash_hs_ptr and #transaction_hash_hs_ptr is also done.
-  * \param buffer An array of bytes which will be filled with the transaction
-  *               data (if everything goes well). It must have space for
-  *               length bytes.
-  * \param length The number of bytes to read from the stream device.
-  * \return false on success, true if a stream read error occurred or if the
-  *         read would go beyond the end of the transaction data.
+
+/** Reset the BIP143 intermediate hashes (see \ref Bip143Cache) for a new
+  * spending transaction. */
+static void bip143Begin(void)
+{
+	sha256Begin(&bip143_prevouts_hs);
+	sha256Begin(&bip143_sequence_hs);
+	sha256Begin(&bip143_outputs_hs);
+	bip143_hash_outputs = false;
+}
+
+/** Find where the per-input fields of an input of the spending transaction
+  * are cached.
+  * \param input The index of the input.
+  * \return The cached fields, or NULL if that input isn't being signed.
+  */
+static Bip143Input *bip143GetInput(uint32_t input)
+{
+	if ((input < bip143_first_input) || ((input - bip143_first_input) >= bip143_num_inputs))
+	{
+		return NULL;
+	}
+	return &(bip143_inputs[input - bip143_first_input]);
+}
+
+/** Record the amount of the output that one input of the spending
+  * transaction spends. This should be called once for each input
+  * transaction, in the same order as the inputs of the spending transaction.
+  * \param amount The amount, as a 64 bit little-endian integer.
+  */
+static void bip143WriteAmount(uint8_t *amount)
+{
+	Bip143Input *in;
+
+	in = bip143GetInput(bip143_num_amounts);
+	if (in != NULL)
+	{
+		memcpy(in->amount, amount, 8);
+	}
+	bip143_num_amounts++;
+}
+
+/** Write the outpoint of one input of the spending transaction.
+  * \param input The index of the input.
+  * \param hash The 32 byte transaction hash of the outpoint.
+  * \param output_number The 4 byte output number of the outpoint.
+  */
+static void bip143WriteOutpoint(uint32_t input, uint8_t *hash, uint8_t *output_number)
+{
+	Bip143Input *in;
+
+	sha256WriteBytes(&bip143_prevouts_hs, hash, 32);
+	sha256WriteBytes(&bip143_prevouts_hs, output_number, 4);
+	in = bip143GetInput(input);
+	if (in != NULL)
+	{
+		memcpy(in->outpoint, hash, 32);
+		memcpy(&(in->outpoint[32]), output_number, 4);
+	}
+}
+
+/** Write the sequence number of one input of the spending transaction.
+  * \param input The index of the input.
+  * \param sequence The 4 byte sequence number.
   */
+static void bip143WriteSequence(uint32_t input, uint8_t *sequence)
+{
+	Bip143Input *in;
+
+	sha256WriteBytes(&bip143_sequence_hs, sequence, 4);
+	in = bip143GetInput(input);
+	if (in != NULL)
+	{
+		memcpy(in->sequence, sequence, 4);
+	}
+}
+
+/** Finish hashPrevouts, hashSequence and hashOutputs. This should be called
+  * after the whole spending transaction has been read. */
+static void bip143Finish(void)
+{
+	sha256FinishDouble(&bip143_prevouts_hs);
+	writeHashToByteArray(bip143_hash_prevouts, &bip143_prevouts_hs, true);
+	sha256FinishDouble(&bip143_sequence_hs);
+	writeHashToByteArray(bip143_hash_sequence, &bip143_sequence_hs, true);
+	sha256FinishDouble(&bip143_outputs_hs);
+	writeHashToByteArray(bip143_hash_outputs_digest, &bip143_outputs_hs, true);
+}
+
+/** Write bytes to a hash state.
+  * \param hs The hash state to write to.
+  * \param data The bytes to write.
+  * \param length The number of bytes to write.
+  */
+static void bip143WriteBytes(HashState *hs, uint8_t *data, uint32_t length)
+{
+	sha256WriteBytes(hs, data, length);
+}
+
+/** Calculate the BIP143 signature hash of one input of the spending
+  * transaction from the cached intermediate hashes. The amount of work done
+  * does not depend on the size of the transaction.
+  * \param sig_hash The signature hash will be written here, as a 32 byte
+  *                 little-endian multi-precision number.
+  * \param input The index of the input. This must be one of the inputs
+  *              which are being signed (see bip143GetInput()).
+  */
+static void bip143SigHash(BigNum256 sig_hash, uint32_t input)
+{
+	HashState hs;
+	Bip143Input *in;
+
+	in = bip143GetInput(input);
+	sha256Begin(&hs);
+	bip143WriteBytes(&hs, bip143_version, 4);
+	bip143WriteBytes(&hs, bip143_hash_prevouts, 32);
+	bip143WriteBytes(&hs, bip143_hash_sequence, 32);
+	bip143WriteBytes(&hs, in->outpoint, 36);
+	sha256WriteByte(&hs, in->script_code_length);
+	bip143WriteBytes(&hs, in->script_code, in->script_code_length);
+	bip143WriteBytes(&hs, in->amount, 8);
+	bip143WriteBytes(&hs, in->sequence, 4);
+	bip143WriteBytes(&hs, bip143_hash_outputs_digest, 32);
+	bip143WriteBytes(&hs, bip143_locktime, 4);
+	bip143WriteBytes(&hs, bip143_hash_type, 4);
+	sha256FinishDouble(&hs);
+	writeHashToByteArray(sig_hash, &hs, false);
+}
+
 /** Get transaction data by reading from the stream device, checking that
   * the read operation won't go beyond the end of the transaction data.
-  *
+  * 
   * Since all transaction data is read using this function, the updating
-  * of #sig_hash_hs_ptr and #transaction_hash_hs_ptr is also done.
+  * of #sig_hash_hs_ptr, #transaction_hash_hs_ptr, the signature hash
+  * engine (see \ref SigHashEngine) and hashOutputs (see
+  * \ref Bip143Cache) is also done.
   * \param buffer An array of bytes which will be filled with the transaction
   *               data (if everything goes well). It must have space for
   *               length bytes.
@@ -191,16 +502,11 @@ static bool getTransactionBytes(uint8_t *buffer, uint8_t length)
   * \return false on success, true if a stream read error occurred or if the
   *         read would go beyond the end of the transaction data.
   */
-/** Checks whether the transaction parser is at the end of the transaction
-  * data.
-  * \return false if not at the end of the transaction data, true if at the
-  *         end of the transaction data.
-  */
-static bool getTransactionBytesMulti(uint8_t *buffer, uint8_t length, uint32_t number_of_inputs)
+static bool getTransactionBytes(uint8_t *buffer, uint8_t length)
 {
+#ifdef DISPLAY_STREAM
 	uint8_t i;
-	uint32_t j;
-	uint8_t one_byte;
+#endif
 
 	if (transaction_data_index > (0xffffffff - (uint32_t)length))
 	{
@@ -215,96 +521,46 @@ static bool getTransactionBytesMulti(uint8_t *buffer, uint8_t length, uint32_t n
 	}
 	else
 	{
+		streamGetBytes(buffer, length);
+#ifdef DISPLAY_STREAM
 		for (i = 0; i < length; i++)
 		{
-			one_byte = streamGetOneByte();
-			buffer[i] = one_byte;
-			if (hs_ptr_valid)
-			{
-				sha256WriteByte(sig_hash_hs_ptr, one_byte);
-//				write to the iteration-th hash, the others should be blanked.
-				if(sig_ptr_valid)
-				{
-					for(j = 0; j < number_of_inputs; j++)
-					{
-						sha256WriteByte(sig_hash_hs_ptr_array[j], one_byte);
-					}
-				}
-				if (!suppress_transaction_hash)
-				{
-					sha256WriteByte(transaction_hash_hs_ptr, one_byte);
-				}
-			}
-			transaction_data_index++;
-#ifdef DISPLAY_STREAM
-			bigBuffer[bigCounter] = one_byte;
+			bigBuffer[bigCounter] = buffer[i];
 			bigCounter++;
-#endif
-
 		}
-		return false;
-	}
-}
-
-static bool getTransactionBytesMultiFilter(uint8_t *buffer, uint8_t length, uint32_t number_of_inputs, uint32_t iteration, bool is_script_length)
-{
-	uint8_t i;
-	uint32_t j;
-	uint8_t one_byte;
-
-	if (transaction_data_index > (0xffffffff - (uint32_t)length))
-	{
-		// transaction_data_index + (uint32_t)length will overflow.
-		// Since transaction_length <= 0xffffffff, this implies that the read
-		// will go past the end of the transaction.
-		return true; // trying to read past end of transaction
-	}
-	if (transaction_data_index + (uint32_t)length > transaction_length)
-	{
-		return true; // trying to read past end of transaction
-	}
-	else
-	{
-
-
-		for (i = 0; i < length; i++)
+#endif
+		transaction_data_index += length;
+		// Hash the whole read in one go; see hashWriteBytes().
+		if (hs_ptr_valid)
 		{
-			one_byte = streamGetOneByte();
-			buffer[i] = one_byte;
-			if (hs_ptr_valid )
+			if (sig_ptr_valid)
 			{
-				sha256WriteByte(sig_hash_hs_ptr, one_byte);
-//				write to the iteration-th hash, the others should be blanked.
-				if(sig_ptr_valid)
-				{
-					for(j = 0; j < number_of_inputs; j++)
-					{
-						if(j == iteration)
-						{
-							sha256WriteByte(sig_hash_hs_ptr_array[j], one_byte);
-						}
-						else if(is_script_length)
-						{
-							sha256WriteByte(sig_hash_hs_ptr_array[j], 0);
-						}
-					}
-				}
-				if (!suppress_transaction_hash)
-				{
-					sha256WriteByte(transaction_hash_hs_ptr, one_byte);
-				}
+				sigHashWriteBytes(buffer, length);
+			}
+			else
+			{
+				// Only input transactions need the hash of the entire
+				// transaction.
+				sha256WriteBytes(sig_hash_hs_ptr, buffer, length);
+			}
+			if (!suppress_transaction_hash)
+			{
+				sha256WriteBytes(transaction_hash_hs_ptr, buffer, length);
+			}
+			if (bip143_hash_outputs)
+			{
+				sha256WriteBytes(&bip143_outputs_hs, buffer, length);
 			}
-			transaction_data_index++;
-#ifdef DISPLAY_STREAM
-			bigBuffer[bigCounter] = one_byte;
-			bigCounter++;
-#endif
-
 		}
 		return false;
 	}
 }
 
+/** Checks whether the transaction parser is at the end of the transaction
+  * data.
+  * \return false if not at the end of the transaction data, true if at the
+  *         end of the transaction data.
+  */
 static bool isEndOfTransactionData(void)
 {
 	if (transaction_data_index >= transaction_length)
@@ -374,97 +630,6 @@ bool getVarInt(uint32_t *out, uint8_t *input)
 	return false; // success
 }
 
-/** Parse a variable-sized integer within a transaction. Variable sized
-  * integers are commonly used to represent counts or sizes in Bitcoin
-  * transactions.
-  * This only supports unsigned variable-sized integers up to a maximum
-  * value of 2 ^ 32 - 1.
-  * \param out The value of the integer will be written to here.
-  * \return false on success, true to indicate an error occurred (unexpected
-  *         end of transaction data or the value of the integer is too large).
-  */
-static bool getVarIntMulti(uint32_t *out, uint8_t number_of_inputs)
-{
-	uint8_t temp[4];
-
-	if (getTransactionBytesMulti(temp, 1, number_of_inputs))
-	{
-		return true; // unexpected end of transaction data
-	}
-	if (temp[0] < 0xfd)
-	{
-		*out = temp[0];
-	}
-	else if (temp[0] == 0xfd)
-	{
-		if (getTransactionBytesMulti(temp, 2, number_of_inputs))
-		{
-			return true; // unexpected end of transaction data
-		}
-		*out = (uint32_t)(temp[0]) | ((uint32_t)(temp[1]) << 8);
-	}
-	else if (temp[0] == 0xfe)
-	{
-		if (getTransactionBytesMulti(temp, 4, number_of_inputs))
-		{
-			return true; // unexpected end of transaction data
-		}
-		*out = readU32LittleEndian(temp);
-	}
-	else
-	{
-		return true; // varint is too large
-	}
-	return false; // success
-}
-
-/** Parse a variable-sized integer within a transaction. Variable sized
-  * integers are commonly used to represent counts or sizes in Bitcoin
-  * transactions.
-  * This only supports unsigned variable-sized integers up to a maximum
-  * value of 2 ^ 32 - 1.
-  * \param out The value of the integer will be written to here.
-  * \return false on success, true to indicate an error occurred (unexpected
-  *         end of transaction data or the value of the integer is too large).
-  */
-static bool getVarIntMultiFilter(uint32_t *out, uint8_t number_of_inputs, uint32_t iteration, bool is_script_length)
-{
-	uint8_t temp[4];
-
-	if (getTransactionBytesMultiFilter(temp, 1, number_of_inputs, iteration, is_script_length))
-	{
-		return true; // unexpected end of transaction data
-	}
-	if (temp[0] < 0xfd)
-	{
-		*out = temp[0];
-	}
-	else if (temp[0] == 0xfd)
-	{
-		if (getTransactionBytesMultiFilter(temp, 2, number_of_inputs, iteration, is_script_length))
-		{
-			return true; // unexpected end of transaction data
-		}
-		*out = (uint32_t)(temp[0]) | ((uint32_t)(temp[1]) << 8);
-	}
-	else if (temp[0] == 0xfe)
-	{
-		if (getTransactionBytesMultiFilter(temp, 4, number_of_inputs, iteration, is_script_length))
-		{
-			return true; // unexpected end of transaction data
-		}
-		*out = readU32LittleEndian(temp);
-	}
-	else
-	{
-		return true; // varint is too large
-	}
-	return false; // success
-}
-
-
-
-
 /** See comments for parseTransaction() for description of what this does
   * and return values. However, the guts of the transaction parser are in
   * the code to this function.
@@ -483,7 +648,7 @@ static bool getVarIntMultiFilter(uint32_t *out, uint8_t number_of_inputs, uint32
   *                       main transaction.
   * \return See parseTransaction().
   */
-static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], BigNum256 transaction_hash, bool *is_ref_out, HashState *ref_compare_hs, uint32_t number_of_inputs, uint8_t sig_hash_counter, char *change_address_ptr)
+static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], BigNum256 transaction_hash, bool *is_ref_out, HashState *ref_compare_hs, uint32_t first_input, uint32_t number_of_inputs, uint8_t sig_hash_counter, char *change_address_ptr)
 {
 	uint8_t temp[32];
 	uint8_t ref_compare_hash[32];
@@ -495,7 +660,6 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 	uint32_t i;
 	uint8_t j;
 	uint32_t k;
-	uint32_t m;
 	uint32_t output_num_select;
 	bool is_ref;
 	char text_amount[TEXT_AMOUNT_LENGTH];
@@ -503,6 +667,7 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 	char text_address_static[TEXT_ADDRESS_LENGTH] = {};
 	char text_address_to_compare[number_of_inputs][TEXT_ADDRESS_LENGTH];
 	uint8_t sig_hash_single[32];
+	Bip143Input *bip143_in;
 	char script_length_char[16];
 	int address_match;
 	int address_match_specific;
@@ -524,7 +689,7 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 
 	sig_ptr_valid = false;
 
-	if (getTransactionBytesMulti(temp, 1, number_of_inputs))
+	if (getTransactionBytes(temp, 1))
 	{
 		return TRANSACTION_INVALID_FORMAT; // transaction truncated
 	}
@@ -542,7 +707,7 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 	if (is_ref)
 	{
 		// Get output number to add to total amount.
-		if (getTransactionBytesMulti(temp, 4, number_of_inputs))
+		if (getTransactionBytes(temp, 4))
 		{
 #ifdef DISPLAY_PARMS
 			writeEinkDisplay("invalid format", false, 10, 10, "",false,10,30, "",false,10,50, "",false,10,70, "",false,0,0);
@@ -567,24 +732,25 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 	}
 
 	sha256Begin(sig_hash_hs_ptr);
+	sig_ptr_valid = false;
 	if(!is_ref)
 	{
-		sig_ptr_valid = true;
-		for(m = 0; m < number_of_inputs; m++)
+		if (bip143_enabled)
 		{
-			sha256Begin(sig_hash_hs_ptr_array[m]);
+			bip143Begin();
+		}
+		else
+		{
+			sig_ptr_valid = true;
+			sigHashBegin(first_input, number_of_inputs);
 		}
-	}
-	else
-	{
-		sig_ptr_valid = false;
 	}
 	sha256Begin(transaction_hash_hs_ptr);
 	hs_ptr_valid = true;
 	suppress_transaction_hash = false;
 
 	// Check version.
-	if (getTransactionBytesMulti(temp, 4, number_of_inputs))
+	if (getTransactionBytes(temp, 4))
 	{
 		#ifdef DISPLAY_PARMS
 				writeEinkDisplay("4", false, 10, 10, "",false,10,30, "",false,10,50, "",false,10,70, "",false,0,0);
@@ -598,9 +764,10 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 		#endif
 		return TRANSACTION_WRONG_VERSION; // unsupported transaction version
 	}
+	memcpy(bip143_version, temp, 4);
 
 	// Get number of inputs.
-	if (getVarIntMulti(&num_inputs, number_of_inputs))
+	if (getVarInt(&num_inputs, NULL))
 	{
 		#ifdef DISPLAY_PARMS
 				writeEinkDisplay("6", false, 10, 10, "",false,10,30, "",false,10,50, "",false,10,70, "",false,0,0);
@@ -626,7 +793,7 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 	for (i = 0; i < num_inputs; i++)
 	{
 		// Get input transaction reference hash.
-		if (getTransactionBytesMulti(temp, 32, number_of_inputs))
+		if (getTransactionBytes(temp, 32))
 		{
 			#ifdef DISPLAY_PARMS
 						writeEinkDisplay("9", false, 10, 10, "",false,10,30, "",false,10,50, "",false,10,70, "",false,0,0);
@@ -634,7 +801,7 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 			return TRANSACTION_INVALID_FORMAT; // transaction truncated
 		}
 		// Get input transaction reference number.
-		if (getTransactionBytesMulti(input_reference_num_buffer, 4, number_of_inputs))
+		if (getTransactionBytes(input_reference_num_buffer, 4))
 		{
 			#ifdef DISPLAY_PARMS
 						writeEinkDisplay("10", false, 10, 10, "",false,10,30, "",false,10,50, "",false,10,70, "",false,0,0);
@@ -651,6 +818,10 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 			{
 				sha256WriteByte(ref_compare_hs, temp[j]);
 			}
+			if (bip143_enabled)
+			{
+				bip143WriteOutpoint(i, temp, input_reference_num_buffer);
+			}
 		}
 		// The Bitcoin protocol for signing a transaction involves replacing
 		// the corresponding input script with the output script that
@@ -665,63 +836,68 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 //		Surpress sig hash for all but the input being signed for
 
 		// Get input script length. // sample is 0x8b == 139 bytes OR can be the 19 variant - IT DOESN'T MATTER!!!!
-		// have to intercept this to be a zero for the not being hashed inputs
-
-
-		if(!is_ref)
+		// For the spending transaction, the script (including its length)
+		// only goes into the signature hash of input i; every other
+		// signature hash sees an empty script.
+		// For BIP143, the script is the script code of input i.
+		if (!is_ref && !bip143_enabled)
+		{
+			sigHashBeginScript(i);
+		}
+		if (getVarInt(&script_length, NULL))
+		{
+			#ifdef DISPLAY_PARMS
+						writeEinkDisplay("11", false, 10, 10, "",false,10,30, "",false,10,50, "",false,10,70, "",false,0,0);
+			#endif
+			return TRANSACTION_INVALID_FORMAT; // transaction truncated or varint too big
+		}
+		bip143_in = NULL;
+		if (!is_ref && bip143_enabled)
+		{
+			bip143_in = bip143GetInput(i);
+		}
+		if (bip143_in != NULL)
 		{
-			if (getVarIntMultiFilter(&script_length, number_of_inputs, i, true))
+			if (script_length > BIP143_MAX_SCRIPT_CODE_LENGTH)
 			{
-				#ifdef DISPLAY_PARMS
-							writeEinkDisplay("11", false, 10, 10, "",false,10,30, "",false,10,50, "",false,10,70, "",false,0,0);
-				#endif
-				return TRANSACTION_INVALID_FORMAT; // transaction truncated or varint too big
-			}
-
-			for (k = 0; k < script_length; k++)
-			{
-				if (getTransactionBytesMultiFilter(temp, 1, number_of_inputs, i, false))
-				{
-					#ifdef DISPLAY_PARMS
-									writeEinkDisplay("12", false, 10, 10, "",false,10,30, "",false,10,50, "",false,10,70, "",false,0,0);
-					#endif
-					return TRANSACTION_INVALID_FORMAT; // transaction truncated
-				}
+				return TRANSACTION_NON_STANDARD; // script code too long
 			}
+			bip143_in->script_code_length = (uint8_t)script_length;
 		}
-		else
+		for (k = 0; k < script_length; k++)
 		{
-			if (getVarIntMulti(&script_length, number_of_inputs))
+			if (getTransactionBytes(temp, 1))
 			{
 				#ifdef DISPLAY_PARMS
-							writeEinkDisplay("11", false, 10, 10, "",false,10,30, "",false,10,50, "",false,10,70, "",false,0,0);
+								writeEinkDisplay("12", false, 10, 10, "",false,10,30, "",false,10,50, "",false,10,70, "",false,0,0);
 				#endif
-				return TRANSACTION_INVALID_FORMAT; // transaction truncated or varint too big
+				return TRANSACTION_INVALID_FORMAT; // transaction truncated
+			}
+			if (bip143_in != NULL)
+			{
+				bip143_in->script_code[k] = temp[0];
 			}
-				for (k = 0; k < script_length; k++)
-				{
-					if (getTransactionBytesMulti(temp, 1, number_of_inputs))
-					{
-						#ifdef DISPLAY_PARMS
-										writeEinkDisplay("12", false, 10, 10, "",false,10,30, "",false,10,50, "",false,10,70, "",false,0,0);
-						#endif
-						return TRANSACTION_INVALID_FORMAT; // transaction truncated
-					}
-				}
-//			}
+		}
+		if (!is_ref && !bip143_enabled)
+		{
+			sigHashEndScript();
 		}
 
 //		unsupress sig hash
 		suppress_transaction_hash = false;
 		// Check sequence. Since locktime is checked below, this check
 		// is probably superfluous. But it's better to be safe than sorry.
-		if (getTransactionBytesMulti(temp, 4, number_of_inputs))
+		if (getTransactionBytes(temp, 4))
 		{
 			#ifdef DISPLAY_PARMS
 						writeEinkDisplay("13", false, 10, 10, "",false,10,30, "",false,10,50, "",false,10,70, "",false,0,0);
 			#endif
 			return TRANSACTION_INVALID_FORMAT; // transaction truncated
 		}
+		if (!is_ref && bip143_enabled)
+		{
+			bip143WriteSequence(i, temp);
+		}
 		if (readU32LittleEndian(temp) != 0xFFFFFFFF)
 		{
 			#ifdef DISPLAY_PARMS
@@ -747,7 +923,7 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 	}
 
 	// Get number of outputs.
-	if (getVarIntMulti(&num_outputs, number_of_inputs))
+	if (getVarInt(&num_outputs, NULL))
 	{
 		#ifdef DISPLAY_PARMS
 				writeEinkDisplay("16", false, 10, 10, "",false,10,30, "",false,10,50, "",false,10,70, "",false,0,0);
@@ -779,12 +955,17 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 		}
 
 	}
+	else
+	{
+		// Everything from here up to the locktime goes into hashOutputs.
+		bip143_hash_outputs = bip143_enabled;
+	}
 
 	// Process each output.
 	for (i = 0; i < num_outputs; i++)
 	{
 		// Get output amount.
-		if (getTransactionBytesMulti(temp, 8, number_of_inputs))
+		if (getTransactionBytes(temp, 8))
 		{
 			#ifdef DISPLAY_PARMS
 						writeEinkDisplay("20", false, 10, 10, "",false,10,30, "",false,10,50, "",false,10,70, "",false,0,0);
@@ -809,6 +990,10 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 					#endif
 					return TRANSACTION_INVALID_AMOUNT; // overflow occurred (carry occurred)
 				}
+				if (bip143_enabled)
+				{
+					bip143WriteAmount(temp);
+				}
 			}
 		}
 		else
@@ -823,7 +1008,7 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 			amountToText(text_amount, temp);
 		}
 		// Get output script length.
-		if (getVarIntMulti(&script_length, number_of_inputs))
+		if (getVarInt(&script_length, NULL))
 		{
 			#ifdef DISPLAY_PARMS
 						writeEinkDisplay("24", false, 10, 10, "",false,10,30, "",false,10,50, "",false,10,70, "",false,0,0);
@@ -841,7 +1026,7 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 						{
 							// Expect a standard, pay to public key hash output script.
 							// Look for: OP_DUP, OP_HASH160, (20 bytes of data).
-							if (getTransactionBytesMulti(temp, 3, number_of_inputs))
+							if (getTransactionBytes(temp, 3))
 							{
 								#ifdef DISPLAY_PARMS
 													writeEinkDisplay("26", false, 10, 10, "",false,10,30, "",false,10,50, "",false,10,70, "",false,0,0);
@@ -855,7 +1040,7 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 								#endif
 								return TRANSACTION_NON_STANDARD; // nonstandard transaction
 							}
-							if (getTransactionBytesMulti(temp, 20, number_of_inputs))
+							if (getTransactionBytes(temp, 20))
 							{
 								#ifdef DISPLAY_PARMS
 													writeEinkDisplay("28", false, 10, 10, "",false,10,30, "",false,10,50, "",false,10,70, "",false,0,0);
@@ -866,7 +1051,7 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 							p++;
 //							writeEinkDisplay(text_address_static, false, 10, 10, "938",false,10,30, "",false,10,50, "",false,10,70, "",false,0,0);
 							// Look for: OP_EQUALVERIFY OP_CHECKSIG.
-							if (getTransactionBytesMulti(temp, 2, number_of_inputs))
+							if (getTransactionBytes(temp, 2))
 							{
 								#ifdef DISPLAY_PARMS
 													writeEinkDisplay("29", false, 10, 10, "",false,10,30, "",false,10,50, "",false,10,70, "",false,0,0);
@@ -885,7 +1070,7 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 						{
 							// Expect a standard, pay to script hash output script.
 							// Look for: OP_HASH160, (20 bytes of data).
-							if (getTransactionBytesMulti(temp, 2, number_of_inputs))
+							if (getTransactionBytes(temp, 2))
 							{
 								return TRANSACTION_INVALID_FORMAT; // transaction truncated
 							}
@@ -893,14 +1078,14 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 							{
 								return TRANSACTION_NON_STANDARD; // nonstandard transaction
 							}
-							if (getTransactionBytesMulti(temp, 20, number_of_inputs))
+							if (getTransactionBytes(temp, 20))
 							{
 								return TRANSACTION_INVALID_FORMAT; // transaction truncated
 							}
 							hashToAddr(text_address_to_compare[p], temp, ADDRESS_VERSION_PUBKEY);
 							p++;
 							// Look for: OP_EQUAL.
-							if (getTransactionBytesMulti(temp, 1, number_of_inputs))
+							if (getTransactionBytes(temp, 1))
 							{
 								return TRANSACTION_INVALID_FORMAT; // transaction truncated
 							}
@@ -913,7 +1098,7 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 						{
 							for (k = 0; k < script_length; k++)
 							{
-								if (getTransactionBytesMulti(temp, 1, number_of_inputs))
+								if (getTransactionBytes(temp, 1))
 								{
 									#ifdef DISPLAY_PARMS
 														writeEinkDisplay("25", false, 10, 10, "",false,10,30, "",false,10,50, "",false,10,70, "",false,0,0);
@@ -928,7 +1113,7 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 			{
 				for (k = 0; k < script_length; k++)
 				{
-					if (getTransactionBytesMulti(temp, 1, number_of_inputs))
+					if (getTransactionBytes(temp, 1))
 					{
 						#ifdef DISPLAY_PARMS
 											writeEinkDisplay("25", false, 10, 10, "",false,10,30, "",false,10,50, "",false,10,70, "",false,0,0);
@@ -947,7 +1132,7 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 			{
 				// Expect a standard, pay to public key hash output script.
 				// Look for: OP_DUP, OP_HASH160, (20 bytes of data).
-				if (getTransactionBytesMulti(temp, 3, number_of_inputs))
+				if (getTransactionBytes(temp, 3))
 				{
 					#ifdef DISPLAY_PARMS
 										writeEinkDisplay("26", false, 10, 10, "",false,10,30, "",false,10,50, "",false,10,70, "",false,0,0);
@@ -961,7 +1146,7 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 					#endif
 					return TRANSACTION_NON_STANDARD; // nonstandard transaction
 				}
-				if (getTransactionBytesMulti(temp, 20, number_of_inputs))
+				if (getTransactionBytes(temp, 20))
 				{
 					#ifdef DISPLAY_PARMS
 										writeEinkDisplay("28", false, 10, 10, "",false,10,30, "",false,10,50, "",false,10,70, "",false,0,0);
@@ -970,7 +1155,7 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 				}
 				hashToAddr(text_address, temp, ADDRESS_VERSION_PUBKEY);
 				// Look for: OP_EQUALVERIFY OP_CHECKSIG.
-				if (getTransactionBytesMulti(temp, 2, number_of_inputs))
+				if (getTransactionBytes(temp, 2))
 				{
 					#ifdef DISPLAY_PARMS
 										writeEinkDisplay("29", false, 10, 10, "",false,10,30, "",false,10,50, "",false,10,70, "",false,0,0);
@@ -989,7 +1174,7 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 			{
 				// Expect a standard, pay to script hash output script.
 				// Look for: OP_HASH160, (20 bytes of data).
-				if (getTransactionBytesMulti(temp, 2, number_of_inputs))
+				if (getTransactionBytes(temp, 2))
 				{
 					return TRANSACTION_INVALID_FORMAT; // transaction truncated
 				}
@@ -997,13 +1182,13 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 				{
 					return TRANSACTION_NON_STANDARD; // nonstandard transaction
 				}
-				if (getTransactionBytesMulti(temp, 20, number_of_inputs))
+				if (getTransactionBytes(temp, 20))
 				{
 					return TRANSACTION_INVALID_FORMAT; // transaction truncated
 				}
 				hashToAddr(text_address, temp, ADDRESS_VERSION_P2SH);
 				// Look for: OP_EQUAL.
-				if (getTransactionBytesMulti(temp, 1, number_of_inputs))
+				if (getTransactionBytes(temp, 1))
 				{
 					return TRANSACTION_INVALID_FORMAT; // transaction truncated
 				}
@@ -1063,15 +1248,17 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 							}
 		} // end if (is_ref)
 	} // end for (i = 0; i < num_outputs; i++)
+	bip143_hash_outputs = false;
 
 	// Check locktime.
-	if (getTransactionBytesMulti(temp, 4, number_of_inputs))
+	if (getTransactionBytes(temp, 4))
 	{
 		#ifdef DISPLAY_PARMS
 				writeEinkDisplay("33", false, 10, 10, "",false,10,30, "",false,10,50, "",false,10,70, "",false,0,0);
 		#endif
 		return TRANSACTION_INVALID_FORMAT; // transaction truncated
 	}
+	memcpy(bip143_locktime, temp, 4);
 	if (readU32LittleEndian(temp) != 0x00000000)
 	{
 		#ifdef DISPLAY_PARMS
@@ -1083,7 +1270,7 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 	if (!is_ref)
 	{
 		// Check hashtype.
-		if (getTransactionBytesMulti(temp, 4, number_of_inputs))
+		if (getTransactionBytes(temp, 4))
 		{
 			#ifdef DISPLAY_PARMS
 						writeEinkDisplay("35", false, 10, 10, "",false,10,30, "",false,10,50, "",false,10,70, "",false,0,0);
@@ -1097,6 +1284,7 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 			#endif
 			return TRANSACTION_NON_STANDARD; // nonstandard transaction
 		}
+		memcpy(bip143_hash_type, temp, 4);
 
 		// Is there junk at the end of the transaction data?
 		if (!isEndOfTransactionData())
@@ -1115,26 +1303,32 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 	}
 
 	sha256FinishDouble(sig_hash_hs_ptr);
-	if(!is_ref)
-	{
-		for(m = 0; m < number_of_inputs; m++)
-		{
-			sha256FinishDouble(sig_hash_hs_ptr_array[m]);
-		}
-	}
 	// The signature hash is written in a little-endian format because it
 	// is used as a little-endian multi-precision integer in
 	// signTransaction().
-
-//	we are going to have to write an array of hashes, looping through for however many inputs there were
-
 	writeHashToByteArray(sig_hash_single, sig_hash_hs_ptr, false);
 
 	if(!is_ref)
 	{
-		for(m = 0; m < number_of_inputs; m++)
+		if (bip143_enabled)
 		{
-			writeHashToByteArray(sig_hash[m], sig_hash_hs_ptr_array[m], false);
+			if (bip143_num_amounts < (first_input + bip143_num_inputs))
+			{
+				return TRANSACTION_INVALID_REFERENCE; // amount of an input is missing
+			}
+			bip143Finish();
+			for (i = 0; i < bip143_num_inputs; i++)
+			{
+				bip143SigHash(sig_hash[i], first_input + i);
+			}
+		}
+		else
+		{
+			if (!sigHashComplete())
+			{
+				return TRANSACTION_INVALID_FORMAT; // window is outside the inputs
+			}
+			sigHashFinish(sig_hash);
 		}
 	}
 	//	writeHashToByteArray(sig_hash[0], sig_hash_hs_ptr, false);
@@ -1167,6 +1361,95 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
 	return TRANSACTION_NO_ERROR;
 }
 
+/** Allocate the per-input state needed to parse a transaction, then parse
+  * it. See parseTransactionCommon().
+  * \return See parseTransaction().
+  */
+static TransactionErrors parseTransactionWithStorage(uint8_t sig_hash[][32], BigNum256 transaction_hash, uint32_t first_input, uint32_t number_of_inputs, char *change_address_ptr_original, bool use_bip143)
+{
+	TransactionErrors r;
+	bool is_ref;
+	HashState sig_hash_hs;
+	HashState sig_hash_shared_hs;
+	HashState sig_hash_hs_array[use_bip143 ? 1 : number_of_inputs];
+	Bip143Input bip143_input_array[use_bip143 ? number_of_inputs : 1];
+	HashState transaction_hash_hs;
+	HashState ref_compare_hs;
+	uint32_t i;
+
+	memset(transaction_fee_amount, 0, sizeof(transaction_fee_amount));
+	sig_hash_hs_ptr = &sig_hash_hs;
+	sig_hash_shared_hs_ptr = &sig_hash_shared_hs;
+	bip143_enabled = use_bip143;
+	bip143_hash_outputs = false;
+	if (use_bip143)
+	{
+		bip143_inputs = bip143_input_array;
+		bip143_first_input = first_input;
+		bip143_num_inputs = number_of_inputs;
+		bip143_num_amounts = 0;
+	}
+	else
+	{
+		for(i=0;i<number_of_inputs;i++)
+		{
+			sig_hash_hs_ptr_array[i] = &sig_hash_hs_array[i];
+		}
+	}
+
+	transaction_hash_hs_ptr = &transaction_hash_hs;
+	sha256Begin(&ref_compare_hs);
+
+	uint8_t sig_hash_counter = 0;
+
+	hs_ptr_valid = true;
+
+	do
+	{
+		r = parseTransactionInternalMulti(sig_hash, transaction_hash, &is_ref, &ref_compare_hs, first_input, number_of_inputs, sig_hash_counter, change_address_ptr_original);
+	} while ((r == TRANSACTION_NO_ERROR) && is_ref);
+	hs_ptr_valid = false;
+	bip143_hash_outputs = false;
+	return r;
+}
+
+/** See comments for parseTransactionWindow() and parseTransactionBip143()
+  * for what this does.
+  * \param use_bip143 If true, calculate BIP143 signature hashes, otherwise
+  *                   calculate legacy signature hashes.
+  * \return See parseTransaction().
+  */
+static TransactionErrors parseTransactionCommon(uint8_t sig_hash[][32], BigNum256 transaction_hash, uint32_t length, uint32_t first_input, uint32_t number_of_inputs, char *change_address_ptr_original, bool use_bip143)
+{
+	TransactionErrors r;
+	uint8_t junk;
+
+	hs_ptr_valid = false;
+	transaction_data_index = 0;
+	transaction_length = length;
+
+	// The per-input state is allocated on the stack, so its size must be
+	// bounded.
+	if ((number_of_inputs == 0) || (number_of_inputs > MAX_SIGNED_INPUTS))
+	{
+		r = TRANSACTION_TOO_MANY_INPUTS;
+	}
+	else
+	{
+		r = parseTransactionWithStorage(sig_hash, transaction_hash, first_input, number_of_inputs, change_address_ptr_original, use_bip143);
+	}
+
+	// Always try to consume the entire stream.
+	while (!isEndOfTransactionData())
+	{
+		if (getTransactionBytes(&junk, 1))
+		{
+			break;
+		}
+	}
+	return r;
+}
+
 /** Parse a Bitcoin transaction, extracting the output amounts/addresses,
   * validating the transaction (ensuring that it is "standard") and computing
   * a double SHA-256 hash of the transaction. This double SHA-256 hash is the
@@ -1206,51 +1489,55 @@ static TransactionErrors parseTransactionInternalMulti(uint8_t sig_hash[][32], B
   */
 TransactionErrors parseTransaction(uint8_t sig_hash[][32], BigNum256 transaction_hash, uint32_t length, uint32_t number_of_inputs, char *change_address_ptr_original)
 {
-	TransactionErrors r;
-	uint8_t junk;
-	bool is_ref;
-	HashState sig_hash_hs;
-	HashState sig_hash_hs_array[number_of_inputs];
-	HashState transaction_hash_hs;
-	HashState ref_compare_hs;
-	uint32_t i;
-
-
-	hs_ptr_valid = false;
-	transaction_data_index = 0;
-	transaction_length = length;
-	memset(transaction_fee_amount, 0, sizeof(transaction_fee_amount));
-	sig_hash_hs_ptr = &sig_hash_hs;
-	for(i=0;i<number_of_inputs;i++)
-	{
-		sig_hash_hs_ptr_array[i] = &sig_hash_hs_array[i];
-	}
-
-	transaction_hash_hs_ptr = &transaction_hash_hs;
-	sha256Begin(&ref_compare_hs);
-
-	uint8_t sig_hash_counter = 0;
-
-	hs_ptr_valid = true;
-
-
-
+	return parseTransactionCommon(sig_hash, transaction_hash, length, 0, number_of_inputs, change_address_ptr_original, false);
+}
 
-	do
-	{
-		r = parseTransactionInternalMulti(sig_hash, transaction_hash, &is_ref, &ref_compare_hs, number_of_inputs, sig_hash_counter, change_address_ptr_original);
-	} while ((r == TRANSACTION_NO_ERROR) && is_ref);
-	hs_ptr_valid = false;
+/** Parse a Bitcoin transaction, just like parseTransaction(), except that
+  * signature hashes are only calculated for a window of consecutive inputs.
+  * Memory use depends on the size of the window, not on the number of
+  * inputs in the transaction, so a transaction with many inputs can be
+  * signed by parsing it several times, one window at a time. The
+  * transaction hash is the same for every window, so it can be used to
+  * check that every window belongs to the same transaction.
+  * \param sig_hash The signature hash of input first_input + i will be
+  *                 written to sig_hash[i]. See parseTransaction().
+  * \param transaction_hash See parseTransaction().
+  * \param length See parseTransaction().
+  * \param first_input The index of the first input of the window.
+  * \param number_of_inputs The number of inputs in the window. This must be
+  *                         between 1 and #MAX_SIGNED_INPUTS inclusive.
+  * \param change_address_ptr_original See parseTransaction().
+  * \return One of the values in #TransactionErrorsEnum. If the window runs
+  *         past the last input of the transaction,
+  *         #TRANSACTION_INVALID_FORMAT is returned.
+  */
+TransactionErrors parseTransactionWindow(uint8_t sig_hash[][32], BigNum256 transaction_hash, uint32_t length, uint32_t first_input, uint32_t number_of_inputs, char *change_address_ptr_original)
+{
+	return parseTransactionCommon(sig_hash, transaction_hash, length, first_input, number_of_inputs, change_address_ptr_original, false);
+}
 
-	// Always try to consume the entire stream.
-	while (!isEndOfTransactionData())
-	{
-		if (getTransactionBytes(&junk, 1))
-		{
-			break;
-		}
-	}
-	return r;
+/** Parse a Bitcoin transaction, just like parseTransaction(), except that
+  * the signature hashes are calculated as described in BIP143. The
+  * intermediate hashes hashPrevouts, hashSequence and hashOutputs are
+  * calculated once while the spending transaction is read, so the cost of
+  * each signature hash does not depend on the size of the transaction.
+  *
+  * The stream format is the same as for parseTransaction(). The input
+  * script of each input of the spending transaction is treated as the
+  * BIP143 script code of that input, and the amount of each input is taken
+  * from the corresponding input transaction.
+  * \param sig_hash See parseTransaction().
+  * \param transaction_hash See parseTransaction().
+  * \param length See parseTransaction().
+  * \param number_of_inputs The number of signature hashes to calculate.
+  *                         The spending transaction must have at least this
+  *                         many inputs.
+  * \param change_address_ptr_original See parseTransaction().
+  * \return One of the values in #TransactionErrorsEnum.
+  */
+TransactionErrors parseTransactionBip143(uint8_t sig_hash[][32], BigNum256 transaction_hash, uint32_t length, uint32_t number_of_inputs, char *change_address_ptr_original)
+{
+	return parseTransactionCommon(sig_hash, transaction_hash, length, 0, number_of_inputs, change_address_ptr_original, true);
 }
 
 /** Swap endian representation of a 256 bit integer.
@@ -1378,6 +1665,10 @@ static uint8_t encapsulateSignature(uint8_t *signature, BigNum256 r, BigNum256 s
   * and a signature hash has been computed. The primary purpose of this
   * function is to call ecdsaSign() and encapsulate the ECDSA signature in
   * the DER format which OpenSSL uses.
+  *
+  * The ECDSA nonce is derived deterministically from the private key and
+  * signature hash (see rfc6979.c), so signing does not need the hardware
+  * random number generator or touch the entropy pool in non-volatile memory.
   * \param signature The encapsulated signature will be written here. This
   *                  must be a byte array with space for
   *                  at least #MAX_SIGNATURE_LENGTH bytes.
@@ -1390,39 +1681,758 @@ static uint8_t encapsulateSignature(uint8_t *signature, BigNum256 r, BigNum256 s
   *                    be a 32 byte little-endian multi-precision integer.
   * \param add_hash_type Whether or not to add the hashtype byte at the end of the DER encoded signature.
   * 					 This is needed for the signMessageCallback, as the signature needs to be without hashtype.
-  * \return false on success, or true if an error occurred while trying to
-  *         obtain a random number.
+  * \return false on success, or true if an error occurred. Since nonce
+  *         generation cannot fail, this currently always returns false.
   */
 bool signTransaction(uint8_t *signature, uint8_t *out_length, BigNum256 sig_hash, BigNum256 private_key, bool add_hash_type)
 {
 	uint8_t k[32];
-
-//	TEST k NOT RANDOM !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
-//	uint8_t k[32] = {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1};
-
 	uint8_t r[32];
 	uint8_t s[32];
+	Rfc6979State nonce_state;
 
 	*out_length = 0;
+	rfc6979Begin(&nonce_state, sig_hash, private_key, NULL);
 	do
 	{
-		if (getRandom256(k))
-		{
-			return true; // problem with RNG system
-		}
+		// If ecdsaSign() fails (r or s is 0, which is astronomically
+		// unlikely), RFC 6979 says to try the next candidate nonce.
+		rfc6979Next(&nonce_state, k);
 		memset(&r[0], 0, sizeof(r));
 		memset(&s[0], 0, sizeof(s));
 	} while (ecdsaSign(r, s, sig_hash, private_key, k));
+	rfc6979Clear(&nonce_state);
+	memset(k, 0, sizeof(k));
+
+	*out_length = encapsulateSignature(signature, r, s, add_hash_type);
+	return false; // success
+}
 
-//	displayBigHexStream(r, 32);
-//	waitForButtonPress();
-//
-//	displayBigHexStream(s, 32);
-//	waitForButtonPress();
 
 
-	*out_length = encapsulateSignature(signature, r, s, add_hash_type);
+#ifdef TEST_TRANSACTION
+
+/** Maximum number of inputs the signature hash tests will use. */
+#define TEST_MAX_INPUTS		64
+/** Number of outputs in the test spending transactions. */
+#define TEST_NUM_OUTPUTS	2
+/** Amount (in satoshi) of the output of the first test input transaction.
+  * Each subsequent input transaction's output is 1 satoshi more, so that
+  * the BIP143 tests can tell input amounts apart. */
+#define TEST_REF_AMOUNT		100000
+/** Amount (in satoshi) of each output of the test spending transactions. */
+#define TEST_SPEND_AMOUNT	1000
+
+/** Contents of the stream which streamGetOneByte() reads from. */
+static uint8_t *test_stream;
+/** Number of valid bytes in #test_stream. */
+static uint32_t test_stream_length;
+/** Index of the next byte streamGetOneByte() will return. */
+static uint32_t test_stream_ptr;
+
+/** The spending transaction (without the is_ref byte but with the hash type)
+  * of the current test, used to calculate the reference signature hashes. */
+static uint8_t *test_spend_tx;
+/** Length of #test_spend_tx, in number of bytes. */
+static uint32_t test_spend_tx_length;
+/** Offset of the input script (including its length) of each input within
+  * #test_spend_tx. */
+static uint32_t test_script_offset[TEST_MAX_INPUTS];
+
+uint8_t streamGetOneByte(void)
+{
+	if (test_stream_ptr >= test_stream_length)
+	{
+		printf("ERROR: Tried to read past end of test stream\n");
+		exit(1);
+	}
+	return test_stream[test_stream_ptr++];
+}
+
+void streamGetBytes(uint8_t *buffer, uint32_t length)
+{
+	if (length > (test_stream_length - test_stream_ptr))
+	{
+		printf("ERROR: Tried to read past end of test stream\n");
+		exit(1);
+	}
+	memcpy(buffer, &(test_stream[test_stream_ptr]), length);
+	test_stream_ptr += length;
+}
+
+bool newOutputSeen(char *text_amount, char *text_address)
+{
 	return false; // success
 }
 
+void setTransactionFee(char *text_amount)
+{
+}
+
+/** Append bytes to a buffer.
+  * \param buffer The buffer to append to.
+  * \param length The current length of the buffer, in bytes. This will be
+  *               updated.
+  * \param data The bytes to append.
+  * \param data_length The number of bytes to append.
+  */
+static void testAppend(uint8_t *buffer, uint32_t *length, const uint8_t *data, uint32_t data_length)
+{
+	memcpy(&(buffer[*length]), data, data_length);
+	*length += data_length;
+}
+
+/** Append a 32 bit little-endian integer to a buffer. See testAppend(). */
+static void testAppendU32(uint8_t *buffer, uint32_t *length, uint32_t value)
+{
+	uint8_t temp[4];
+
+	writeU32LittleEndian(temp, value);
+	testAppend(buffer, length, temp, 4);
+}
+
+/** Append a 64 bit little-endian amount to a buffer. See testAppend(). */
+static void testAppendAmount(uint8_t *buffer, uint32_t *length, uint32_t value)
+{
+	testAppendU32(buffer, length, value);
+	testAppendU32(buffer, length, 0);
+}
+
+/** Append a standard pay to public key hash output script (including its
+  * length) with a pseudo-random public key hash to a buffer. See
+  * testAppend(). */
+static void testAppendP2PKHScript(uint8_t *buffer, uint32_t *length)
+{
+	uint8_t script[26];
+	int i;
+
+	script[0] = 0x19;
+	script[1] = 0x76; // OP_DUP
+	script[2] = 0xa9; // OP_HASH160
+	script[3] = 0x14; // push 20 bytes
+	for (i = 0; i < 20; i++)
+	{
+		script[4 + i] = (uint8_t)rand();
+	}
+	script[24] = 0x88; // OP_EQUALVERIFY
+	script[25] = 0xac; // OP_CHECKSIG
+	testAppend(buffer, length, script, sizeof(script));
+}
+
+/** Build a stream containing num_inputs input transactions followed by a
+  * spending transaction which spends the first output of each of them.
+  * The stream is written to #test_stream and the spending transaction is
+  * also written to #test_spend_tx.
+  * \param num_inputs The number of inputs of the spending transaction.
+  */
+static void buildTestStream(uint32_t num_inputs)
+{
+	uint8_t ref_tx[128];
+	uint32_t ref_tx_length;
+	uint8_t txid[TEST_MAX_INPUTS][32];
+	uint8_t one_byte;
+	HashState hs;
+	uint32_t i;
+	int j;
+
+	test_stream_length = 0;
+	for (i = 0; i < num_inputs; i++)
+	{
+		// Input transaction with one input and one output.
+		ref_tx_length = 0;
+		testAppendU32(ref_tx, &ref_tx_length, 1); // version
+		one_byte = 1; // number of inputs
+		testAppend(ref_tx, &ref_tx_length, &one_byte, 1);
+		for (j = 0; j < 32; j++)
+		{
+			one_byte = (uint8_t)rand();
+			testAppend(ref_tx, &ref_tx_length, &one_byte, 1);
+		}
+		testAppendU32(ref_tx, &ref_tx_length, 0); // output number
+		one_byte = 0; // script length
+		testAppend(ref_tx, &ref_tx_length, &one_byte, 1);
+		testAppendU32(ref_tx, &ref_tx_length, 0xffffffff); // sequence
+		one_byte = 1; // number of outputs
+		testAppend(ref_tx, &ref_tx_length, &one_byte, 1);
+		testAppendAmount(ref_tx, &ref_tx_length, TEST_REF_AMOUNT + i);
+		testAppendP2PKHScript(ref_tx, &ref_tx_length);
+		testAppendU32(ref_tx, &ref_tx_length, 0); // locktime
+
+		sha256Begin(&hs);
+		for (j = 0; j < (int)ref_tx_length; j++)
+		{
+			sha256WriteByte(&hs, ref_tx[j]);
+		}
+		sha256FinishDouble(&hs);
+		writeHashToByteArray(txid[i], &hs, true);
+
+		one_byte = 1; // is_ref
+		testAppend(test_stream, &test_stream_length, &one_byte, 1);
+		testAppendU32(test_stream, &test_stream_length, 0); // output number
+		testAppend(test_stream, &test_stream_length, ref_tx, ref_tx_length);
+	}
+
+	// Spending transaction.
+	test_spend_tx_length = 0;
+	testAppendU32(test_spend_tx, &test_spend_tx_length, 1); // version
+	one_byte = (uint8_t)num_inputs; // number of inputs
+	testAppend(test_spend_tx, &test_spend_tx_length, &one_byte, 1);
+	for (i = 0; i < num_inputs; i++)
+	{
+		testAppend(test_spend_tx, &test_spend_tx_length, txid[i], 32);
+		testAppendU32(test_spend_tx, &test_spend_tx_length, 0); // output number
+		test_script_offset[i] = test_spend_tx_length;
+		testAppendP2PKHScript(test_spend_tx, &test_spend_tx_length);
+		testAppendU32(test_spend_tx, &test_spend_tx_length, 0xffffffff); // sequence
+	}
+	one_byte = TEST_NUM_OUTPUTS; // number of outputs
+	testAppend(test_spend_tx, &test_spend_tx_length, &one_byte, 1);
+	for (i = 0; i < TEST_NUM_OUTPUTS; i++)
+	{
+		testAppendAmount(test_spend_tx, &test_spend_tx_length, TEST_SPEND_AMOUNT);
+		testAppendP2PKHScript(test_spend_tx, &test_spend_tx_length);
+	}
+	testAppendU32(test_spend_tx, &test_spend_tx_length, 0); // locktime
+	testAppendU32(test_spend_tx, &test_spend_tx_length, 1); // hash type
+
+	one_byte = 0; // is_ref
+	testAppend(test_stream, &test_stream_length, &one_byte, 1);
+	testAppend(test_stream, &test_stream_length, test_spend_tx, test_spend_tx_length);
+}
+
+/** Calculate the signature hash of one input of #test_spend_tx the obvious
+  * way: hash the whole transaction, blanking out every input script except
+  * the script of that input.
+  * \param sig_hash The signature hash will be written here, as a 32 byte
+  *                 little-endian multi-precision number.
+  * \param input The index of the input to calculate the signature hash for.
+  * \param num_inputs The number of inputs of #test_spend_tx.
+  */
+static void referenceSigHash(uint8_t *sig_hash, uint32_t input, uint32_t num_inputs)
+{
+	HashState hs;
+	uint32_t i;
+	uint32_t k;
+	uint32_t next_script;
+
+	sha256Begin(&hs);
+	k = 0;
+	for (i = 0; i < num_inputs; i++)
+	{
+		next_script = test_script_offset[i];
+		for (; k < next_script; k++)
+		{
+			sha256WriteByte(&hs, test_spend_tx[k]);
+		}
+		if (i == input)
+		{
+			// The script is 26 bytes, including its length.
+			for (; k < next_script + 26; k++)
+			{
+				sha256WriteByte(&hs, test_spend_tx[k]);
+			}
+		}
+		else
+		{
+			sha256WriteByte(&hs, 0x00);
+			k = next_script + 26;
+		}
+	}
+	for (; k < test_spend_tx_length; k++)
+	{
+		sha256WriteByte(&hs, test_spend_tx[k]);
+	}
+	sha256FinishDouble(&hs);
+	writeHashToByteArray(sig_hash, &hs, false);
+}
+
+/** Calculate the BIP143 signature hash of one input of #test_spend_tx the
+  * obvious way: build the entire preimage, calculating hashPrevouts,
+  * hashSequence and hashOutputs from scratch.
+  * \param sig_hash The signature hash will be written here, as a 32 byte
+  *                 little-endian multi-precision number.
+  * \param input The index of the input to calculate the signature hash for.
+  * \param num_inputs The number of inputs of #test_spend_tx.
+  */
+static void referenceBip143SigHash(uint8_t *sig_hash, uint32_t input, uint32_t num_inputs)
+{
+	HashState hs;
+	uint8_t hash_prevouts[32];
+	uint8_t hash_sequence[32];
+	uint8_t hash_outputs[32];
+	uint8_t amount[8];
+	uint32_t outputs_start;
+	uint32_t i;
+	uint32_t k;
+
+	sha256Begin(&hs);
+	for (i = 0; i < num_inputs; i++)
+	{
+		for (k = test_script_offset[i] - 36; k < test_script_offset[i]; k++)
+		{
+			sha256WriteByte(&hs, test_spend_tx[k]);
+		}
+	}
+	sha256FinishDouble(&hs);
+	writeHashToByteArray(hash_prevouts, &hs, true);
+	sha256Begin(&hs);
+	for (i = 0; i < num_inputs; i++)
+	{
+		for (k = test_script_offset[i] + 26; k < test_script_offset[i] + 30; k++)
+		{
+			sha256WriteByte(&hs, test_spend_tx[k]);
+		}
+	}
+	sha256FinishDouble(&hs);
+	writeHashToByteArray(hash_sequence, &hs, true);
+	// Outputs start after the last sequence number and the output count,
+	// and end before the locktime and hash type.
+	outputs_start = test_script_offset[num_inputs - 1] + 30 + 1;
+	sha256Begin(&hs);
+	for (k = outputs_start; k < test_spend_tx_length - 8; k++)
+	{
+		sha256WriteByte(&hs, test_spend_tx[k]);
+	}
+	sha256FinishDouble(&hs);
+	writeHashToByteArray(hash_outputs, &hs, true);
+	writeU32LittleEndian(amount, TEST_REF_AMOUNT + input);
+	writeU32LittleEndian(&(amount[4]), 0);
+
+	sha256Begin(&hs);
+	for (k = 0; k < 4; k++)
+	{
+		sha256WriteByte(&hs, test_spend_tx[k]); // version
+	}
+	for (k = 0; k < 32; k++)
+	{
+		sha256WriteByte(&hs, hash_prevouts[k]);
+	}
+	for (k = 0; k < 32; k++)
+	{
+		sha256WriteByte(&hs, hash_sequence[k]);
+	}
+	// Outpoint and script code.
+	for (k = test_script_offset[input] - 36; k < test_script_offset[input] + 26; k++)
+	{
+		sha256WriteByte(&hs, test_spend_tx[k]);
+	}
+	for (k = 0; k < 8; k++)
+	{
+		sha256WriteByte(&hs, amount[k]);
+	}
+	for (k = test_script_offset[input] + 26; k < test_script_offset[input] + 30; k++)
+	{
+		sha256WriteByte(&hs, test_spend_tx[k]); // sequence
+	}
+	for (k = 0; k < 32; k++)
+	{
+		sha256WriteByte(&hs, hash_outputs[k]);
+	}
+	// Locktime and hash type.
+	for (k = test_spend_tx_length - 8; k < test_spend_tx_length; k++)
+	{
+		sha256WriteByte(&hs, test_spend_tx[k]);
+	}
+	sha256FinishDouble(&hs);
+	writeHashToByteArray(sig_hash, &hs, false);
+}
+
+/** A test vector from BIP143. */
+struct Bip143TestStruct
+{
+	/** The unsigned transaction, as a hex string. */
+	const char *tx;
+	/** The input being signed. */
+	uint32_t input;
+	/** Script code of that input (including its length), as a hex string. */
+	const char *script_code;
+	/** Amount of that input, in satoshi. */
+	uint32_t amount;
+	/** Expected hashPrevouts, as a hex string. */
+	const char *hash_prevouts;
+	/** Expected hashSequence, as a hex string. */
+	const char *hash_sequence;
+	/** Expected hashOutputs, as a hex string. */
+	const char *hash_outputs;
+	/** Expected signature hash, as a big-endian hex string. */
+	const char *sig_hash;
+};
+
+/** The "native P2WPKH" and "P2SH-P2WPKH" examples from BIP143. */
+static const struct Bip143TestStruct bip143_tests[] = {
+{"0100000002fff7f7881a8099afa6940d42d1e7f6362bec38171ea3edf433541db4e4ad969f"
+ "0000000000eeffffffef51e1b804cc89d182d279655c3aa89e815b1b309fe287d9b2b55d57"
+ "b90ec68a0100000000ffffffff02202cb206000000001976a9148280b37df378db99f66f85"
+ "c95a783a76ac7a6d5988ac9093510d000000001976a9143bde42dbee7e4dbe6a21b2d50ce2"
+ "f0167faa815988ac11000000",
+ 1,
+ "1976a9141d0f172a0ecb48aee1be1f2687d2963ae33f71a188ac",
+ 600000000,
+ "96b827c8483d4e9b96712b6713a7b68d6e8003a781feba36c31143470b4efd37",
+ "52b0a642eea2fb7ae638c36f6252b6750293dbe574a806984b8e4d8548339a3b",
+ "863ef3e1a92afbfdb97f31ad0fc7683ee943e9abcf2501590ff8f6551f47e5e5",
+ "c37af31116d1b27caf68aae9e3ac82f1477929014d5b917657d0eb49478cb670"},
+{"0100000001db6b1b20aa0fd7b23880be2ecbd4a98130974cf4748fb66092ac4d3ceb1a5477"
+ "0100000000feffffff02b8b4eb0b000000001976a914a457b684d7f0d539a46a45bbc043f3"
+ "5b59d0d96388ac0008af2f000000001976a914fd270b1ee6abcaea97fea7ad0402e8bd8ad6"
+ "d77c88ac92040000",
+ 0,
+ "1976a91479091972186c449eb1ded22b78e40d009bdf008988ac",
+ 1000000000,
+ "b0287b4a252ac05af83d2dcef00ba313af78a3e9c329afa216eb3aa2a7b4613a",
+ "18606b350cd8bf565266bc352f0caddcf01e8fa789dd8a15386327cf8cabe198",
+ "de984f44532e2173ca0d64314fcefe6d30da6f8cf27bafa706da61df8a226c83",
+ "64f3b0f4dd2bb3aa1ce8566d220cc74dda9df97d8490cc81d89d735c92e59fb6"},
+};
+
+/** Convert a hex string to bytes.
+  * \param out The bytes will be written here. This must have space for
+  *            half as many bytes as there are characters in hex.
+  * \param hex The hex string.
+  * \return The number of bytes written.
+  */
+static uint32_t testFromHex(uint8_t *out, const char *hex)
+{
+	uint32_t length;
+	unsigned int value;
+
+	length = 0;
+	while ((hex[0] != '\0') && (hex[1] != '\0'))
+	{
+		sscanf(hex, "%02x", &value);
+		out[length++] = (uint8_t)value;
+		hex += 2;
+	}
+	return length;
+}
+
+/** Check one BIP143 test vector. The unsigned transaction is split up by
+  * hand and fed to the BIP143 cache functions, since the input transactions
+  * which would be needed to feed it to parseTransactionBip143() are not
+  * part of the test vector.
+  * \param test The test vector.
+  * \return false if the test passed, true if it failed.
+  */
+static bool testBip143Vector(const struct Bip143TestStruct *test)
+{
+	uint8_t tx[512];
+	uint8_t script_code[BIP143_MAX_SCRIPT_CODE_LENGTH + 1];
+	uint8_t expected[32];
+	uint8_t sig_hash[32];
+	Bip143Input inputs[4];
+	uint32_t tx_length;
+	uint32_t num_inputs;
+	uint32_t num_outputs;
+	uint32_t outputs_start;
+	uint32_t p;
+	uint32_t i;
+	bool failed;
+
+	tx_length = testFromHex(tx, test->tx);
+	bip143_inputs = inputs;
+	bip143_first_input = 0;
+	bip143_num_inputs = test->input + 1;
+	bip143_num_amounts = 0;
+	bip143Begin();
+
+	memcpy(bip143_version, tx, 4);
+	p = 4;
+	num_inputs = tx[p++];
+	for (i = 0; i < num_inputs; i++)
+	{
+		bip143WriteOutpoint(i, &(tx[p]), &(tx[p + 32]));
+		p += 36;
+		p += 1 + tx[p]; // skip script
+		bip143WriteSequence(i, &(tx[p]));
+		p += 4;
+	}
+	num_outputs = tx[p++];
+	outputs_start = p;
+	for (i = 0; i < num_outputs; i++)
+	{
+		p += 8;
+		p += 1 + tx[p];
+	}
+	for (i = outputs_start; i < p; i++)
+	{
+		sha256WriteByte(&bip143_outputs_hs, tx[i]);
+	}
+	memcpy(bip143_locktime, &(tx[p]), 4);
+	writeU32LittleEndian(bip143_hash_type, 1);
+
+	testFromHex(script_code, test->script_code);
+	inputs[test->input].script_code_length = script_code[0];
+	memcpy(inputs[test->input].script_code, &(script_code[1]), script_code[0]);
+	writeU32LittleEndian(inputs[test->input].amount, test->amount);
+	writeU32LittleEndian(&(inputs[test->input].amount[4]), 0);
+	bip143Finish();
+	bip143SigHash(sig_hash, test->input);
+
+	failed = false;
+	testFromHex(expected, test->hash_prevouts);
+	if (memcmp(bip143_hash_prevouts, expected, 32))
+	{
+		printf("hashPrevouts mismatch\n");
+		failed = true;
+	}
+	testFromHex(expected, test->hash_sequence);
+	if (memcmp(bip143_hash_sequence, expected, 32))
+	{
+		printf("hashSequence mismatch\n");
+		failed = true;
+	}
+	testFromHex(expected, test->hash_outputs);
+	if (memcmp(bip143_hash_outputs_digest, expected, 32))
+	{
+		printf("hashOutputs mismatch\n");
+		failed = true;
+	}
+	// sig_hash is little-endian.
+	testFromHex(expected, test->sig_hash);
+	swapEndian256(expected);
+	if (memcmp(sig_hash, expected, 32))
+	{
+		printf("Signature hash mismatch\n");
+		failed = true;
+	}
+	return failed;
+}
+
+/** Feed #test_spend_tx through the signature hash engine directly, so that
+  * it can be benchmarked without the rest of the transaction parser.
+  * \param sig_hash The signature hashes will be written here.
+  * \param num_inputs The number of inputs of #test_spend_tx.
+  */
+static void engineSigHash(uint8_t sig_hash[][32], uint32_t num_inputs)
+{
+	HashState shared_hs;
+	HashState hs_array[TEST_MAX_INPUTS];
+	uint32_t i;
+	uint32_t k;
+	uint32_t next_script;
+
+	sig_hash_shared_hs_ptr = &shared_hs;
+	for (i = 0; i < num_inputs; i++)
+	{
+		sig_hash_hs_ptr_array[i] = &hs_array[i];
+	}
+	sigHashBegin(0, num_inputs);
+	k = 0;
+	for (i = 0; i < num_inputs; i++)
+	{
+		next_script = test_script_offset[i];
+		for (; k < next_script; k++)
+		{
+			sigHashWriteByte(test_spend_tx[k]);
+		}
+		sigHashBeginScript(i);
+		for (; k < next_script + 26; k++)
+		{
+			sigHashWriteByte(test_spend_tx[k]);
+		}
+		sigHashEndScript();
+	}
+	for (; k < test_spend_tx_length; k++)
+	{
+		sigHashWriteByte(test_spend_tx[k]);
+	}
+	sigHashFinish(sig_hash);
+}
+
+int main(void)
+{
+	uint8_t sig_hash[TEST_MAX_INPUTS][32];
+	uint8_t expected_sig_hash[32];
+	uint8_t transaction_hash[32];
+	char change_address[TEXT_ADDRESS_LENGTH];
+	TransactionErrors r;
+	uint32_t num_inputs;
+	uint32_t first_input;
+	uint32_t window;
+	uint32_t window_size;
+	uint32_t i;
+	int rep;
+	int num_reps;
+	clock_t start;
+	double engine_time;
+	double reference_time;
+
+	initTests(__FILE__);
+	srand(42);
+	test_stream = malloc(TEST_MAX_INPUTS * 200 + 1000);
+	test_spend_tx = malloc(TEST_MAX_INPUTS * 100 + 1000);
+	memset(change_address, 0, sizeof(change_address));
+
+	// Check that the signature hash engine produces the same signature
+	// hashes as hashing each blanked transaction separately.
+	for (num_inputs = 1; num_inputs <= TEST_MAX_INPUTS; num_inputs++)
+	{
+		buildTestStream(num_inputs);
+		test_stream_ptr = 0;
+		r = parseTransaction(sig_hash, transaction_hash, test_stream_length, num_inputs, change_address);
+		if (r != TRANSACTION_NO_ERROR)
+		{
+			printf("parseTransaction() returned %d for %u inputs\n", (int)r, num_inputs);
+			reportFailure();
+			continue;
+		}
+		for (i = 0; i < num_inputs; i++)
+		{
+			referenceSigHash(expected_sig_hash, i, num_inputs);
+			if (memcmp(sig_hash[i], expected_sig_hash, 32))
+			{
+				printf("Signature hash mismatch for input %u of %u\n", i, num_inputs);
+				reportFailure();
+			}
+			else
+			{
+				reportSuccess();
+			}
+		}
+	}
+
+	// Check that signing one window of inputs at a time with
+	// parseTransactionWindow() gives the same signature hashes.
+	for (num_inputs = 1; num_inputs <= TEST_MAX_INPUTS; num_inputs += 9)
+	{
+		buildTestStream(num_inputs);
+		for (window = 1; window <= 16; window *= 4)
+		{
+			for (first_input = 0; first_input < num_inputs; first_input += window)
+			{
+				window_size = MIN(window, num_inputs - first_input);
+				test_stream_ptr = 0;
+				r = parseTransactionWindow(sig_hash, transaction_hash, test_stream_length, first_input, window_size, change_address);
+				if (r != TRANSACTION_NO_ERROR)
+				{
+					printf("parseTransactionWindow() returned %d for inputs %u to %u of %u\n", (int)r, first_input, first_input + window_size - 1, num_inputs);
+					reportFailure();
+					continue;
+				}
+				for (i = 0; i < window_size; i++)
+				{
+					referenceSigHash(expected_sig_hash, first_input + i, num_inputs);
+					if (memcmp(sig_hash[i], expected_sig_hash, 32))
+					{
+						printf("Signature hash mismatch for input %u of %u (window %u)\n", first_input + i, num_inputs, window);
+						reportFailure();
+					}
+					else
+					{
+						reportSuccess();
+					}
+				}
+			}
+		}
+	}
+
+	// Windows which run past the last input must be rejected, not padded
+	// out with made-up signature hashes.
+	buildTestStream(4);
+	for (first_input = 0; first_input <= 5; first_input++)
+	{
+		test_stream_ptr = 0;
+		r = parseTransactionWindow(sig_hash, transaction_hash, test_stream_length, first_input, 2, change_address);
+		if ((first_input + 2 <= 4) != (r == TRANSACTION_NO_ERROR))
+		{
+			printf("parseTransactionWindow() returned %d for inputs %u to %u of 4\n", (int)r, first_input, first_input + 1);
+			reportFailure();
+		}
+		else if ((r != TRANSACTION_NO_ERROR) && (r != TRANSACTION_INVALID_FORMAT))
+		{
+			printf("Out of range window gave %d, not TRANSACTION_INVALID_FORMAT\n", (int)r);
+			reportFailure();
+		}
+		else
+		{
+			reportSuccess();
+		}
+	}
+	test_stream_ptr = 0;
+	r = parseTransaction(sig_hash, transaction_hash, test_stream_length, 5, change_address);
+	if (r != TRANSACTION_INVALID_FORMAT)
+	{
+		printf("parseTransaction() with too many inputs returned %d\n", (int)r);
+		reportFailure();
+	}
+	else
+	{
+		reportSuccess();
+	}
+
+	// Check the BIP143 cache against the test vectors in BIP143.
+	for (i = 0; i < sizeof(bip143_tests) / sizeof(struct Bip143TestStruct); i++)
+	{
+		if (testBip143Vector(&(bip143_tests[i])))
+		{
+			printf("BIP143 test vector %u failed\n", i);
+			reportFailure();
+		}
+		else
+		{
+			reportSuccess();
+		}
+	}
+
+	// Check that parseTransactionBip143() produces the same signature
+	// hashes as building each BIP143 preimage from scratch.
+	for (num_inputs = 1; num_inputs <= TEST_MAX_INPUTS; num_inputs++)
+	{
+		buildTestStream(num_inputs);
+		test_stream_ptr = 0;
+		r = parseTransactionBip143(sig_hash, transaction_hash, test_stream_length, num_inputs, change_address);
+		if (r != TRANSACTION_NO_ERROR)
+		{
+			printf("parseTransactionBip143() returned %d for %u inputs\n", (int)r, num_inputs);
+			reportFailure();
+			continue;
+		}
+		for (i = 0; i < num_inputs; i++)
+		{
+			referenceBip143SigHash(expected_sig_hash, i, num_inputs);
+			if (memcmp(sig_hash[i], expected_sig_hash, 32))
+			{
+				printf("BIP143 signature hash mismatch for input %u of %u\n", i, num_inputs);
+				reportFailure();
+			}
+			else
+			{
+				reportSuccess();
+			}
+		}
+	}
+
+	// Benchmark the signature hash engine against hashing each input's
+	// version of the transaction separately, which is what the transaction
+	// parser used to do (one hash state per input, fed every byte).
+	printf("inputs  engine (ms)  one hash per input (ms)\n");
+	for (num_inputs = 1; num_inputs <= TEST_MAX_INPUTS; num_inputs *= 2)
+	{
+		num_reps = 2048 / num_inputs;
+		buildTestStream(num_inputs);
+		start = clock();
+		for (rep = 0; rep < num_reps; rep++)
+		{
+			engineSigHash(sig_hash, num_inputs);
+		}
+		engine_time = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC / num_reps;
+		start = clock();
+		for (rep = 0; rep < num_reps; rep++)
+		{
+			for (i = 0; i < num_inputs; i++)
+			{
+				referenceSigHash(expected_sig_hash, i, num_inputs);
+			}
+		}
+		reference_time = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC / num_reps;
+		printf("%6u  %11.3f  %23.3f\n", num_inputs, engine_time, reference_time);
+	}
 
+	free(test_stream);
+	free(test_spend_tx);
+	finishTests();
+
+	exit(0);
+}
+
+#endif // #ifdef TEST_TRANSACTION
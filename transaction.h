@@ -49,6 +49,8 @@ typedef enum TransactionErrorsEnum
 
 //extern TransactionErrors parseTransaction(uint8_t sig_hash[][32], BigNum256 transaction_hash, uint32_t length, uint32_t number_of_inputs, char *change_address);
 extern TransactionErrors parseTransaction(uint8_t sig_hash[][32], BigNum256 transaction_hash, uint32_t length, uint32_t number_of_inputs, char *change_address_ptr_original);
+extern TransactionErrors parseTransactionWindow(uint8_t sig_hash[][32], BigNum256 transaction_hash, uint32_t length, uint32_t first_input, uint32_t number_of_inputs, char *change_address_ptr_original);
+extern TransactionErrors parseTransactionBip143(uint8_t sig_hash[][32], BigNum256 transaction_hash, uint32_t length, uint32_t number_of_inputs, char *change_address_ptr_original);
 extern bool signTransaction(uint8_t *signature, uint8_t *out_length, BigNum256 sig_hash, BigNum256 private_key, bool add_hash_type);
 extern void swapEndian256(BigNum256 buffer);
 extern bool showTransactionData(void);
@@ -102,6 +102,52 @@ typedef struct WalletRecordStruct
 	struct WalletRecordEncryptedStruct encrypted;
 } WalletRecord;
 
+/** Number of wallet records which fit in non-volatile storage. The size of
+  * non-volatile storage is fixed at compile time (see #EEPROM_SIZE), so this
+  * doesn't need to be discovered at runtime. */
+#define NUM_WALLET_SLOTS		((EEPROM_SIZE - WALLET_START_ADDRESS) / sizeof(WalletRecord))
+
+/** Value of the magic field of a valid wallet directory. */
+#define WALLET_DIRECTORY_MAGIC	0x31445742
+
+/** Possible states of a wallet slot, as recorded in the wallet directory. */
+typedef enum DirectorySlotStateEnum
+{
+	/** The slot's version field is #VERSION_NOTHING_THERE. This is also the
+	  * state of a slot containing a hidden wallet. */
+	SLOT_EMPTY					= 0,
+	/** The slot's version field is #VERSION_UNENCRYPTED. */
+	SLOT_UNENCRYPTED			= 1,
+	/** The slot's version field is #VERSION_IS_ENCRYPTED. */
+	SLOT_ENCRYPTED				= 2,
+	/** The slot's version field is something else. The version field has
+	  * to be read from the wallet record to find out what it is. */
+	SLOT_OTHER					= 3
+} DirectorySlotState;
+
+/** Structure of the wallet directory, which is stored at
+  * #WALLET_DIRECTORY_ADDRESS.
+  *
+  * The directory only records what is already publicly visible in the
+  * unencrypted portion of each wallet record, so it never reveals the
+  * presence of a hidden wallet. It is allowed to claim that a slot is
+  * occupied when it isn't (e.g. if a deletion was interrupted), but it should
+  * never claim that an occupied slot is empty. Thus the directory is updated
+  * before a wallet record is created and after a wallet record is deleted.
+  * If the magic or checksum don't match, the directory is rebuilt from the
+  * version fields of the wallet records.
+  */
+typedef struct WalletDirectoryStruct
+{
+	/** Must be #WALLET_DIRECTORY_MAGIC. */
+	uint32_t magic;
+	/** State of each wallet slot, packed 4 slots to a byte. See
+	  * #DirectorySlotStateEnum for values. */
+	uint8_t slot_state[WALLET_DIRECTORY_LENGTH - sizeof(uint32_t) - CHECKSUM_LENGTH];
+	/** SHA-256 of everything except this. */
+	uint8_t checksum[CHECKSUM_LENGTH];
+} WalletDirectory;
+
 /** The most recent error to occur in a function in this file,
   * or #WALLET_NO_ERROR if no error occurred in the most recent function
   * call. See #WalletErrorsEnum for possible values. */
@@ -121,10 +167,20 @@ static WalletRecord current_wallet;
   * record is. If #wallet_loaded is false (i.e. no wallet is loaded), then the
   * contents of this variable are undefined. */
 static uint32_t wallet_nv_address;
-/** Cache of number of wallets that can fit in non-volatile storage. This will
-  * be 0 if a value hasn't been calculated yet. This is set by
-  * getNumberOfWallets(). */
-static uint32_t num_wallets;
+/** Cache of the wallet directory. This is only valid if
+  * #wallet_directory_loaded is true. */
+static WalletDirectory wallet_directory;
+/** Whether #wallet_directory contains a copy of the wallet directory. */
+static bool wallet_directory_loaded;
+
+/** Whether a restore of the wallet space has been started with
+  * beginWalletSpaceWrite(), but not finished or abandoned yet. */
+static bool wallet_space_write_active;
+/** Copy of the persistent entropy pool from before the current restore of
+  * the wallet space. Only valid if #restore_pool_saved is true. */
+static uint8_t restore_pool_state[ENTROPY_POOL_LENGTH];
+/** Whether #restore_pool_state is valid. */
+static bool restore_pool_saved;
 
 #ifdef TEST
 /** The file to perform test non-volatile I/O on. */
@@ -177,23 +233,15 @@ static bool suppress_set_entropy_pool;
 static void calculateWalletChecksum(uint8_t *hash)
 {
 	uint8_t *ptr;
-	unsigned int i;
+	uint32_t after_checksum;
 	HashState hs;
 
 	sha256Begin(&hs);
 	ptr = (uint8_t *)&current_wallet;
-	for (i = 0; i < sizeof(WalletRecord); i++)
-	{
-		// Skip checksum when calculating the checksum.
-		if (i == offsetof(WalletRecord, encrypted.checksum))
-		{
-			i += sizeof(current_wallet.encrypted.checksum);
-		}
-		if (i < sizeof(WalletRecord))
-		{
-			sha256WriteByte(&hs, ptr[i]);
-		}
-	}
+	// Skip checksum when calculating the checksum.
+	after_checksum = offsetof(WalletRecord, encrypted.checksum) + sizeof(current_wallet.encrypted.checksum);
+	sha256WriteBytes(&hs, ptr, offsetof(WalletRecord, encrypted.checksum));
+	sha256WriteBytes(&hs, &(ptr[after_checksum]), sizeof(WalletRecord) - after_checksum);
 	sha256Finish(&hs);
 	writeHashToByteArray(hash, &hs, true);
 }
@@ -253,6 +301,166 @@ static WalletErrors writeCurrentWalletRecord(uint32_t address)
 	return WALLET_NO_ERROR;
 }
 
+/** Convert the version field of a wallet record into the state which the
+  * wallet directory records for it.
+  * \param version The version field. See #WalletVersion.
+  * \return See #DirectorySlotStateEnum.
+  */
+static DirectorySlotState versionToSlotState(uint32_t version)
+{
+	if (version == VERSION_NOTHING_THERE)
+	{
+		return SLOT_EMPTY;
+	}
+	else if (version == VERSION_UNENCRYPTED)
+	{
+		return SLOT_UNENCRYPTED;
+	}
+	else if (version == VERSION_IS_ENCRYPTED)
+	{
+		return SLOT_ENCRYPTED;
+	}
+	else
+	{
+		return SLOT_OTHER;
+	}
+}
+
+/** Get the state of a wallet slot from #wallet_directory.
+  * \param wallet_spec The wallet number of the slot.
+  * \return See #DirectorySlotStateEnum.
+  */
+static DirectorySlotState getSlotState(uint32_t wallet_spec)
+{
+	return (DirectorySlotState)((wallet_directory.slot_state[wallet_spec >> 2] >> ((wallet_spec & 3) << 1)) & 3);
+}
+
+/** Set the state of a wallet slot in #wallet_directory. This only changes the
+  * cached copy; use writeWalletDirectory() to store it.
+  * \param wallet_spec The wallet number of the slot.
+  * \param state See #DirectorySlotStateEnum.
+  */
+static void setSlotState(uint32_t wallet_spec, DirectorySlotState state)
+{
+	uint8_t shift;
+
+	shift = (uint8_t)((wallet_spec & 3) << 1);
+	wallet_directory.slot_state[wallet_spec >> 2] &= (uint8_t)~(3 << shift);
+	wallet_directory.slot_state[wallet_spec >> 2] |= (uint8_t)(state << shift);
+}
+
+/** Calculate the checksum (SHA-256 hash) of #wallet_directory.
+  * \param hash The resulting SHA-256 hash will be written here. This must
+  *             be a byte array with space for #CHECKSUM_LENGTH bytes.
+  */
+static void calculateDirectoryChecksum(uint8_t *hash)
+{
+	HashState hs;
+
+	sha256Begin(&hs);
+	sha256WriteBytes(&hs, (uint8_t *)&wallet_directory, offsetof(WalletDirectory, checksum));
+	sha256Finish(&hs);
+	writeHashToByteArray(hash, &hs, true);
+}
+
+/** Store the contents of #wallet_directory into non-volatile memory.
+  * \return See #WalletErrors.
+  */
+static WalletErrors writeWalletDirectory(void)
+{
+	wallet_directory.magic = WALLET_DIRECTORY_MAGIC;
+	calculateDirectoryChecksum(wallet_directory.checksum);
+	if ((nonVolatileWrite((uint8_t *)&wallet_directory, WALLET_DIRECTORY_ADDRESS, sizeof(wallet_directory)) != NV_NO_ERROR)
+		|| (nonVolatileFlush() != NV_NO_ERROR))
+	{
+		return WALLET_WRITE_ERROR;
+	}
+	return WALLET_NO_ERROR;
+}
+
+/** Make sure #wallet_directory is loaded. If the copy in non-volatile memory
+  * is not valid, this will rebuild it by reading the version field of every
+  * wallet record, then write the rebuilt directory back.
+  * \return See #WalletErrors.
+  */
+static WalletErrors loadWalletDirectory(void)
+{
+	uint8_t hash[CHECKSUM_LENGTH];
+	uint32_t version;
+	uint32_t i;
+
+	if (wallet_directory_loaded)
+	{
+		return WALLET_NO_ERROR;
+	}
+	if ((sizeof(wallet_directory) != WALLET_DIRECTORY_LENGTH)
+		|| ((sizeof(wallet_directory.slot_state) * 4) < NUM_WALLET_SLOTS))
+	{
+		return WALLET_INVALID_OPERATION;
+	}
+
+	if (nonVolatileRead((uint8_t *)&wallet_directory, WALLET_DIRECTORY_ADDRESS, sizeof(wallet_directory)) != NV_NO_ERROR)
+	{
+		return WALLET_READ_ERROR;
+	}
+	calculateDirectoryChecksum(hash);
+	if ((wallet_directory.magic == WALLET_DIRECTORY_MAGIC)
+		&& (bigCompareVariableSize(wallet_directory.checksum, hash, CHECKSUM_LENGTH) == BIGCMP_EQUAL))
+	{
+		wallet_directory_loaded = true;
+		return WALLET_NO_ERROR;
+	}
+
+	// Directory is missing or corrupted; rebuild it. Only version fields need
+	// to be read, so nothing is decrypted.
+	memset(&wallet_directory, 0, sizeof(wallet_directory));
+	for (i = 0; i < NUM_WALLET_SLOTS; i++)
+	{
+		if (nonVolatileRead((uint8_t *)&version, WALLET_START_ADDRESS + i * sizeof(WalletRecord) + offsetof(WalletRecord, unencrypted.version), sizeof(version)) != NV_NO_ERROR)
+		{
+			return WALLET_READ_ERROR;
+		}
+		setSlotState(i, versionToSlotState(version));
+	}
+	if (writeWalletDirectory() != WALLET_NO_ERROR)
+	{
+		return WALLET_WRITE_ERROR;
+	}
+	wallet_directory_loaded = true;
+	return WALLET_NO_ERROR;
+}
+
+/** Record a new version for a wallet slot in the wallet directory. Nothing
+  * will be written to non-volatile memory if the directory already has the
+  * right state for the slot.
+  * \param wallet_spec The wallet number of the slot.
+  * \param version The new version field of the slot. See #WalletVersion.
+  * \return See #WalletErrors.
+  */
+static WalletErrors updateWalletDirectory(uint32_t wallet_spec, uint32_t version)
+{
+	WalletErrors r;
+	DirectorySlotState state;
+
+	r = loadWalletDirectory();
+	if (r != WALLET_NO_ERROR)
+	{
+		return r;
+	}
+	state = versionToSlotState(version);
+	if (getSlotState(wallet_spec) != state)
+	{
+		setSlotState(wallet_spec, state);
+		r = writeWalletDirectory();
+		if (r != WALLET_NO_ERROR)
+		{
+			// Cached copy no longer matches what is in non-volatile memory.
+			wallet_directory_loaded = false;
+		}
+	}
+	return r;
+}
+
 /** Using the specified password and UUID (as the salt), derive an encryption
   * key and begin using it.
   *
@@ -305,11 +513,7 @@ WalletErrors initWallet(uint32_t wallet_spec, const uint8_t *password, const uns
 		return last_error; // propagate error code
 	}
 
-	if (getNumberOfWallets() == 0)
-	{
-		return last_error; // propagate error code
-	}
-	if (wallet_spec >= num_wallets)
+	if (wallet_spec >= NUM_WALLET_SLOTS)
 	{
 		last_error = WALLET_INVALID_WALLET_NUM;
 		return last_error;
@@ -364,80 +568,180 @@ WalletErrors initWallet(uint32_t wallet_spec, const uint8_t *password, const uns
 	return last_error;
 }
 
-uint32_t readEntireWalletSpace(uint8_t *bulkDataOut)
+/** Get the size of the wallet space. The wallet space is the part of
+  * non-volatile storage which is backed up by GetBulk and restored by
+  * SetBulk: everything from the persistent entropy pool to the end of the
+  * last wallet record. It doesn't include the wallet directory, which is
+  * rebuilt after a restore.
+  * \return The size of the wallet space, in number of bytes. This is a
+  *         multiple of 16.
+  */
+uint32_t getWalletSpaceSize(void)
 {
-	uint32_t wallet_space_size = 0;
-	uint32_t rest_offset = 0;
+	return (uint32_t)(NUM_WALLET_SLOTS * sizeof(WalletRecord)) + (WALLET_START_ADDRESS - ENTROPY_POOL_ADDRESS);
+}
 
-	if (uninitWallet() != WALLET_NO_ERROR)
+/** Read part of the wallet space (see getWalletSpaceSize()). This doesn't
+  * need a wallet to be loaded.
+  * \param out The bytes will be written here. This must have space for
+  *            length bytes.
+  * \param offset Offset into the wallet space of the first byte to read.
+  * \param length Number of bytes to read.
+  * \return See #WalletErrors.
+  */
+WalletErrors readWalletSpace(uint8_t *out, uint32_t offset, uint32_t length)
+{
+	if ((offset > getWalletSpaceSize()) || (length > (getWalletSpaceSize() - offset)))
 	{
-		writeEinkDisplay(">unload error", false, 10, 10, "",false,0,0, "",false,0,0, "",false,0,0, "",false,0,0);
+		last_error = WALLET_INVALID_OPERATION;
+		return last_error;
 	}
-
-	if (getNumberOfWallets() == 0)
+	if (nonVolatileRead(out, ENTROPY_POOL_ADDRESS + offset, length) != NV_NO_ERROR)
 	{
-		writeEinkDisplay(">no wallets error", false, 10, 10, "",false,0,0, "",false,0,0, "",false,0,0, "",false,0,0);
+		last_error = WALLET_READ_ERROR;
+		return last_error;
 	}
+	last_error = WALLET_NO_ERROR;
+	return last_error;
+}
 
-//	writeEinkDisplayNumberSingleBig(sizeof(WalletRecord),5,40);
-
-
-//	rest_offset = ENTROPY_POOL_LENGTH + POOL_CHECKSUM_LENGTH + DEVICE_UUID_LENGTH + DEVICE_LANG_LENGTH + DEVICE_LANG_SET_LENGTH + DEVICE_COMMS_SET_LENGTH + IS_FORMATTED_LENGTH + PIN_LENGTH + HAS_PIN_LENGTH + SETUP_TYPE_LENGTH + WRONG_TRANSACTION_PIN_COUNT_LENGTH + WRONG_DEVICE_PIN_COUNT_LENGTH ;
-	rest_offset = ENTROPY_POOL_LENGTH + POOL_CHECKSUM_LENGTH + DEVICE_UUID_LENGTH + DEVICE_LANG_LENGTH + DEVICE_LANG_SET_LENGTH + DEVICE_COMMS_SET_LENGTH + IS_FORMATTED_LENGTH + PIN_LENGTH + HAS_PIN_LENGTH + SETUP_TYPE_LENGTH + WRONG_TRANSACTION_PIN_COUNT_LENGTH + WRONG_DEVICE_PIN_COUNT_LENGTH + AEM_USE_LENGTH + AEM_PHRASE_LENGTH;
-//	writeEinkDisplayNumberSingleBig(num_wallets,5,40);
-
-	wallet_space_size = (num_wallets * sizeof(WalletRecord)) + rest_offset;
-//	writeEinkDisplayNumberSingleBig(wallet_space_size,5,40);
+/** Get ready to overwrite the wallet space (see getWalletSpaceSize()) using
+  * writeWalletSpace(). This unloads the current wallet and saves a copy of
+  * the persistent entropy pool, so that abortWalletSpaceWrite() can put it
+  * back if the restore fails.
+  * \return See #WalletErrors.
+  */
+WalletErrors beginWalletSpaceWrite(void)
+{
+	if (uninitWallet() != WALLET_NO_ERROR)
+	{
+		writeEinkDisplay(">unload error", false, 10, 10, "",false,0,0, "",false,0,0, "",false,0,0, "",false,0,0);
+	}
 
+	writeEinkDisplay(">wallet data writing", false, 10, 10, "",false,0,0, "",false,0,0, "",false,0,0, "",false,0,0);
 
-	writeEinkDisplay(">wallet data reading", false, 10, 10, "",false,0,0, "",false,0,0, "",false,0,0, "",false,0,0);
+	restore_pool_saved = !getEntropyPool(restore_pool_state);
+	wallet_space_write_active = true;
+	last_error = WALLET_NO_ERROR;
+	return last_error;
+}
 
-	if (nonVolatileRead(bulkDataOut, ENTROPY_POOL_ADDRESS, wallet_space_size) != NV_NO_ERROR)
+/** Write part of the wallet space (see getWalletSpaceSize()). The write goes
+  * through the non-volatile write cache, so consecutive chunks are committed
+  * a whole flash page at a time. beginWalletSpaceWrite() must be called
+  * before the first chunk and finishWalletSpaceWrite() after the last one.
+  * \param in The bytes to write.
+  * \param offset Offset into the wallet space of the first byte to write.
+  * \param length Number of bytes to write.
+  * \return See #WalletErrors.
+  */
+WalletErrors writeWalletSpace(uint8_t *in, uint32_t offset, uint32_t length)
+{
+	if (!wallet_space_write_active
+		|| (offset > getWalletSpaceSize()) || (length > (getWalletSpaceSize() - offset)))
 	{
-		last_error = WALLET_READ_ERROR;
-		writeEinkDisplay(">read error", false, 10, 10, "",false,0,0, "",false,0,0, "",false,0,0, "",false,0,0);
+		last_error = WALLET_INVALID_OPERATION;
+		return last_error;
 	}
-
-	writeEinkDisplay(">wallet data read...", false, 10, 10, "",false,0,0, "",false,0,0, "",false,0,0, "",false,0,0);
-	return wallet_space_size;
+	if (nonVolatileWrite(in, ENTROPY_POOL_ADDRESS + offset, length) != NV_NO_ERROR)
+	{
+		last_error = WALLET_WRITE_ERROR;
+		writeEinkDisplay(">write error", false, 10, 10, "",false,0,0, "",false,0,0, "",false,0,0, "",false,0,0);
+		return last_error;
+	}
+	last_error = WALLET_NO_ERROR;
+	return last_error;
 }
 
-uint32_t writeEntireWalletSpace(uint8_t *bulkDataIn)
+/** Invalidate the wallet directory in non-volatile memory, since it probably
+  * won't match the wallet records after the wallet space has been
+  * overwritten. It will be rebuilt the next time it's needed.
+  * \return See #WalletErrors.
+  */
+static WalletErrors invalidateWalletDirectory(void)
 {
-	uint8_t encrypty[16]={1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1};
-	decryptStream(bulkDataIn, encrypty);
-
-	uint32_t wallet_space_size = 0;
-	uint32_t rest_offset = 0;
-
-	if (uninitWallet() != WALLET_NO_ERROR)
+	memset(&wallet_directory, 0, sizeof(wallet_directory));
+	wallet_directory_loaded = false;
+	if (nonVolatileWrite((uint8_t *)&wallet_directory, WALLET_DIRECTORY_ADDRESS, sizeof(wallet_directory)) != NV_NO_ERROR)
 	{
-		writeEinkDisplay(">unload error", false, 10, 10, "",false,0,0, "",false,0,0, "",false,0,0, "",false,0,0);
+		return WALLET_WRITE_ERROR;
 	}
+	return WALLET_NO_ERROR;
+}
 
-	if (getNumberOfWallets() == 0)
+/** Commit a restored wallet space to non-volatile storage and restart the
+  * device, so that nothing derived from the old contents is still in RAM.
+  * On real hardware, this doesn't return.
+  * \return See #WalletErrors.
+  */
+WalletErrors finishWalletSpaceWrite(void)
+{
+	wallet_space_write_active = false;
+	memset(restore_pool_state, 0, sizeof(restore_pool_state));
+	if ((invalidateWalletDirectory() != WALLET_NO_ERROR)
+		|| (nonVolatileFlush() != NV_NO_ERROR))
 	{
-		writeEinkDisplay(">no wallets error", false, 10, 10, "",false,0,0, "",false,0,0, "",false,0,0, "",false,0,0);
+		last_error = WALLET_WRITE_ERROR;
+		writeEinkDisplay(">write error", false, 10, 10, "",false,0,0, "",false,0,0, "",false,0,0, "",false,0,0);
+	}
+	else
+	{
+		last_error = WALLET_NO_ERROR;
 	}
 
-//	rest_offset = ENTROPY_POOL_LENGTH + POOL_CHECKSUM_LENGTH + DEVICE_UUID_LENGTH + DEVICE_LANG_LENGTH + DEVICE_LANG_SET_LENGTH + DEVICE_COMMS_SET_LENGTH + IS_FORMATTED_LENGTH + PIN_LENGTH + HAS_PIN_LENGTH + SETUP_TYPE_LENGTH + WRONG_TRANSACTION_PIN_COUNT_LENGTH + WRONG_DEVICE_PIN_COUNT_LENGTH ;
-	rest_offset = ENTROPY_POOL_LENGTH + POOL_CHECKSUM_LENGTH + DEVICE_UUID_LENGTH + DEVICE_LANG_LENGTH + DEVICE_LANG_SET_LENGTH + DEVICE_COMMS_SET_LENGTH + IS_FORMATTED_LENGTH + PIN_LENGTH + HAS_PIN_LENGTH + SETUP_TYPE_LENGTH + WRONG_TRANSACTION_PIN_COUNT_LENGTH + WRONG_DEVICE_PIN_COUNT_LENGTH + AEM_USE_LENGTH + AEM_PHRASE_LENGTH;
-
-	wallet_space_size = (num_wallets * sizeof(WalletRecord)) + rest_offset;
-//	writeEinkDisplayNumberSingleBig(wallet_space_size,5,40);
+	writeEinkDisplay(">wallet data set", false, 10, 10, "",false,10,25, "RESTARTING",false,10,40, "",false,0,0, "",false,0,0);
+	Software_Reset();
+	return last_error;
+}
 
+/** Abandon a restore which was started with beginWalletSpaceWrite(). Part of
+  * the wallet space may already have been overwritten (either in the write
+  * cache or in non-volatile memory), and a partially restored wallet space
+  * must never be committed. So the entire wallet space is erased, as
+  * sanitiseNonVolatileStorage() would, leaving the device unformatted. The
+  * persistent entropy pool saved by beginWalletSpaceWrite() is kept.
+  *
+  * This does nothing if no restore is in progress. Otherwise, it restarts
+  * the device afterwards; on real hardware, it then doesn't return.
+  * \return See #WalletErrors.
+  */
+WalletErrors abortWalletSpaceWrite(void)
+{
+	if (!wallet_space_write_active)
+	{
+		last_error = WALLET_NO_ERROR;
+		return last_error;
+	}
+	wallet_space_write_active = false;
 
-	writeEinkDisplay(">wallet data writing", false, 10, 10, "",false,0,0, "",false,0,0, "",false,0,0, "",false,0,0);
+	writeEinkDisplay(">restore failed", false, 10, 10, "ERASING",false,10,25, "",false,0,0, "",false,0,0, "",false,0,0);
 
-	if (nonVolatileWrite(bulkDataIn, ENTROPY_POOL_ADDRESS, wallet_space_size) != NV_NO_ERROR)
+	// sanitiseNonVolatileStorage() needs a valid entropy pool, and the
+	// restored one may be incomplete.
+	if (restore_pool_saved)
+	{
+		setEntropyPool(restore_pool_state);
+	}
+	memset(restore_pool_state, 0, sizeof(restore_pool_state));
+	if (sanitiseNonVolatileStorage(ENTROPY_POOL_ADDRESS, ENTROPY_POOL_ADDRESS + getWalletSpaceSize(), NULL) != WALLET_NO_ERROR)
+	{
+		// Couldn't get random data; at least make sure that nothing of the
+		// partial restore remains.
+		nonVolatileFill(ENTROPY_POOL_ADDRESS, getWalletSpaceSize(), 0x00, NULL, NULL);
+	}
+	if ((invalidateWalletDirectory() != WALLET_NO_ERROR)
+		|| (nonVolatileFlush() != NV_NO_ERROR))
 	{
 		last_error = WALLET_WRITE_ERROR;
-		writeEinkDisplay(">write error", false, 10, 10, "",false,0,0, "",false,0,0, "",false,0,0, "",false,0,0);
+	}
+	else
+	{
+		last_error = WALLET_NO_ERROR;
 	}
 
-	writeEinkDisplay(">wallet data set", false, 10, 10, "",false,10,25, "RESTARTING",false,10,40, "",false,0,0, "",false,0,0);
+	writeEinkDisplay(">restore failed", false, 10, 10, "",false,10,25, "RESTARTING",false,10,40, "",false,0,0, "",false,0,0);
 	Software_Reset();
-	return wallet_space_size;
+	return last_error;
 }
 
 
@@ -475,22 +779,35 @@ WalletErrors uninitWallet(void)
 void logVersionFieldWrite(uint32_t address);
 #endif // #ifdef TEST_WALLET
 
+/** Source for nonVolatileFill() which takes bytes from a random number
+  * generation session.
+  * \param buffer See #NonVolatileFillSource.
+  * \param length See #NonVolatileFillSource.
+  * \param arg The #RandomSession to take bytes from.
+  */
+static void fillFromRandomSession(uint8_t *buffer, uint32_t length, void *arg)
+{
+	randomSessionGetBytes((RandomSession *)arg, buffer, length);
+}
+
 /** Sanitise (clear) a selected area of non-volatile storage. This will clear
   * the area between start (inclusive) and end (exclusive).
   * \param start The first address which will be cleared.
   * \param end One byte past the last address which will be cleared.
+  * \param progress If not NULL, this will be called at the start of each
+  *                 pass, to report progress.
   * \return #WALLET_NO_ERROR on success, or one of #WalletErrorsEnum if an
   *         error occurred. This will still return #WALLET_NO_ERROR even if
   *         end is an address beyond the end of the non-volatile storage area.
   *         This is done so that using start = 0 and end = 0xffffffff will
   *         clear the entire non-volatile storage area.
   */
-WalletErrors sanitiseNonVolatileStorage(uint32_t start, uint32_t end, bool quiet, int lang)
+WalletErrors sanitiseNonVolatileStorage(uint32_t start, uint32_t end, SanitiseProgressFunction progress)
 {
 	uint8_t buffer[32];
 	uint8_t pool_state[ENTROPY_POOL_LENGTH];
+	RandomSession random_session;
 	uint32_t address;
-	uint32_t remaining;
 	NonVolatileReturn r;
 	uint8_t pass;
 
@@ -499,6 +816,16 @@ WalletErrors sanitiseNonVolatileStorage(uint32_t start, uint32_t end, bool quiet
 		last_error = WALLET_RNG_FAILURE;
 		return last_error;
 	}
+	// The cached wallet directory may be about to become stale. If the
+	// selected area includes the wallet directory, the directory will be
+	// rebuilt when it is next loaded. Otherwise, the caller is responsible
+	// for updating it (see deleteWallet()).
+	wallet_directory_loaded = false;
+
+	if (end > EEPROM_SIZE)
+	{
+		end = EEPROM_SIZE;
+	}
 
 	// 4 pass format: all 0s, all 1s, random, random. This ensures that
 	// every bit is cleared at least once, set at least once and ends up
@@ -506,94 +833,52 @@ WalletErrors sanitiseNonVolatileStorage(uint32_t start, uint32_t end, bool quiet
 	// It is crucial that the last pass is random for two reasons:
 	// 1. A new device UUID is written, if necessary.
 	// 2. Hidden wallets are actually plausibly deniable.
-	for (pass = 0; pass < 4; pass++)
+	// Each pass is done by nonVolatileFill(), which works in whole flash
+	// pages and commits the pass before returning.
+	for (pass = 0; (pass < 4) && (start < end); pass++)
 	{
-		if(!quiet)
+		if (progress != NULL)
 		{
-			char passPrt[16];
-			sprintf(passPrt,"%lu", pass*25);
-//			writeEinkDisplay("pre bINAPD", false, COL_1_X, LINE_1_Y, "",false,5,30, "",false,5,50, "",false,5,70, "",false,0,0);
-			buttonInterjectionNoAckPlusData(ASKUSER_FORMAT_WITH_PROGRESS, passPrt, lang);
-//			writeEinkDisplay("post bINAPD", false, COL_1_X, LINE_1_Y, "",false,5,30, "",false,5,50, "",false,5,70, "",false,0,0);
-
-//			initDisplay();
-//			overlayBatteryStatus(BATT_VALUE_DISPLAY);
-//			writeEinkNoDisplay("INITIAL SETUP",  COL_1_X, LINE_1_Y, "FORMATTING",COL_1_X,LINE_2_Y, "",COL_1_X,LINE_3_Y, "",23,LINE_3_Y, "",25,80);
-//			writeUnderline(STRIPE_X_START, STRIPE_Y_START, STRIPE_X_END, STRIPE_Y_END);
-//			writeEinkNoDisplaySingleBig(passPrt,COL_1_X,LINE_3_Y);
-//			writeEinkNoDisplaySingleBig("%",39,LINE_3_Y);
-//			display();
+			progress((uint8_t)(pass * 25));
 		}
-
-		address = start;
-		while (address < end)
+		if (pass == 0)
 		{
-			if (pass == 0)
-			{
-				memset(buffer, 0, sizeof(buffer));
-			}
-			else if (pass == 1)
-			{
-				memset(buffer, 0xff, sizeof(buffer));
-			}
-			else
+			r = nonVolatileFill(start, end - start, 0x00, NULL, NULL);
+		}
+		else if (pass == 1)
+		{
+			r = nonVolatileFill(start, end - start, 0xff, NULL, NULL);
+		}
+		else
+		{
+			// Each random pass is generated by its own session, which is
+			// seeded once (using a RAM copy of the persistent entropy pool,
+			// since the pool itself may be in the selected area).
+			if (randomSessionBeginTemporaryPool(&random_session, pool_state))
 			{
-				if (getRandom256TemporaryPool(buffer, pool_state))
-				{
-					// Before returning, attempt to write the persistent
-					// entropy pool state back into non-volatile memory.
-					// The return value of setEntropyPool() is ignored because
-					// if a failure occurs, then WALLET_RNG_FAILURE is a
-					// suitable return value anyway.
+				// Before returning, attempt to write the persistent
+				// entropy pool state back into non-volatile memory.
+				// The return value of setEntropyPool() is ignored because
+				// if a failure occurs, then WALLET_RNG_FAILURE is a
+				// suitable return value anyway.
 #ifdef TEST_WALLET
-					if (!suppress_set_entropy_pool)
+				if (!suppress_set_entropy_pool)
 #endif // #ifdef TEST_WALLET
-					{
-						setEntropyPool(pool_state);
-					}
-					last_error = WALLET_RNG_FAILURE;
-					return last_error;
-				}
-			}
-			remaining = end - address;
-			if (remaining > 32)
-			{
-				remaining = 32;
-			}
-			if (remaining > 0)
-			{
-				r = nonVolatileWrite(buffer, address, remaining);
-				if (r == NV_INVALID_ADDRESS)
-				{
-					// Got to end of non-volatile memory.
-					break;
-				}
-				else if (r != NV_NO_ERROR)
 				{
-					last_error = WALLET_WRITE_ERROR;
-					return last_error;
+					setEntropyPool(pool_state);
 				}
+				last_error = WALLET_RNG_FAILURE;
+				return last_error;
 			}
-			if (address <= (0xffffffff - 32))
-			{
-				address += 32;
-			}
-			else
-			{
-				// Overflow in address will occur.
-				break;
-			}
-		} // end while (address < end)
-
-		// After each pass, flush write buffers to ensure that
-		// non-volatile memory is actually overwritten.
-		r = nonVolatileFlush();
+			r = nonVolatileFill(start, end - start, 0, fillFromRandomSession, &random_session);
+			randomSessionEnd(&random_session);
+		}
 		if (r != NV_NO_ERROR)
 		{
 			last_error = WALLET_WRITE_ERROR;
 			return last_error;
 		}
-	} // end for (pass = 0; pass < 4; pass++)
+	} // end for (pass = 0; (pass < 4) && (start < end); pass++)
 
 #ifdef TEST_WALLET
 	if (!suppress_set_entropy_pool)
@@ -713,11 +998,7 @@ WalletErrors deleteWallet(uint32_t wallet_spec)
 {
 	uint32_t address;
 
-	if (getNumberOfWallets() == 0)
-	{
-		return last_error; // propagate error code
-	}
-	if (wallet_spec >= num_wallets)
+	if (wallet_spec >= NUM_WALLET_SLOTS)
 	{
 		last_error = WALLET_INVALID_WALLET_NUM;
 		return last_error;
@@ -729,7 +1010,13 @@ WalletErrors deleteWallet(uint32_t wallet_spec)
 		return last_error; // propagate error code
 	}
 	address = WALLET_START_ADDRESS + wallet_spec * sizeof(WalletRecord);
-	last_error = sanitiseNonVolatileStorage(address, address + sizeof(WalletRecord), true, 0);
+	last_error = sanitiseNonVolatileStorage(address, address + sizeof(WalletRecord), NULL);
+	if (last_error == WALLET_NO_ERROR)
+	{
+		// This won't write anything if the slot contained a hidden wallet,
+		// since the directory will already say the slot is empty.
+		last_error = updateWalletDirectory(wallet_spec, VERSION_NOTHING_THERE);
+	}
 	return last_error;
 }
 
@@ -758,8 +1045,7 @@ WalletErrors newWallet(uint32_t wallet_spec, uint8_t *name, bool use_seed, uint8
 {
 
 
-	uint8_t random_buffer[32];
-	uint8_t uuid[DEVICE_UUID_LENGTH];
+	RandomSession random_session;
 	WalletErrors r;
 
 //	writeEinkDisplay("In newWallet", false, COL_1_X, LINE_1_Y, "",false,5,30, "",false,5,50, "",false,5,70, "",false,0,0);
@@ -771,11 +1057,7 @@ WalletErrors newWallet(uint32_t wallet_spec, uint8_t *name, bool use_seed, uint8
 		return last_error; // propagate error code
 	}
 
-	if (getNumberOfWallets() == 0)
-	{
-		return last_error; // propagate error code
-	}
-	if (wallet_spec >= num_wallets)
+	if (wallet_spec >= NUM_WALLET_SLOTS)
 	{
 		last_error = WALLET_INVALID_WALLET_NUM;
 		return last_error;
@@ -795,25 +1077,32 @@ WalletErrors newWallet(uint32_t wallet_spec, uint8_t *name, bool use_seed, uint8
 		return last_error;
 	}
 
-	if (make_hidden)
+	// Generate everything random which the new wallet needs up front, from
+	// one session, so that the HWRNG and the persistent entropy pool are
+	// only accessed once. Everything goes straight into current_wallet, so
+	// the only copy is the one which the error paths below wipe.
+	if (randomSessionBegin(&random_session))
+	{
+		last_error = WALLET_RNG_FAILURE;
+		return last_error;
+	}
+	if (!make_hidden)
 	{
 		// The creation of a hidden wallet is supposed to be discreet, so
-		// all unencrypted fields should be left untouched. This forces us to
-		// use the existing UUID.
-		memcpy(uuid, current_wallet.unencrypted.uuid, DEVICE_UUID_LENGTH);
+		// all unencrypted fields should be left untouched. This forces
+		// hidden wallets to use the existing UUID.
+		randomSessionGetBytes(&random_session, current_wallet.unencrypted.uuid, DEVICE_UUID_LENGTH);
 	}
-	else
+	randomSessionGetBytes(&random_session, current_wallet.encrypted.padding, sizeof(current_wallet.encrypted.padding));
+	if (!use_seed)
 	{
-		// Generate wallet UUID now, because it is needed to derive the wallet
-		// encryption key.
-		if (getRandom256(random_buffer))
-		{
-			last_error = WALLET_RNG_FAILURE;
-			return last_error;
-		}
-		memcpy(uuid, random_buffer, DEVICE_UUID_LENGTH);
+		randomSessionGetBytes(&random_session, current_wallet.encrypted.seed, SEED_LENGTH);
 	}
-	deriveAndSetEncryptionKey(uuid, password, password_length);
+	randomSessionEnd(&random_session);
+
+	// Use the wallet UUID now, because it is needed to derive the wallet
+	// encryption key.
+	deriveAndSetEncryptionKey(current_wallet.unencrypted.uuid, password, password_length);
 
 	// Update unencrypted fields of current_wallet.
 	if (!make_hidden)
@@ -821,22 +1110,17 @@ WalletErrors newWallet(uint32_t wallet_spec, uint8_t *name, bool use_seed, uint8
 		r = updateWalletVersion();
 		if (r != WALLET_NO_ERROR)
 		{
+			uninitWallet();
 			last_error = r;
 			return last_error;
 		}
 		memset(current_wallet.unencrypted.reserved, 0, sizeof(current_wallet.unencrypted.reserved));
 		memcpy(current_wallet.unencrypted.name, name, NAME_LENGTH);
-		memcpy(current_wallet.unencrypted.uuid, uuid, DEVICE_UUID_LENGTH);
 	}
 
-	// Update encrypted fields of current_wallet.
+	// Update encrypted fields of current_wallet. The padding was filled in
+	// above.
 	current_wallet.encrypted.num_addresses = 0;
-	if (getRandom256(random_buffer))
-	{
-		last_error = WALLET_RNG_FAILURE;
-		return last_error;
-	}
-	memcpy(current_wallet.encrypted.padding, random_buffer, sizeof(current_wallet.encrypted.padding));
 
 	if(transaction_pin_used_param)
 	{
@@ -864,26 +1148,25 @@ WalletErrors newWallet(uint32_t wallet_spec, uint8_t *name, bool use_seed, uint8
 	{
 		memcpy(current_wallet.encrypted.seed, seed, SEED_LENGTH);
 	}
-	else
+	calculateWalletChecksum(current_wallet.encrypted.checksum);
+
+	// The wallet directory must be updated before the wallet record is
+	// written, so that it never claims an occupied slot is empty. Hidden
+	// wallets leave the version field alone, so there's nothing to update.
+	if (!make_hidden)
 	{
-		if (getRandom256(random_buffer))
-		{
-			last_error = WALLET_RNG_FAILURE;
-			return last_error;
-		}
-		memcpy(current_wallet.encrypted.seed, random_buffer, 32);
-		if (getRandom256(random_buffer))
+		r = updateWalletDirectory(wallet_spec, current_wallet.unencrypted.version);
+		if (r != WALLET_NO_ERROR)
 		{
-			last_error = WALLET_RNG_FAILURE;
+			uninitWallet();
+			last_error = r;
 			return last_error;
 		}
-		memcpy(&(current_wallet.encrypted.seed[32]), random_buffer, 32);
 	}
-	calculateWalletChecksum(current_wallet.encrypted.checksum);
-
 	r = writeCurrentWalletRecord(wallet_nv_address);
 	if (r != WALLET_NO_ERROR)
 	{
+		uninitWallet();
 		last_error = r;
 		return last_error;
 	}
@@ -1005,6 +1288,7 @@ bool checkWalletLoaded(void)
 WalletErrors getPublicKey(uint8_t *out_address, PointAffine *out_public_key, AddressHandle ah_root, AddressHandle ah_chain, AddressHandle ah_index)
 {
 	uint8_t buffer[32];
+	uint8_t compressed_public_key[33];
 	HashState hs;
 	WalletErrors r;
 	uint8_t i;
@@ -1039,31 +1323,25 @@ WalletErrors getPublicKey(uint8_t *out_address, PointAffine *out_public_key, Add
 //	memcpy(buffer, staticPrivate, 32);
 
 	// Calculate public key.
-	setToG(out_public_key);
-	pointMultiply(out_public_key, buffer);
+	pointMultiplyG(out_public_key, buffer);
 	// Calculate address. The Bitcoin convention is to hash the public key in
-	// big-endian format, which is why the counters run backwards in the next
-	// two loops.
+	// big-endian format, which is why the counter runs backwards in the next
+	// loop.
 	// This should calculate the COMPRESSED VERION for new compatibility
-
-
-
-	sha256Begin(&hs);
-
-//	sha256WriteByte(&hs, 0x04);
 	if ((out_public_key->y[0])%2 == 0)
 	{
-		sha256WriteByte(&hs, 0x02);
+		compressed_public_key[0] = 0x02;
 	}
 	else
 	{
-		sha256WriteByte(&hs, 0x03);
+		compressed_public_key[0] = 0x03;
 	}
-
 	for (i = 32; i--; )
 	{
-		sha256WriteByte(&hs, out_public_key->x[i]);
+		compressed_public_key[32 - i] = out_public_key->x[i];
 	}
+	sha256Begin(&hs);
+	sha256WriteBytes(&hs, compressed_public_key, sizeof(compressed_public_key));
 //	for (i = 32; i--; )
 //	{
 //		sha256WriteByte(&hs, out_public_key->y[i]);
@@ -1100,6 +1378,7 @@ WalletErrors getPublicKey(uint8_t *out_address, PointAffine *out_public_key, Add
 WalletErrors getAddressAndPublicKey(uint8_t *out_address, PointAffine *out_public_key, AddressHandle ah_root, AddressHandle ah_chain, AddressHandle ah_index)
 {
 	uint8_t buffer[32];
+	uint8_t compressed_public_key[33];
 	HashState hs;
 	WalletErrors r;
 	uint8_t i;
@@ -1134,31 +1413,25 @@ WalletErrors getAddressAndPublicKey(uint8_t *out_address, PointAffine *out_publi
 //	memcpy(buffer, staticPrivate, 32);
 
 	// Calculate public key.
-	setToG(out_public_key);
-	pointMultiply(out_public_key, buffer);
+	pointMultiplyG(out_public_key, buffer);
 	// Calculate address. The Bitcoin convention is to hash the public key in
-	// big-endian format, which is why the counters run backwards in the next
-	// two loops.
+	// big-endian format, which is why the counter runs backwards in the next
+	// loop.
 	// This should calculate the COMPRESSED VERION for new compatibility
-
-
-
-	sha256Begin(&hs);
-
-//	sha256WriteByte(&hs, 0x04);
 	if ((out_public_key->y[0])%2 == 0)
 	{
-		sha256WriteByte(&hs, 0x02);
+		compressed_public_key[0] = 0x02;
 	}
 	else
 	{
-		sha256WriteByte(&hs, 0x03);
+		compressed_public_key[0] = 0x03;
 	}
-
 	for (i = 32; i--; )
 	{
-		sha256WriteByte(&hs, out_public_key->x[i]);
+		compressed_public_key[32 - i] = out_public_key->x[i];
 	}
+	sha256Begin(&hs);
+	sha256WriteBytes(&hs, compressed_public_key, sizeof(compressed_public_key));
 //	for (i = 32; i--; )
 //	{
 //		sha256WriteByte(&hs, out_public_key->y[i]);
@@ -1166,10 +1439,7 @@ WalletErrors getAddressAndPublicKey(uint8_t *out_address, PointAffine *out_publi
 	sha256Finish(&hs);
 	writeHashToByteArray(buffer, &hs, true);
 	ripemd160Begin(&hs);
-	for (i = 0; i < 32; i++)
-	{
-		ripemd160WriteByte(&hs, buffer[i]);
-	}
+	ripemd160WriteBytes(&hs, buffer, 32);
 	ripemd160Finish(&hs);
 	writeHashToByteArray(buffer, &hs, true);
 	memcpy(out_address, buffer, 20);
@@ -1204,8 +1474,7 @@ WalletErrors getMasterPublicKey(PointAffine *out_public_key, uint8_t *out_chain_
 	swapEndian256(k_par); // since seed is big-endian
 	setFieldToN();
 	bigModulo(k_par, k_par); // just in case
-	setToG(out_public_key);
-	pointMultiply(out_public_key, k_par);
+	pointMultiplyG(out_public_key, k_par);
 	last_error = WALLET_NO_ERROR;
 	return last_error;
 }
@@ -1400,6 +1669,10 @@ WalletErrors changeEncryptionKey(const uint8_t *password, const unsigned int pas
 
 	calculateWalletChecksum(current_wallet.encrypted.checksum);
 	last_error = writeCurrentWalletRecord(wallet_nv_address);
+	if ((last_error == WALLET_NO_ERROR) && !is_hidden_wallet)
+	{
+		last_error = updateWalletDirectory((wallet_nv_address - WALLET_START_ADDRESS) / sizeof(WalletRecord), current_wallet.unencrypted.version);
+	}
 	return last_error;
 }
 
@@ -1455,33 +1728,89 @@ WalletErrors changeWalletName(uint8_t *new_name)
   */
 WalletErrors getWalletInfo(uint32_t *out_version, uint8_t *out_name, uint8_t *out_uuid, uint32_t wallet_spec)
 {
-	WalletErrors r;
-	WalletRecord local_wallet_record;
-	uint32_t local_wallet_nv_address = 0;
-
-	local_wallet_record.unencrypted.version = 0;
+	struct WalletRecordUnencryptedStruct header;
 
-	if (getNumberOfWallets() == 0)
-	{
-		return last_error; // propagate error code
-	}
-	if (wallet_spec >= num_wallets)
+	if (wallet_spec >= NUM_WALLET_SLOTS)
 	{
 		last_error = WALLET_INVALID_WALLET_NUM;
 		return last_error;
 	}
-	local_wallet_nv_address = WALLET_START_ADDRESS + wallet_spec * sizeof(WalletRecord);
-	r = readWalletRecord(&local_wallet_record, local_wallet_nv_address);
-	if (r != WALLET_NO_ERROR)
+	// Only the unencrypted portion is needed, so don't bother reading (and
+	// decrypting) the rest of the wallet record.
+	if (nonVolatileRead((uint8_t *)&header, WALLET_START_ADDRESS + wallet_spec * sizeof(WalletRecord) + offsetof(WalletRecord, unencrypted), sizeof(header)) != NV_NO_ERROR)
 	{
-		last_error = r;
+		last_error = WALLET_READ_ERROR;
 		return last_error;
 	}
-	*out_version = local_wallet_record.unencrypted.version;
-	memcpy(out_name, local_wallet_record.unencrypted.name, NAME_LENGTH);
-	memcpy(out_uuid, local_wallet_record.unencrypted.uuid, DEVICE_UUID_LENGTH);
+	// The wallet directory may be out of date if a write to it was
+	// interrupted, so take this opportunity to correct it. Only a cached
+	// copy which actually disagrees with the wallet record is written back;
+	// listing wallets must not otherwise write to (or rebuild) the
+	// directory. Failure to correct it isn't fatal, since the wallet record
+	// is authoritative.
+	if (wallet_directory_loaded && (getSlotState(wallet_spec) != versionToSlotState(header.version)))
+	{
+		updateWalletDirectory(wallet_spec, header.version);
+	}
+	*out_version = header.version;
+	memcpy(out_name, header.name, NAME_LENGTH);
+	memcpy(out_uuid, header.uuid, DEVICE_UUID_LENGTH);
 
+	last_error = WALLET_NO_ERROR;
+	return last_error;
+}
 
+/** Obtain the version of a wallet slot, using the wallet directory. This is
+  * much cheaper than getWalletInfo(), since it usually doesn't need to access
+  * non-volatile storage at all. Like getWalletInfo(), this does not require
+  * the wallet to be loaded and reports a hidden wallet as
+  * #VERSION_NOTHING_THERE.
+  *
+  * If a write to the wallet directory was interrupted, this may report a
+  * version for a slot which is empty; use getWalletInfo() to be sure.
+  * However, it will never report #VERSION_NOTHING_THERE for a slot
+  * containing a wallet which is not hidden.
+  * \param out_version The version (see #WalletVersion) of the wallet slot
+  *                    will be written to here (if everything goes well).
+  * \param wallet_spec The wallet number of the wallet slot to query.
+  * \return #WALLET_NO_ERROR on success, or one of #WalletErrorsEnum if an
+  *         error occurred.
+  */
+WalletErrors getWalletSlotVersion(uint32_t *out_version, uint32_t wallet_spec)
+{
+	DirectorySlotState state;
+
+	if (wallet_spec >= NUM_WALLET_SLOTS)
+	{
+		last_error = WALLET_INVALID_WALLET_NUM;
+		return last_error;
+	}
+	last_error = loadWalletDirectory();
+	if (last_error != WALLET_NO_ERROR)
+	{
+		return last_error;
+	}
+	state = getSlotState(wallet_spec);
+	if (state == SLOT_EMPTY)
+	{
+		*out_version = VERSION_NOTHING_THERE;
+	}
+	else if (state == SLOT_UNENCRYPTED)
+	{
+		*out_version = VERSION_UNENCRYPTED;
+	}
+	else if (state == SLOT_ENCRYPTED)
+	{
+		*out_version = VERSION_IS_ENCRYPTED;
+	}
+	else
+	{
+		if (nonVolatileRead((uint8_t *)out_version, WALLET_START_ADDRESS + wallet_spec * sizeof(WalletRecord) + offsetof(WalletRecord, unencrypted.version), sizeof(uint32_t)) != NV_NO_ERROR)
+		{
+			last_error = WALLET_READ_ERROR;
+			return last_error;
+		}
+	}
 	last_error = WALLET_NO_ERROR;
 	return last_error;
 }
@@ -1535,70 +1864,342 @@ WalletErrors backupWallet(bool do_encrypt, uint32_t destination_device)
 	}
 }
 
-/** Obtain the size of non-volatile storage by doing a bunch of test reads.
-  * \return The size in bytes, less one, of non-volatile storage. 0 indicates
-  *         that a read error occurred. For example, a return value of 9999
-  *         means that non-volatile storage is 10000 bytes large (or
-  *         equivalently, 9999 is the largest valid address).
+/** Get the number of wallets which can fit in non-volatile storage, assuming
+  * the storage format specified in storage_common.h.
+  * \return The number of wallets.
   */
-static uint32_t findOutNonVolatileSize(void)
+uint32_t getNumberOfWallets(void)
 {
-	uint32_t test_bit;
-	uint32_t size;
-	uint8_t junk;
-	NonVolatileReturn r;
+	last_error = WALLET_NO_ERROR;
+	return NUM_WALLET_SLOTS;
+}
+
+
+#ifdef TEST_WALLET
+
+/** Size (in bytes) of the chunks which the wallet space restore tests write,
+  * matching what setBulkCallback() uses. */
+#define TEST_RESTORE_CHUNK_SIZE	256
 
-	// Find out size using binary search.
-	test_bit = 0x80000000;
-	size = 0;
-	while (test_bit != 0)
+/** Number of version field writes done by sanitiseNonVolatileStorage(). */
+static uint32_t version_field_writes;
+
+/** Called by sanitiseNonVolatileStorage() every time it clears a version
+  * field.
+  * \param address The address of the version field which was cleared.
+  */
+void logVersionFieldWrite(uint32_t address)
+{
+	version_field_writes++;
+}
+
+/** Report success if a condition is true, otherwise report failure.
+  * \param condition The condition to check.
+  * \param description Printed if the condition is false.
+  */
+static void checkCondition(bool condition, const char *description)
+{
+	if (condition)
 	{
-		size |= test_bit;
-		r = nonVolatileRead(&junk, size, 1);
-		if (r == NV_INVALID_ADDRESS)
+		reportSuccess();
+	}
+	else
+	{
+		printf("%s\n", description);
+		reportFailure();
+	}
+}
+
+/** Format non-volatile storage and create an unencrypted wallet in slot 0,
+  * so that there's something for the restore tests to destroy.
+  */
+static void setUpWalletSpace(void)
+{
+	uint8_t pool[ENTROPY_POOL_LENGTH];
+	uint8_t name[NAME_LENGTH];
+	uint8_t pin[32];
+	unsigned int i;
+
+	for (i = 0; i < sizeof(pool); i++)
+	{
+		pool[i] = (uint8_t)rand();
+	}
+	initialiseEntropyPool(pool);
+	sanitiseNonVolatileStorage(0, EEPROM_SIZE, NULL);
+	memset(name, ' ', sizeof(name));
+	memset(pin, 0, sizeof(pin));
+	if (newWallet(0, name, false, NULL, false, NULL, 0, pin, true) != WALLET_NO_ERROR)
+	{
+		printf("Couldn't create wallet for restore tests\n");
+		reportFailure();
+	}
+	uninitWallet();
+}
+
+/** Check that an abandoned restore left a clean, erased wallet space: none of
+  * the restored chunks are there, the entropy pool is usable and every
+  * wallet slot (according to both the wallet records and the directory) is
+  * empty.
+  * \param restored The data which was partially restored.
+  * \param chunks_written Number of chunks of restored which were written.
+  */
+static void checkAbandonedRestore(const uint8_t *restored, uint32_t chunks_written)
+{
+	uint8_t chunk[TEST_RESTORE_CHUNK_SIZE];
+	uint8_t pool[ENTROPY_POOL_LENGTH];
+	uint8_t name[NAME_LENGTH];
+	uint8_t uuid[DEVICE_UUID_LENGTH];
+	uint32_t version;
+	uint32_t i;
+	bool leaked;
+	bool all_empty;
+
+	leaked = false;
+	for (i = 0; i < chunks_written; i++)
+	{
+		readWalletSpace(chunk, i * sizeof(chunk), sizeof(chunk));
+		if (!memcmp(chunk, &(restored[i * sizeof(chunk)]), sizeof(chunk)))
 		{
-			size ^= test_bit; // too big; clear it
+			leaked = true;
 		}
-		else if (r != NV_NO_ERROR)
+	}
+	checkCondition(!leaked, "Partially restored data survived abortWalletSpaceWrite()");
+	checkCondition(!getEntropyPool(pool), "Entropy pool not usable after abandoned restore");
+	all_empty = true;
+	for (i = 0; i < NUM_WALLET_SLOTS; i++)
+	{
+		if ((getWalletInfo(&version, name, uuid, i) != WALLET_NO_ERROR) || (version != VERSION_NOTHING_THERE))
 		{
-			last_error = WALLET_READ_ERROR;
-			return 0; // read error occurred
+			all_empty = false;
+		}
+		if ((getWalletSlotVersion(&version, i) != WALLET_NO_ERROR) || (version != VERSION_NOTHING_THERE))
+		{
+			all_empty = false;
 		}
-		test_bit >>= 1;
 	}
-	last_error = WALLET_NO_ERROR;
-	return size;
+	checkCondition(all_empty, "Wallet slot not empty after abandoned restore");
 }
 
-/** Get the number of wallets which can fit in non-volatile storage, assuming
-  * the storage format specified in storage_common.h.
-  * This will set #num_wallets.
-  * \return The number of wallets on success, or 0 if a read error occurred.
-  */
-uint32_t getNumberOfWallets(void)
+/** Test the chunked wallet space restore used by SetBulk, in particular
+  * that a restore which fails part-way never leaves a half-restored wallet
+  * space behind. */
+static void testWalletSpaceRestore(void)
 {
+	static uint8_t backup[EEPROM_SIZE];
+	static uint8_t garbage[EEPROM_SIZE];
+	static uint8_t before[EEPROM_SIZE];
+	static uint8_t after[EEPROM_SIZE];
 	uint32_t size;
+	uint32_t offset;
+	uint32_t version;
+	uint32_t i;
+	bool write_failed;
 
-	last_error = WALLET_NO_ERROR;
-	if (num_wallets == 0)
+	size = getWalletSpaceSize();
+	for (i = 0; i < size; i++)
+	{
+		garbage[i] = (uint8_t)rand();
+	}
+
+	// A good backup, to restore at the end.
+	setUpWalletSpace();
+	readWalletSpace(backup, 0, size);
+
+	// Writes are refused unless a restore has been started.
+	checkCondition(writeWalletSpace(garbage, 0, TEST_RESTORE_CHUNK_SIZE) == WALLET_INVALID_OPERATION, "writeWalletSpace() accepted without beginWalletSpaceWrite()");
+
+	// Abandoning when no restore is in progress must not touch anything.
+	nonVolatileRead(before, 0, EEPROM_SIZE);
+	abortWalletSpaceWrite();
+	nonVolatileRead(after, 0, EEPROM_SIZE);
+	checkCondition(!memcmp(before, after, EEPROM_SIZE), "abortWalletSpaceWrite() wrote without a restore in progress");
+
+	// Short stream: only the first 3 chunks arrive.
+	setUpWalletSpace();
+	checkCondition(beginWalletSpaceWrite() == WALLET_NO_ERROR, "beginWalletSpaceWrite() failed");
+	for (i = 0; i < 3; i++)
+	{
+		writeWalletSpace(&(garbage[i * TEST_RESTORE_CHUNK_SIZE]), i * TEST_RESTORE_CHUNK_SIZE, TEST_RESTORE_CHUNK_SIZE);
+	}
+	version_field_writes = 0;
+	abortWalletSpaceWrite();
+	checkCondition(version_field_writes == NUM_WALLET_SLOTS, "Abandoned restore didn't clear every version field");
+	checkAbandonedRestore(garbage, 3);
+
+	// Corrupt stream: all of the data arrives, but the rest of the message
+	// doesn't decode.
+	setUpWalletSpace();
+	beginWalletSpaceWrite();
+	write_failed = false;
+	for (offset = 0; offset < size; offset += TEST_RESTORE_CHUNK_SIZE)
 	{
-		// Need to calculate number of wallets that can fit in non-volatile
-		// storage.
-		size = findOutNonVolatileSize();
-		if (size != 0)
+		if (writeWalletSpace(&(garbage[offset]), offset, MIN(TEST_RESTORE_CHUNK_SIZE, size - offset)) != WALLET_NO_ERROR)
 		{
-			if (size != 0xffffffff)
-			{
-				// findOutNonVolatileSize() returns the size of non-volatile
-				// storage, less one byte.
-				size++;
-			}
-			num_wallets = (size - WALLET_START_ADDRESS) / sizeof(WalletRecord);
+			write_failed = true;
+		}
+	}
+	checkCondition(!write_failed, "writeWalletSpace() failed");
+	abortWalletSpaceWrite();
+	checkAbandonedRestore(garbage, size / TEST_RESTORE_CHUNK_SIZE);
+
+	// Writes past the end of the wallet space are refused.
+	beginWalletSpaceWrite();
+	checkCondition(writeWalletSpace(garbage, size - 16, 32) == WALLET_INVALID_OPERATION, "writeWalletSpace() accepted write past end");
+
+	// A complete restore brings back the wallet, including in the wallet
+	// directory.
+	for (offset = 0; offset < size; offset += TEST_RESTORE_CHUNK_SIZE)
+	{
+		writeWalletSpace(&(backup[offset]), offset, MIN(TEST_RESTORE_CHUNK_SIZE, size - offset));
+	}
+	finishWalletSpaceWrite();
+	readWalletSpace(after, 0, size);
+	checkCondition(!memcmp(backup, after, size), "Restored wallet space doesn't match backup");
+	checkCondition((getWalletSlotVersion(&version, 0) == WALLET_NO_ERROR) && (version == VERSION_UNENCRYPTED), "Restored wallet missing from directory");
+	checkCondition(abortWalletSpaceWrite() == WALLET_NO_ERROR, "abortWalletSpaceWrite() after finishWalletSpaceWrite() failed");
+	readWalletSpace(after, 0, size);
+	checkCondition(!memcmp(backup, after, size), "abortWalletSpaceWrite() after finishWalletSpaceWrite() changed wallet space");
+}
+
+/** Check that the wallet directory agrees with the version field of every
+  * wallet record, both in the cached copy and in non-volatile storage.
+  * \param description Printed if they don't agree.
+  */
+static void checkDirectoryConsistent(const char *description)
+{
+	WalletDirectory stored;
+	uint8_t hash[CHECKSUM_LENGTH];
+	uint8_t name[NAME_LENGTH];
+	uint8_t uuid[DEVICE_UUID_LENGTH];
+	uint32_t info_version;
+	uint32_t slot_version;
+	uint32_t i;
+	bool consistent;
+
+	consistent = true;
+	for (i = 0; i < NUM_WALLET_SLOTS; i++)
+	{
+		if ((getWalletInfo(&info_version, name, uuid, i) != WALLET_NO_ERROR)
+			|| (getWalletSlotVersion(&slot_version, i) != WALLET_NO_ERROR)
+			|| (info_version != slot_version))
+		{
+			consistent = false;
 		}
-		// If findOutNonVolatileSize() returned 0, num_wallets will still be
-		// 0, signifying that a read error occurred. last_error will also
-		// be set appropriately.
 	}
-	return num_wallets;
+	nonVolatileRead((uint8_t *)&stored, WALLET_DIRECTORY_ADDRESS, sizeof(stored));
+	calculateDirectoryChecksum(hash);
+	if ((stored.magic != WALLET_DIRECTORY_MAGIC)
+		|| memcmp(&stored, &wallet_directory, sizeof(stored))
+		|| memcmp(stored.checksum, hash, sizeof(hash)))
+	{
+		consistent = false;
+	}
+	checkCondition(consistent, description);
+}
+
+/** Check that calling getWalletInfo() for every slot doesn't change
+  * anything in non-volatile storage.
+  * \param description Printed if something changed.
+  */
+static void checkGetWalletInfoDoesntWrite(const char *description)
+{
+	static uint8_t before[EEPROM_SIZE];
+	static uint8_t after[EEPROM_SIZE];
+	uint8_t name[NAME_LENGTH];
+	uint8_t uuid[DEVICE_UUID_LENGTH];
+	uint32_t version;
+	uint32_t i;
+
+	nonVolatileRead(before, 0, EEPROM_SIZE);
+	for (i = 0; i < NUM_WALLET_SLOTS; i++)
+	{
+		getWalletInfo(&version, name, uuid, i);
+	}
+	nonVolatileRead(after, 0, EEPROM_SIZE);
+	checkCondition(!memcmp(before, after, EEPROM_SIZE), description);
 }
 
+/** Test the wallet directory (see #WalletDirectoryStruct): that it tracks
+  * the wallet records, that a corrupt or missing directory is rebuilt, that
+  * a stale one is corrected and that hidden wallets never show up in it. */
+static void testWalletDirectory(void)
+{
+	uint8_t name[NAME_LENGTH];
+	uint8_t pin[32];
+	uint8_t password[4] = {'a', 'b', 'c', 'd'};
+	uint8_t junk[WALLET_DIRECTORY_LENGTH];
+	uint32_t version;
+	uint32_t i;
+
+	if (NUM_WALLET_SLOTS < 4)
+	{
+		printf("Not enough wallet slots for directory tests\n");
+		reportFailure();
+		return;
+	}
+
+	// Slot 0 unencrypted, slot 1 hidden, slot 2 encrypted, slot 3 empty.
+	setUpWalletSpace();
+	memset(name, ' ', sizeof(name));
+	memset(pin, 0, sizeof(pin));
+	checkCondition(newWallet(1, name, false, NULL, true, password, sizeof(password), pin, true) == WALLET_NO_ERROR, "Couldn't create hidden wallet");
+	checkCondition(newWallet(2, name, false, NULL, false, password, sizeof(password), pin, true) == WALLET_NO_ERROR, "Couldn't create encrypted wallet");
+	uninitWallet();
+	checkDirectoryConsistent("Directory doesn't match wallet records after newWallet()");
+	checkCondition((getWalletSlotVersion(&version, 1) == WALLET_NO_ERROR) && (version == VERSION_NOTHING_THERE), "Directory reveals hidden wallet");
+	checkCondition((getWalletSlotVersion(&version, 2) == WALLET_NO_ERROR) && (version == VERSION_IS_ENCRYPTED), "Directory has wrong state for encrypted wallet");
+	checkGetWalletInfoDoesntWrite("getWalletInfo() wrote to an up to date directory");
+
+	// Corrupt directory: garbage in bytes 0 to 63.
+	for (i = 0; i < sizeof(junk); i++)
+	{
+		junk[i] = (uint8_t)rand();
+	}
+	nonVolatileWrite(junk, WALLET_DIRECTORY_ADDRESS, sizeof(junk));
+	nonVolatileFlush();
+	wallet_directory_loaded = false;
+	checkGetWalletInfoDoesntWrite("getWalletInfo() rebuilt a corrupt directory");
+	checkCondition((getWalletSlotVersion(&version, 2) == WALLET_NO_ERROR) && (version == VERSION_IS_ENCRYPTED), "Corrupt directory not rebuilt");
+	checkDirectoryConsistent("Rebuilt directory doesn't match wallet records");
+	checkCondition((getWalletSlotVersion(&version, 1) == WALLET_NO_ERROR) && (version == VERSION_NOTHING_THERE), "Rebuilt directory reveals hidden wallet");
+
+	// Corrupt checksum, with a valid magic.
+	nonVolatileRead(junk, WALLET_DIRECTORY_ADDRESS, sizeof(junk));
+	junk[WALLET_DIRECTORY_LENGTH - 1] ^= 1;
+	nonVolatileWrite(junk, WALLET_DIRECTORY_ADDRESS, sizeof(junk));
+	nonVolatileFlush();
+	wallet_directory_loaded = false;
+	checkCondition((getWalletSlotVersion(&version, 0) == WALLET_NO_ERROR) && (version == VERSION_UNENCRYPTED), "Directory with bad checksum not rebuilt");
+	checkDirectoryConsistent("Directory rebuilt after bad checksum doesn't match wallet records");
+
+	// Missing directory, as left by invalidateWalletDirectory().
+	invalidateWalletDirectory();
+	checkCondition((getWalletSlotVersion(&version, 3) == WALLET_NO_ERROR) && (version == VERSION_NOTHING_THERE), "Missing directory not rebuilt");
+	checkDirectoryConsistent("Directory rebuilt after it went missing doesn't match wallet records");
+
+	// Stale directory: it claims that empty slot 3 is occupied, which is
+	// what an interrupted deleteWallet() leaves behind. getWalletInfo()
+	// should correct it.
+	setSlotState(3, SLOT_ENCRYPTED);
+	writeWalletDirectory();
+	checkCondition((getWalletSlotVersion(&version, 3) == WALLET_NO_ERROR) && (version == VERSION_IS_ENCRYPTED), "Couldn't make directory stale");
+	checkDirectoryConsistent("getWalletInfo() didn't correct stale directory");
+	checkGetWalletInfoDoesntWrite("getWalletInfo() wrote to a corrected directory");
+
+	// Deleting a wallet updates the directory.
+	checkCondition(deleteWallet(2) == WALLET_NO_ERROR, "Couldn't delete wallet");
+	checkCondition((getWalletSlotVersion(&version, 2) == WALLET_NO_ERROR) && (version == VERSION_NOTHING_THERE), "Directory not updated by deleteWallet()");
+	checkDirectoryConsistent("Directory doesn't match wallet records after deleteWallet()");
+}
+
+int main(void)
+{
+	initTests(__FILE__);
+	srand(42);
+	testWalletSpaceRestore();
+	testWalletDirectory();
+	finishTests();
+	exit(0);
+}
+
+#endif // #ifdef TEST_WALLET
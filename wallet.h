@@ -89,6 +89,11 @@ typedef enum WalletErrorsEnum
 
 
 /**@}*/
+
+/** Function which sanitiseNonVolatileStorage() calls to report progress.
+  * \param percent How much of the sanitise is done, from 0 to 100.
+  */
+typedef void (*SanitiseProgressFunction)(uint8_t percent);
 #ifdef __cplusplus
      extern "C" {
 #endif
@@ -96,7 +101,7 @@ typedef enum WalletErrorsEnum
 extern WalletErrors walletGetLastError(void);
 extern WalletErrors initWallet(uint32_t wallet_spec, const uint8_t *password, const unsigned int password_length);
 extern WalletErrors uninitWallet(void);
-extern WalletErrors sanitiseNonVolatileStorage(uint32_t start, uint32_t end, bool quiet, int lang);
+extern WalletErrors sanitiseNonVolatileStorage(uint32_t start, uint32_t end, SanitiseProgressFunction progress);
 extern WalletErrors deleteWallet(uint32_t wallet_spec);
 extern WalletErrors newWallet(uint32_t wallet_spec, uint8_t *name, bool use_seed, uint8_t *seed, bool make_hidden, const uint8_t *password, const unsigned int password_length, const uint8_t *transaction_pin, bool transaction_pin_used_param);
 extern AddressHandle makeNewAddress(uint8_t *out_address, PointAffine *out_public_key);
@@ -110,12 +115,18 @@ extern WalletErrors getPublicExtendedKey(uint8_t *out, AddressHandle ah);
 extern WalletErrors changeEncryptionKey(const uint8_t *password, const unsigned int password_length);
 extern WalletErrors changeWalletName(uint8_t *new_name);
 extern WalletErrors getWalletInfo(uint32_t *out_version, uint8_t *out_name, uint8_t *out_uuid, uint32_t wallet_spec);
+extern WalletErrors getWalletSlotVersion(uint32_t *out_version, uint32_t wallet_spec);
 extern WalletErrors backupWallet(bool do_encrypt, uint32_t destination_device);
 extern uint32_t getNumberOfWallets(void);
 extern bool checkWalletLoaded(void);
 extern bool hasTransactionPin(void);
 extern uint8_t *getTransactionPINhash(void);
-extern uint32_t readEntireWalletSpace(uint8_t *bulkData);
+extern uint32_t getWalletSpaceSize(void);
+extern WalletErrors readWalletSpace(uint8_t *out, uint32_t offset, uint32_t length);
+extern WalletErrors beginWalletSpaceWrite(void);
+extern WalletErrors writeWalletSpace(uint8_t *in, uint32_t offset, uint32_t length);
+extern WalletErrors finishWalletSpaceWrite(void);
+extern WalletErrors abortWalletSpaceWrite(void);
 
 #ifdef __cplusplus
      }
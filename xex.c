@@ -37,12 +37,24 @@
 #include "prandom.h"
 #include "hwinterface.h"
 #include "endian.h"
+#include "xex.h"
+
+/** Number of 16 byte blocks that encryptedNonVolatileRead() and
+  * encryptedNonVolatileWrite() read from non-volatile storage at a time.
+  * A chunk starts at whichever block the read or write starts at, so chunks
+  * are not aligned to flash pages and one chunk can span two pages. */
+#define XEX_CHUNK_BLOCKS		16
 
 /** Primary encryption key. */
 static uint8_t nv_storage_encrypt_key[16];
 /** The tweak key can be considered as a secondary, independent encryption
   * key. */
 static uint8_t nv_storage_tweak_key[16];
+/** Expanded versions of #nv_storage_tweak_key and #nv_storage_encrypt_key,
+  * so that they don't have to be expanded for every block. */
+static XexContext nv_storage_context;
+/** Whether #nv_storage_context matches the current keys. */
+static bool is_nv_storage_context_valid;
 
 /** Double a 128 bit integer under GF(2 ^ 128) with
   * reducing polynomial x ^ 128 + x ^ 7 + x ^ 2 + x + 1.
@@ -70,48 +82,71 @@ static void doubleInGF(uint8_t *op1)
 	op1[0] = (uint8_t)(op1[0] ^ (0x87 & last_bit));
 }
 
+/** Expand the keys for a XEX context. Once this has been done, the context
+  * can be used for any number of blocks without repeating the (relatively
+  * slow) AES key expansion.
+  * \param ctx The XEX context to initialise.
+  * \param tweak_key A 128 bit AES key.
+  * \param encrypt_key Another 128 bit AES key. This must be independent of
+  *                    tweak_key.
+  */
+void xexInitContext(XexContext *ctx, const uint8_t *tweak_key, const uint8_t *encrypt_key)
+{
+	aesExpandKey(ctx->tweak_expanded_key, (uint8_t *)tweak_key);
+	aesExpandKey(ctx->encrypt_expanded_key, (uint8_t *)encrypt_key);
+}
+
+/** Clear out the expanded keys in a XEX context. The context must be
+  * initialised using xexInitContext() before it can be used again.
+  * \param ctx The XEX context to clear.
+  */
+void xexClearContext(XexContext *ctx)
+{
+	// Just to be sure, do two passes.
+	memset(ctx, 0xff, sizeof(XexContext));
+	memset(ctx, 0, sizeof(XexContext));
+}
+
 /** Combined XEX mode encrypt/decrypt, since they're almost the same.
-  * See xexEncryptInternal() and xexDecryptInternal() for a description of
-  * what this does and what each parameter is.
+  * See xexEncryptWithContext() and xexDecryptWithContext() for a description
+  * of what this does and what each parameter is.
+  * \param ctx See xexEncryptWithContext().
   * \param out For encryption, this will be the resulting ciphertext. For
   *            decryption, this will be the resulting plaintext.
   * \param in For encryption, this will be the source plaintext. For
   *           decryption, this will be the source ciphertext.
-  * \param n See xexEncryptInternal().
-  * \param seq See xexEncryptInternal().
-  * \param tweak_key See xexEncryptInternal().
-  * \param encrypt_key See xexEncryptInternal().
+  * \param n See xexEncryptWithContext().
+  * \param seq See xexEncryptWithContext().
   * \param is_decrypt To decrypt, use true. To encrypt, use false.
   */
-static void xexEnDecrypt(uint8_t *out, uint8_t *in, uint8_t *n, uint8_t seq, uint8_t *tweak_key, uint8_t *encrypt_key, bool is_decrypt)
+static void xexEnDecrypt(XexContext *ctx, uint8_t *out, uint8_t *in, uint8_t *n, uint8_t seq, bool is_decrypt)
 {
-	uint8_t expanded_key[EXPANDED_KEY_SIZE];
 	uint8_t delta[16];
 	uint8_t buffer[16];
 	uint8_t i;
 
-	aesExpandKey(expanded_key, tweak_key);
-	aesEncrypt(delta, n, expanded_key);
+	aesEncrypt(delta, n, ctx->tweak_expanded_key);
 	for (i = 0; i < seq; i++)
 	{
 		doubleInGF(delta);
 	}
 	memcpy(buffer, in, 16);
 	xor16Bytes(buffer, delta);
-	aesExpandKey(expanded_key, encrypt_key);
 	if (is_decrypt)
 	{
-		aesDecrypt(out, buffer, expanded_key);
+		aesDecrypt(out, buffer, ctx->encrypt_expanded_key);
 	}
 	else
 	{
-		aesEncrypt(out, buffer, expanded_key);
+		aesEncrypt(out, buffer, ctx->encrypt_expanded_key);
 	}
 	xor16Bytes(out, delta);
 }
 
-/** Encrypt one 16 byte block using AES in XEX mode. This uses an arbitrary
-  * encryption key.
+/** Encrypt one 16 byte block using AES in XEX mode. This uses the keys
+  * in a context initialised by xexInitContext().
+  * \param ctx The XEX context, which holds the expanded tweak and encryption
+  *            keys.
   * \param out The resulting ciphertext will be written to here. This must be
   *            a byte array with space for 16 bytes.
   * \param in The source plaintext. This must be a byte array containing the
@@ -123,33 +158,104 @@ static void xexEnDecrypt(uint8_t *out, uint8_t *in, uint8_t *n, uint8_t seq, uin
   *          tweakable parameters.
   * \param seq Specifies the block within the data unit. This is the other
   *            tweakable parameter.
-  * \param tweak_key A 128 bit AES key.
-  * \param encrypt_key Another 128 bit AES key. This must be independent of
-  *                    tweak_key.
   * \warning Don't use seq = 0, as this presents a security
   *          vulnerability (albeit a convoluted one). For more details about
   *          the seq = 0 issue, see section 6 ("Security of XEX") of
   *          Rogaway's paper (reference at the top of this file).
   */
-static void xexEncryptInternal(uint8_t *out, uint8_t *in, uint8_t *n, uint8_t seq, uint8_t *tweak_key, uint8_t *encrypt_key)
+void xexEncryptWithContext(XexContext *ctx, uint8_t *out, uint8_t *in, uint8_t *n, uint8_t seq)
 {
-	xexEnDecrypt(out, in, n, seq, tweak_key, encrypt_key, false);
+	xexEnDecrypt(ctx, out, in, n, seq, false);
 }
 
-/** Decrypt the 16 byte block using AES in XEX mode. This uses an arbitrary
-  * encryption key.
+/** Decrypt one 16 byte block using AES in XEX mode. This uses the keys
+  * in a context initialised by xexInitContext().
+  * \param ctx See xexEncryptWithContext().
   * \param out The resulting plaintext will be written to here. This must be
   *            a byte array with space for 16 bytes.
   * \param in The source ciphertext. This must be a byte array containing the
   *           16 byte ciphertext.
-  * \param n See xexEncryptInternal().
-  * \param seq See xexEncryptInternal().
-  * \param tweak_key See xexEncryptInternal().
-  * \param encrypt_key See xexEncryptInternal().
+  * \param n See xexEncryptWithContext().
+  * \param seq See xexEncryptWithContext().
   */
-static void xexDecryptInternal(uint8_t *out, uint8_t *in, uint8_t *n, uint8_t seq, uint8_t *tweak_key, uint8_t *encrypt_key)
+void xexDecryptWithContext(XexContext *ctx, uint8_t *out, uint8_t *in, uint8_t *n, uint8_t seq)
 {
-	xexEnDecrypt(out, in, n, seq, tweak_key, encrypt_key, true);
+	xexEnDecrypt(ctx, out, in, n, seq, true);
+}
+
+/** Combined multi-block XEX mode encrypt/decrypt. See xexEncryptBlocks()
+  * for a description of the parameters.
+  * \param ctx See xexEncryptBlocks().
+  * \param out See xexEncryptBlocks().
+  * \param in See xexEncryptBlocks().
+  * \param address See xexEncryptBlocks().
+  * \param num_blocks See xexEncryptBlocks().
+  * \param is_decrypt To decrypt, use true. To encrypt, use false.
+  */
+static void xexEnDecryptBlocks(XexContext *ctx, uint8_t *out, uint8_t *in, uint32_t address, uint32_t num_blocks, bool is_decrypt)
+{
+	uint8_t n[16];
+
+	memset(n, 0, 16);
+	while (num_blocks--)
+	{
+		writeU32LittleEndian(n, address);
+		xexEnDecrypt(ctx, out, in, n, 1, is_decrypt);
+		out += 16;
+		in += 16;
+		address += 16;
+	}
+}
+
+/** Encrypt consecutive 16 byte blocks of non-volatile storage using AES in
+  * XEX mode. Each block is treated as a separate data unit, with its
+  * address as the data unit number and a sequence number of 1. This is the
+  * same arrangement that encryptedNonVolatileWrite() uses, so that one
+  * expanded key schedule can be used for an entire read or write.
+  * \param ctx The XEX context, initialised by xexInitContext().
+  * \param out The resulting ciphertext will be written to here. This must be
+  *            a byte array with space for 16 * num_blocks bytes.
+  * \param in The source plaintext (16 * num_blocks bytes). This may be the
+  *           same as out.
+  * \param address Byte offset in non-volatile storage of the first block.
+  *                This must be a multiple of 16.
+  * \param num_blocks The number of 16 byte blocks to encrypt.
+  */
+void xexEncryptBlocks(XexContext *ctx, uint8_t *out, uint8_t *in, uint32_t address, uint32_t num_blocks)
+{
+	xexEnDecryptBlocks(ctx, out, in, address, num_blocks, false);
+}
+
+/** Decrypt consecutive 16 byte blocks of non-volatile storage using AES in
+  * XEX mode. This is the inverse of xexEncryptBlocks().
+  * \param ctx The XEX context, initialised by xexInitContext().
+  * \param out The resulting plaintext will be written to here. This must be
+  *            a byte array with space for 16 * num_blocks bytes.
+  * \param in The source ciphertext (16 * num_blocks bytes). This may be the
+  *           same as out.
+  * \param address Byte offset in non-volatile storage of the first block.
+  *                This must be a multiple of 16.
+  * \param num_blocks The number of 16 byte blocks to decrypt.
+  */
+void xexDecryptBlocks(XexContext *ctx, uint8_t *out, uint8_t *in, uint32_t address, uint32_t num_blocks)
+{
+	xexEnDecryptBlocks(ctx, out, in, address, num_blocks, true);
+}
+
+/** Get the XEX context for the keys set by setEncryptionKey(). The keys
+  * are expanded lazily, so that the all-zero key (which is the key
+  * before setEncryptionKey() is called, and after clearEncryptionKey() is
+  * called) also works.
+  * \return The XEX context.
+  */
+static XexContext *getStorageContext(void)
+{
+	if (!is_nv_storage_context_valid)
+	{
+		xexInitContext(&nv_storage_context, nv_storage_tweak_key, nv_storage_encrypt_key);
+		is_nv_storage_context_valid = true;
+	}
+	return &nv_storage_context;
 }
 
 /** Encrypt one 16 byte block using AES in XEX mode. This uses the encryption
@@ -158,17 +264,31 @@ static void xexDecryptInternal(uint8_t *out, uint8_t *in, uint8_t *n, uint8_t se
   *            a byte array with space for 16 bytes.
   * \param in The source plaintext. This must be a byte array containing the
   *           16 byte plaintext.
-  * \param n See xexEncryptInternal().
-  * \param seq See xexEncryptInternal().
+  * \param n See xexEncryptWithContext().
+  * \param seq See xexEncryptWithContext().
   */
 void xexEncrypt(uint8_t *out, uint8_t *in, uint8_t *n, uint8_t seq)
 {
-	xexEncryptInternal(out, in, n, seq, nv_storage_tweak_key, nv_storage_encrypt_key);
+	xexEncryptWithContext(getStorageContext(), out, in, n, seq);
 }
 
+/** Encrypt one 16 byte block using AES in XEX mode, using an arbitrary
+  * encryption key. This expands both keys on every call; to encrypt more
+  * than one block, use xexInitContext() and xexEncryptWithContext() instead.
+  * \param out See xexEncryptWithContext().
+  * \param in See xexEncryptWithContext().
+  * \param n See xexEncryptWithContext().
+  * \param seq See xexEncryptWithContext().
+  * \param tk The 128 bit tweak key.
+  * \param ek The 128 bit encryption key.
+  */
 void xexEncryptTweaked(uint8_t *out, uint8_t *in, uint8_t *n, uint8_t seq, uint8_t *tk, uint8_t *ek)
 {
-	xexEncryptInternal(out, in, n, seq, tk, ek);
+	XexContext ctx;
+
+	xexInitContext(&ctx, tk, ek);
+	xexEncryptWithContext(&ctx, out, in, n, seq);
+	xexClearContext(&ctx);
 }
 
 /** Decrypt the 16 byte block using AES in XEX mode. This uses the encryption
@@ -177,17 +297,31 @@ void xexEncryptTweaked(uint8_t *out, uint8_t *in, uint8_t *n, uint8_t seq, uint8
   *            a byte array with space for 16 bytes.
   * \param in The source ciphertext. This must be a byte array containing the
   *           16 byte ciphertext.
-  * \param n See xexEncryptInternal().
-  * \param seq See xexEncryptInternal().
+  * \param n See xexEncryptWithContext().
+  * \param seq See xexEncryptWithContext().
   */
 void xexDecrypt(uint8_t *out, uint8_t *in, uint8_t *n, uint8_t seq)
 {
-	xexDecryptInternal(out, in, n, seq, nv_storage_tweak_key, nv_storage_encrypt_key);
+	xexDecryptWithContext(getStorageContext(), out, in, n, seq);
 }
 
+/** Decrypt one 16 byte block using AES in XEX mode, using an arbitrary
+  * encryption key. This expands both keys on every call; to decrypt more
+  * than one block, use xexInitContext() and xexDecryptWithContext() instead.
+  * \param out See xexDecryptWithContext().
+  * \param in See xexDecryptWithContext().
+  * \param n See xexDecryptWithContext().
+  * \param seq See xexDecryptWithContext().
+  * \param tk The 128 bit tweak key.
+  * \param ek The 128 bit encryption key.
+  */
 void xexDecryptTweaked(uint8_t *out, uint8_t *in, uint8_t *n, uint8_t seq, uint8_t *tk, uint8_t *ek )
 {
-	xexDecryptInternal(out, in, n, seq, tk, ek);
+	XexContext ctx;
+
+	xexInitContext(&ctx, tk, ek);
+	xexDecryptWithContext(&ctx, out, in, n, seq);
+	xexClearContext(&ctx);
 }
 
 /** Set the combined encryption key.
@@ -200,6 +334,8 @@ void setEncryptionKey(const uint8_t *in)
 {
 	memcpy(nv_storage_encrypt_key, in, 16);
 	memcpy(nv_storage_tweak_key, &(in[16]), 16);
+	xexInitContext(&nv_storage_context, nv_storage_tweak_key, nv_storage_encrypt_key);
+	is_nv_storage_context_valid = true;
 }
 
 /** Get the combined encryption key.
@@ -251,12 +387,40 @@ void clearEncryptionKey(void)
 	memset(nv_storage_encrypt_key, 0xff, 16);
 	memset(nv_storage_tweak_key, 0, 16);
 	memset(nv_storage_encrypt_key, 0, 16);
+	xexClearContext(&nv_storage_context);
+	is_nv_storage_context_valid = false;
+}
+
+/** Read and decrypt consecutive 16 byte blocks from non-volatile storage.
+  * \param ctx The XEX context to decrypt with.
+  * \param out The resulting plaintext will be written to here. This must be
+  *            a byte array with space for 16 * num_blocks bytes.
+  * \param address Byte offset in non-volatile storage of the first block.
+  *                This must be a multiple of 16.
+  * \param num_blocks The number of 16 byte blocks to read.
+  * \return See #NonVolatileReturnEnum for return values.
+  */
+static NonVolatileReturn readAndDecryptBlocks(XexContext *ctx, uint8_t *out, uint32_t address, uint32_t num_blocks)
+{
+	NonVolatileReturn r;
+
+	r = nonVolatileRead(out, address, num_blocks * 16);
+	if (r != NV_NO_ERROR)
+	{
+		return r;
+	}
+	xexDecryptBlocks(ctx, out, out, address, num_blocks);
+	return NV_NO_ERROR;
 }
 
 /** Wrapper around nonVolatileWrite() which also encrypts data
   * using xexEncrypt(). Because this uses encryption, it is much slower
   * than nonVolatileWrite(). The parameters and return values are identical
   * to that of nonVolatileWrite().
+  *
+  * Only the partially overwritten blocks at the start and end of the write
+  * are read back and decrypted. The ciphertext for up to #XEX_CHUNK_BLOCKS
+  * blocks is passed to nonVolatileWrite() in one call.
   * \param data A pointer to the data to be written.
   * \param address Byte offset specifying where in non-volatile storage to
   *                start writing to.
@@ -269,12 +433,17 @@ NonVolatileReturn encryptedNonVolatileWrite(uint8_t *data, uint32_t address, uin
 {
 	uint32_t block_start;
 	uint32_t block_end;
+	uint32_t num_blocks;
+	uint32_t chunk_length;
 	uint8_t block_offset;
-	uint8_t ciphertext[16];
-	uint8_t plaintext[16];
-	uint8_t n[16];
+	uint8_t buffer[XEX_CHUNK_BLOCKS * 16];
+	XexContext *ctx;
 	NonVolatileReturn r;
 
+	if (length == 0)
+	{
+		return NV_NO_ERROR;
+	}
 	block_start = address & 0xfffffff0;
 	block_offset = (uint8_t)(address & 0x0000000f);
 	block_end = (address + length - 1) & 0xfffffff0;
@@ -284,31 +453,55 @@ NonVolatileReturn encryptedNonVolatileWrite(uint8_t *data, uint32_t address, uin
 		return NV_INVALID_ADDRESS;
 	}
 
-	memset(n, 0, 16);
-	for (; block_start <= block_end; block_start += 16)
+	// Every exit from the loop goes through the memset() below, so that no
+	// plaintext is left on the stack.
+	r = NV_NO_ERROR;
+	ctx = getStorageContext();
+	while (length > 0)
 	{
-		r = nonVolatileRead(ciphertext, block_start, 16);
-		if (r != NV_NO_ERROR)
+		num_blocks = ((block_end - block_start) >> 4) + 1;
+		if (num_blocks > XEX_CHUNK_BLOCKS)
+		{
+			num_blocks = XEX_CHUNK_BLOCKS;
+		}
+		chunk_length = num_blocks * 16 - block_offset;
+		if (chunk_length > length)
 		{
-			return r;
+			chunk_length = length;
+		}
+		// Only blocks which are partially overwritten need their existing
+		// contents; this can only be the first and last block of a chunk.
+		if ((block_offset != 0) || (chunk_length < 16))
+		{
+			r = readAndDecryptBlocks(ctx, buffer, block_start, 1);
+			if (r != NV_NO_ERROR)
+			{
+				break;
+			}
 		}
-		writeU32LittleEndian(n, block_start);
-		xexDecrypt(plaintext, ciphertext, n, 1);
-		while (length && block_offset < 16)
+		if ((num_blocks > 1) && (((block_offset + chunk_length) & 0x0f) != 0))
 		{
-			plaintext[block_offset++] = *data++;
-			length--;
+			r = readAndDecryptBlocks(ctx, &(buffer[(num_blocks - 1) * 16]), block_start + (num_blocks - 1) * 16, 1);
+			if (r != NV_NO_ERROR)
+			{
+				break;
+			}
 		}
+		memcpy(&(buffer[block_offset]), data, chunk_length);
+		data += chunk_length;
+		length -= chunk_length;
 		block_offset = 0;
-		xexEncrypt(ciphertext, plaintext, n, 1);
-		r = nonVolatileWrite(ciphertext, block_start, 16);
+		xexEncryptBlocks(ctx, buffer, buffer, block_start, num_blocks);
+		r = nonVolatileWrite(buffer, block_start, num_blocks * 16);
 		if (r != NV_NO_ERROR)
 		{
-			return r;
+			break;
 		}
+		block_start += num_blocks * 16;
 	}
+	memset(buffer, 0, sizeof(buffer));
 
-	return NV_NO_ERROR;
+	return r;
 }
 
 /** Wrapper around nonVolatileRead() which also decrypts data
@@ -325,12 +518,17 @@ NonVolatileReturn encryptedNonVolatileRead(uint8_t *data, uint32_t address, uint
 {
 	uint32_t block_start;
 	uint32_t block_end;
+	uint32_t num_blocks;
+	uint32_t chunk_length;
 	uint8_t block_offset;
-	uint8_t ciphertext[16];
-	uint8_t plaintext[16];
-	uint8_t n[16];
+	uint8_t buffer[XEX_CHUNK_BLOCKS * 16];
+	XexContext *ctx;
 	NonVolatileReturn r;
 
+	if (length == 0)
+	{
+		return NV_NO_ERROR;
+	}
 	block_start = address & 0xfffffff0;
 	block_offset = (uint8_t)(address & 0x0000000f);
 	block_end = (address + length - 1) & 0xfffffff0;
@@ -340,25 +538,36 @@ NonVolatileReturn encryptedNonVolatileRead(uint8_t *data, uint32_t address, uint
 		return NV_INVALID_ADDRESS;
 	}
 
-	memset(n, 0, 16);
-	for (; block_start <= block_end; block_start += 16)
+	// As in encryptedNonVolatileWrite(), every exit from the loop goes
+	// through the memset() below.
+	r = NV_NO_ERROR;
+	ctx = getStorageContext();
+	while (length > 0)
 	{
-		r = nonVolatileRead(ciphertext, block_start, 16);
+		num_blocks = ((block_end - block_start) >> 4) + 1;
+		if (num_blocks > XEX_CHUNK_BLOCKS)
+		{
+			num_blocks = XEX_CHUNK_BLOCKS;
+		}
+		r = readAndDecryptBlocks(ctx, buffer, block_start, num_blocks);
 		if (r != NV_NO_ERROR)
 		{
-			return r;
+			break;
 		}
-		writeU32LittleEndian(n, block_start);
-		xexDecrypt(plaintext, ciphertext, n, 1);
-		while (length && block_offset < 16)
+		chunk_length = num_blocks * 16 - block_offset;
+		if (chunk_length > length)
 		{
-			*data++ = plaintext[block_offset++];
-			length--;
+			chunk_length = length;
 		}
+		memcpy(data, &(buffer[block_offset]), chunk_length);
+		data += chunk_length;
+		length -= chunk_length;
 		block_offset = 0;
+		block_start += num_blocks * 16;
 	}
+	memset(buffer, 0, sizeof(buffer));
 
-	return NV_NO_ERROR;
+	return r;
 }
 
 #ifdef TEST_XEX
@@ -388,6 +597,7 @@ static void scanTestVectors(char *filename, int is_data_unit_seq_number)
 	uint8_t tweak_key[16];
 	uint8_t encrypt_key[16];
 	uint8_t tweak_value[16];
+	XexContext ctx;
 	uint8_t *plaintext;
 	uint8_t *ciphertext;
 	uint8_t *compare;
@@ -560,11 +770,12 @@ from http://csrc.nist.gov/groups/STM/cavp/#08\n", filename);
 
 			// Do encryption/decryption and compare
 			test_failed = false;
+			xexInitContext(&ctx, tweak_key, encrypt_key);
 			if (is_encrypt)
 			{
 				for (i = 0; i < data_unit_length; i += 16)
 				{
-					xexEncryptInternal(&(compare[i]), &(plaintext[i]), tweak_value, (uint8_t)(i >> 4), tweak_key, encrypt_key);
+					xexEncryptWithContext(&ctx, &(compare[i]), &(plaintext[i]), tweak_value, (uint8_t)(i >> 4));
 					if (memcmp(&(compare[i]), &(ciphertext[i]), 16))
 					{
 						test_failed = true;
@@ -576,7 +787,7 @@ from http://csrc.nist.gov/groups/STM/cavp/#08\n", filename);
 			{
 				for (i = 0; i < data_unit_length; i += 16)
 				{
-					xexDecryptInternal(&(compare[i]), &(ciphertext[i]), tweak_value, (uint8_t)(i >> 4), tweak_key, encrypt_key);
+					xexDecryptWithContext(&ctx, &(compare[i]), &(ciphertext[i]), tweak_value, (uint8_t)(i >> 4));
 					if (memcmp(&(compare[i]), &(plaintext[i]), 16))
 					{
 						test_failed = true;
@@ -632,6 +843,44 @@ int main(void)
 	scanTestVectors("XTSGenAES128i.rsp", 0);
 	scanTestVectors("XTSGenAES128d.rsp", 1);
 
+	// xexEncryptBlocks() and xexDecryptBlocks() should be equivalent to
+	// block-by-block xexEncrypt() and xexDecrypt().
+	for (i = 0; i < 16; i++)
+	{
+		uint8_t n[16];
+		uint8_t compare[128];
+		XexContext ctx;
+
+		for (j = 0; j < 32; j++)
+		{
+			one_key[j] = (uint8_t)rand();
+		}
+		for (j = 0; j < 128; j++)
+		{
+			buffer[j] = (uint8_t)rand();
+		}
+		setEncryptionKey(one_key);
+		memset(n, 0, 16);
+		for (j = 0; j < 128; j += 16)
+		{
+			writeU32LittleEndian(n, i * 128 + j);
+			xexEncrypt(&(compare[j]), &(buffer[j]), n, 1);
+		}
+		xexInitContext(&ctx, &(one_key[16]), one_key);
+		xexEncryptBlocks(&ctx, &(buffer[128]), buffer, i * 128, 8);
+		xexDecryptBlocks(&ctx, &(buffer[256]), &(buffer[128]), i * 128, 8);
+		if (memcmp(compare, &(buffer[128]), 128) || memcmp(buffer, &(buffer[256]), 128))
+		{
+			printf("xexEncryptBlocks()/xexDecryptBlocks() mismatch, i = %u\n", i);
+			reportFailure();
+		}
+		else
+		{
+			reportSuccess();
+		}
+	}
+	clearEncryptionKey();
+
 	for (i = 0; i < MAX_ADDRESS; i++)
 	{
 		what_storage_should_be[i] = (uint8_t)rand();
@@ -16,15 +16,33 @@
 
 #include "common.h"
 #include "hwinterface.h"
+#include "aes.h"
 
 /** Length, in bytes, of the encryption key that setEncryptionKey() and
   * getEncryptionKey() deal with. */
 #define WALLET_ENCRYPTION_KEY_LENGTH		32
 
+/** Expanded tweak and encryption keys for XEX mode. Use xexInitContext() to
+  * fill one of these in, so that many blocks can be encrypted or decrypted
+  * without expanding the keys again each time. */
+typedef struct XexContextStruct
+{
+	/** Expanded AES key used to encrypt the tweak value. */
+	uint8_t tweak_expanded_key[EXPANDED_KEY_SIZE];
+	/** Expanded AES key used to encrypt/decrypt data. */
+	uint8_t encrypt_expanded_key[EXPANDED_KEY_SIZE];
+} XexContext;
+
 #ifdef __cplusplus
      extern "C" {
 #endif
 
+extern void xexInitContext(XexContext *ctx, const uint8_t *tweak_key, const uint8_t *encrypt_key);
+extern void xexClearContext(XexContext *ctx);
+extern void xexEncryptWithContext(XexContext *ctx, uint8_t *out, uint8_t *in, uint8_t *n, uint8_t seq);
+extern void xexDecryptWithContext(XexContext *ctx, uint8_t *out, uint8_t *in, uint8_t *n, uint8_t seq);
+extern void xexEncryptBlocks(XexContext *ctx, uint8_t *out, uint8_t *in, uint32_t address, uint32_t num_blocks);
+extern void xexDecryptBlocks(XexContext *ctx, uint8_t *out, uint8_t *in, uint32_t address, uint32_t num_blocks);
 extern void xexEncrypt(uint8_t *out, uint8_t *in, uint8_t *n, uint8_t seq);
 extern void xexEncryptTweaked(uint8_t *out, uint8_t *in, uint8_t *n, uint8_t seq, uint8_t *tk, uint8_t *ek);
 extern void xexDecrypt(uint8_t *out, uint8_t *in, uint8_t *n, uint8_t seq);